@@ -8,10 +8,12 @@
 #ifndef PANDORA_API_H
 #define PANDORA_API_H 1
 
+#include "Pandora/EventResourceReport.h"
 #include "Pandora/ObjectParameters.h"
 #include "Pandora/Pandora.h"
 #include "Pandora/PandoraInputTypes.h"
 #include "Pandora/PandoraObjectFactories.h"
+#include "Pandora/PfoExportBuffer.h"
 
 namespace pandora { class AlgorithmFactory; class AlgorithmToolFactory; }
 
@@ -306,6 +308,24 @@ public:
      */
     static pandora::StatusCode GetPfoList(const pandora::Pandora &pandora, const std::string &pfoListName, const pandora::PfoList *&pPfoList);
 
+    /**
+     *  @brief  Export the current pfo list to flat, contiguous arrays, replacing the contents of a (reusable) pfo export buffer
+     * 
+     *  @param  pandora the pandora instance to get the objects from
+     *  @param  pfoExportBuffer the pfo export buffer
+     */
+    static pandora::StatusCode ExportCurrentPfoList(const pandora::Pandora &pandora, pandora::PfoExportBuffer &pfoExportBuffer);
+
+    /**
+     *  @brief  Export a named pfo list to flat, contiguous arrays, replacing the contents of a (reusable) pfo export buffer
+     * 
+     *  @param  pandora the pandora instance to get the objects from
+     *  @param  pfoListName the name of the pfo list
+     *  @param  pfoExportBuffer the pfo export buffer
+     */
+    static pandora::StatusCode ExportPfoList(const pandora::Pandora &pandora, const std::string &pfoListName,
+        pandora::PfoExportBuffer &pfoExportBuffer);
+
     /**
      *  @brief  Set the granularity level to be associated with a specified hit type
      * 
@@ -340,6 +360,32 @@ public:
      */
     static pandora::StatusCode SetShowerProfilePlugin(const pandora::Pandora &pandora, pandora::ShowerProfilePlugin *const pShowerProfilePlugin);
 
+    /**
+     *  @brief  Set the region partition plugin used by pandora to assign input calo hits and tracks to region instances
+     * 
+     *  @param  pandora the pandora instance to register the region partition plugin with
+     *  @param  pRegionPartitionPlugin address of the region partition plugin (will pass ownership to pandora)
+     */
+    static pandora::StatusCode SetRegionPartitionPlugin(const pandora::Pandora &pandora, pandora::RegionPartitionPlugin *const pRegionPartitionPlugin);
+
+    /**
+     *  @brief  Add a region instance, a separately configured pandora instance that reconstructs one largely independent region of
+     *          each event in its own manager state. Once region instances are added, calo hits and tracks created via the primary
+     *          instance are passed to the region instance chosen by the region partition plugin, and their relationships to mc
+     *          particles follow them. Mc particles and their relationships are provided to every region as well as to the primary
+     *          instance, whilst track parent-daughter and sibling relationships are only allowed between tracks in the same region.
+     *          Geometry should be provided to the region instances directly. Processing an event in the primary instance processes
+     *          all regions concurrently, using the primary instance thread pool, then transfers the current pfos from each region to
+     *          the primary "RegionPfos" list, which becomes the current pfo list before the primary algorithms are run. A region
+     *          whose processing fails is reported and contributes no pfos. The transferred pfos keep their type, but refer to
+     *          clusters, tracks and vertices owned by the region instance, so a region instance can only be reset or advanced via
+     *          its primary instance, and must outlive it.
+     * 
+     *  @param  pandora the primary pandora instance
+     *  @param  regionPandora the region pandora instance, with region index given by the order in which region instances are added
+     */
+    static pandora::StatusCode AddRegionInstance(const pandora::Pandora &pandora, const pandora::Pandora &regionPandora);
+
     /**
      *  @brief  Register an energy correction plugin
      * 
@@ -367,6 +413,73 @@ public:
      *  @param  pandora the pandora instance to reset
      */
     static pandora::StatusCode Reset(const pandora::Pandora &pandora);
+
+    /**
+     *  @brief  Reset pandora to process the next time slice of continuous readout, in place of the event reset, advancing a sliding
+     *          window across the slices. Calo hits with times at or after the window start time are retained, together with the
+     *          clusters in saved lists that consist solely of such calo hits; the retained clusters keep their list names and their
+     *          calo hits remain unavailable. All other objects are deleted, including all tracks, mc particles, vertices and pfos,
+     *          so mc particles and any calo hit relationships should be provided anew for each slice. Calo hits created for the next
+     *          slice join the retained calo hits in the "Input" list and are also held in the "NewInput" list, so that algorithms
+     *          can process only the newly arrived calo hits against the retained clusters. Any region instances are also advanced.
+     *          Retained calo hits keep their parent addresses, which identify them in later relationship calls and in exported pfos.
+     *          The client objects behind retained calo hits must therefore stay alive, and their addresses must not be reused for
+     *          any other object, until those calo hits leave the window.
+     * 
+     *  @param  pandora the pandora instance to reset
+     *  @param  windowStartTime the start time of the sliding window, compared with the calo hit times
+     */
+    static pandora::StatusCode AdvanceSlidingWindow(const pandora::Pandora &pandora, const float windowStartTime);
+
+    /**
+     *  @brief  Set the expected numbers of input objects per event, used to pre-reserve the input lists and per-object containers so
+     *          that they do not repeatedly regrow as objects are created. Pandora also maintains a running estimate from previous
+     *          events, and reserves for the larger of the hint and the estimate. A zero hint relies upon the estimate alone.
+     * 
+     *  @param  pandora the pandora instance to receive the hint
+     *  @param  nCaloHits the expected number of calo hits per event
+     *  @param  nTracks the expected number of tracks per event
+     *  @param  nMCParticles the expected number of mc particles per event
+     */
+    static pandora::StatusCode SetEventSizeHint(const pandora::Pandora &pandora, const unsigned int nCaloHits, const unsigned int nTracks,
+        const unsigned int nMCParticles);
+
+    /**
+     *  @brief  Get the resource report for the current event: the objects created and deleted, the named list sizes, the peak number
+     *          of live objects and estimated memory use, the reclustering depth and the calo hit fragmentation count. To be called
+     *          after processing an event and before the reset.
+     * 
+     *  @param  pandora the pandora instance to get the report from
+     *  @param  eventResourceReport to receive the event resource report
+     */
+    static pandora::StatusCode GetEventResourceReport(const pandora::Pandora &pandora, pandora::EventResourceReport &eventResourceReport);
+
+    /**
+     *  @brief  Start recording the input calls made via the pandora api (object creation, relationships, geometry, settings,
+     *          hit type granularities, event processing, reset and sliding window advance) to a compact binary trace file, for
+     *          offline replay. Object creation and relationship calls are recorded only if they succeed.
+     * 
+     *  @param  pandora the pandora instance whose input calls are to be recorded
+     *  @param  traceFileName the name of the output trace file
+     */
+    static pandora::StatusCode StartRecording(const pandora::Pandora &pandora, const std::string &traceFileName);
+
+    /**
+     *  @brief  Stop recording the input calls made via the pandora api, closing the trace file
+     * 
+     *  @param  pandora the pandora instance whose input calls are being recorded
+     */
+    static pandora::StatusCode StopRecording(const pandora::Pandora &pandora);
+
+    /**
+     *  @brief  Replay all input calls stored in a binary trace file. Algorithm factories and plugins are not recorded, so must
+     *          be registered with the pandora instance, as in the original client application, before replay begins. Input objects
+     *          created using custom factories cannot be replayed here, and require an ApiReplayer given equivalent factories.
+     * 
+     *  @param  pandora the pandora instance into which to replay the trace
+     *  @param  traceFileName the name of the input trace file
+     */
+    static pandora::StatusCode ReplayTrace(const pandora::Pandora &pandora, const std::string &traceFileName);
 };
 
 #endif // #ifndef PANDORA_API_H
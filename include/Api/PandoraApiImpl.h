@@ -13,7 +13,9 @@
 namespace pandora
 {
 
+class ApiRecorder;
 class Pandora;
+class TiXmlDocument;
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
@@ -44,6 +46,13 @@ private:
      */
     StatusCode ReadSettings(const std::string &xmlFileName) const;
 
+    /**
+     *  @brief  Read pandora settings
+     * 
+     *  @param  xmlDocument the xml document containing the settings
+     */
+    StatusCode ReadSettings(TiXmlDocument &xmlDocument) const;
+
     /**
      *  @brief  Register an algorithm factory with pandora
      * 
@@ -120,6 +129,14 @@ private:
      */
     StatusCode GetPfoList(const std::string &pfoListName, const PfoList *&pPfoList) const;
 
+    /**
+     *  @brief  Export a named pfo list, or the current pfo list if no name is specified, to a pfo export buffer
+     * 
+     *  @param  pfoListName the name of the pfo list, empty for the current pfo list
+     *  @param  pfoExportBuffer the pfo export buffer, whose contents are replaced
+     */
+    StatusCode ExportPfoList(const std::string &pfoListName, PfoExportBuffer &pfoExportBuffer) const;
+
     /**
      *  @brief  Set the granularity level to be associated with a specified hit type
      * 
@@ -149,6 +166,20 @@ private:
      */
     StatusCode SetShowerProfilePlugin(ShowerProfilePlugin *const pShowerProfilePlugin) const;
 
+    /**
+     *  @brief  Set the region partition plugin used by pandora
+     * 
+     *  @param  pRegionPartitionPlugin address of the region partition plugin (will pass ownership to pandora)
+     */
+    StatusCode SetRegionPartitionPlugin(RegionPartitionPlugin *const pRegionPartitionPlugin) const;
+
+    /**
+     *  @brief  Add a region pandora instance
+     * 
+     *  @param  pRegionPandora address of the region pandora instance
+     */
+    StatusCode AddRegionInstance(const Pandora *const pRegionPandora) const;
+
     /**
      *  @brief  Register an energy correction plugin
      * 
@@ -172,6 +203,57 @@ private:
      */
     StatusCode ResetEvent() const;
 
+    /**
+     *  @brief  Reset pandora to process the next time slice of continuous readout, advancing the sliding window
+     * 
+     *  @param  windowStartTime the start time of the sliding window
+     */
+    StatusCode AdvanceSlidingWindow(const float windowStartTime) const;
+
+    /**
+     *  @brief  Set the expected numbers of input objects per event
+     * 
+     *  @param  nCaloHits the expected number of calo hits per event
+     *  @param  nTracks the expected number of tracks per event
+     *  @param  nMCParticles the expected number of mc particles per event
+     */
+    StatusCode SetEventSizeHint(const unsigned int nCaloHits, const unsigned int nTracks, const unsigned int nMCParticles) const;
+
+    /**
+     *  @brief  Get the resource report for the current event
+     * 
+     *  @param  eventResourceReport to receive the event resource report
+     */
+    StatusCode GetEventResourceReport(EventResourceReport &eventResourceReport) const;
+
+    /**
+     *  @brief  Start recording all subsequent api input calls to a binary trace file
+     * 
+     *  @param  traceFileName the name of the output trace file
+     */
+    StatusCode StartRecording(const std::string &traceFileName) const;
+
+    /**
+     *  @brief  Stop recording api input calls, closing the trace file
+     */
+    StatusCode StopRecording() const;
+
+    /**
+     *  @brief  Replay the api input calls stored in a binary trace file
+     * 
+     *  @param  traceFileName the name of the input trace file
+     */
+    StatusCode ReplayTrace(const std::string &traceFileName) const;
+
+    /**
+     *  @brief  Set the api recorder, allowing recording to be suspended whilst a trace is replayed
+     * 
+     *  @param  pApiRecorder address of the api recorder, or null to suspend recording
+     * 
+     *  @return address of the api recorder previously set, or null
+     */
+    ApiRecorder *SetApiRecorder(ApiRecorder *const pApiRecorder);
+
     /**
      *  @brief  Constructor
      * 
@@ -183,6 +265,7 @@ private:
 
     friend class Pandora;
     friend class PandoraImpl;
+    friend class ApiReplayer;
     friend class ::PandoraApi;
 };
 
@@ -14,6 +14,7 @@
 #include "Pandora/PandoraInputTypes.h"
 #include "Pandora/PandoraInternal.h"
 #include "Pandora/PandoraObjectFactories.h"
+#include "Pandora/ThreadPool.h"
 
 namespace pandora { class Algorithm; class AlgorithmTool; class TiXmlElement; }
 namespace pandora { class CaloHit; class Cluster; class MCParticle; class ParticleFlowObject; class Track; class Vertex; }
@@ -214,6 +215,15 @@ public:
      */
     static pandora::StatusCode RepeatEventPreparation(const pandora::Algorithm &algorithm);
 
+    /**
+     *  @brief  Complete the event preparation stages deferred by the pandora settings (mc particle preparation, track association).
+     *          Each deferred stage runs at most once per event, so algorithms requiring mc or track relationships, whether via lists or
+     *          directly via objects, should call this function before making their first such access.
+     *
+     *  @param  algorithm the algorithm calling this function
+     */
+    static pandora::StatusCode CompleteEventPreparation(const pandora::Algorithm &algorithm);
+
     /**
      *  @brief  Create an algorithm tool instance, via one of the algorithm tool factories registered with pandora.
      *          This function is expected to be called whilst reading the settings for a parent algorithm.
@@ -255,11 +265,27 @@ public:
     static pandora::StatusCode RunClusteringAlgorithm(const pandora::Algorithm &algorithm, const std::string &clusteringAlgorithmName,
         const pandora::ClusterList *&pNewClusterList, std::string &newClusterListName);
 
+    /**
+     *  @brief  Run a read-only task for each index in the range [0, nIndices), distributed over the pandora thread pool. The content
+     *          api is locked until all tasks have completed: any content api or pandora api call made in the meantime, from any thread,
+     *          throws STATUS_CODE_NOT_ALLOWED, so tasks cannot modify the managers and nested calls are refused. Tasks should instead
+     *          receive the lists and services they need before the call, e.g. via a FrozenListView, and record their proposed
+     *          changes for the calling algorithm to apply afterwards.
+     * 
+     *  @param  algorithm the algorithm calling this function
+     *  @param  nIndices the number of indices
+     *  @param  task the task
+     * 
+     *  @return the first failure status code, whether returned or thrown by a task, otherwise STATUS_CODE_SUCCESS
+     */
+    static pandora::StatusCode RunReadOnlyTasks(const pandora::Algorithm &algorithm, const unsigned int nIndices,
+        const pandora::ThreadPool::Task &task);
+
 
     /* List-manipulation functions */
 
     /**
-     *  @brief  Get the current list
+     *  @brief  Get the current list. The address received is subject to the same conditions as for a named list, see GetList
      * 
      *  @param  algorithm the algorithm calling this function
      *  @param  pT to receive the address of the current list
@@ -268,7 +294,7 @@ public:
     static pandora::StatusCode GetCurrentList(const pandora::Algorithm &algorithm, const T *&pT);
 
     /**
-     *  @brief  Get the current list
+     *  @brief  Get the current list. The address received is subject to the same conditions as for a named list, see GetList
      * 
      *  @param  algorithm the algorithm calling this function
      *  @param  pT to receive the address of the current list
@@ -286,6 +312,27 @@ public:
     template <typename T>
     static pandora::StatusCode GetCurrentListName(const pandora::Algorithm &algorithm, std::string &listName);
 
+    /**
+     *  @brief  Get the current list handle
+     * 
+     *  @param  algorithm the algorithm calling this function
+     *  @param  listHandle to receive the current list handle
+     */
+    template <typename T>
+    static pandora::StatusCode GetCurrentListHandle(const pandora::Algorithm &algorithm, pandora::ListHandle &listHandle);
+
+    /**
+     *  @brief  Get the handle for a named list. Handles are compact integers, interned when a list of the specified name is first
+     *          created or saved and valid thereafter for the lifetime of the pandora instance, allowing repeated list access without
+     *          string lookups. Requesting the handle for a name never used for a list returns status code "not found".
+     * 
+     *  @param  algorithm the algorithm calling this function
+     *  @param  listName the name of the list
+     *  @param  listHandle to receive the list handle
+     */
+    template <typename T>
+    static pandora::StatusCode GetListHandle(const pandora::Algorithm &algorithm, const std::string &listName, pandora::ListHandle &listHandle);
+
     /**
      *  @brief  Replace the current list with a pre-saved list; use this new list as a permanent replacement
      *          for the current list (will persist outside the current algorithm)
@@ -296,6 +343,16 @@ public:
     template <typename T>
     static pandora::StatusCode ReplaceCurrentList(const pandora::Algorithm &algorithm, const std::string &newListName);
 
+    /**
+     *  @brief  Replace the current list with a pre-saved list, identified by its list handle; use this new list as a permanent
+     *          replacement for the current list (will persist outside the current algorithm)
+     * 
+     *  @param  algorithm the algorithm calling this function
+     *  @param  newListHandle the handle of the replacement list
+     */
+    template <typename T>
+    static pandora::StatusCode ReplaceCurrentList(const pandora::Algorithm &algorithm, const pandora::ListHandle newListHandle);
+
     /**
      *  @brief  Drop the current list, returning the current list to its default empty/null state
      * 
@@ -305,7 +362,9 @@ public:
     static pandora::StatusCode DropCurrentList(const pandora::Algorithm &algorithm);
 
     /**
-     *  @brief  Get a named list
+     *  @brief  Get a named list. A list saved from the contents of another list may share those contents, with no copy made, in
+     *          which case the address received is that of the shared contents. The address remains valid until the end of the event, but
+     *          reflects the contents of the list only until either list is next modified.
      * 
      *  @param  algorithm the algorithm calling this function
      *  @param  listName the name of the list
@@ -314,6 +373,16 @@ public:
     template <typename T>
     static pandora::StatusCode GetList(const pandora::Algorithm &algorithm, const std::string &listName, const T *&pT);
 
+    /**
+     *  @brief  Get a list, identified by its list handle. The address received is subject to the same conditions as for a named list
+     * 
+     *  @param  algorithm the algorithm calling this function
+     *  @param  listHandle the list handle
+     *  @param  pT to receive the address of the list
+     */
+    template <typename T>
+    static pandora::StatusCode GetList(const pandora::Algorithm &algorithm, const pandora::ListHandle listHandle, const T *&pT);
+
 
     /* List-manipulation functions: input objects only (CaloHits, Tracks, MCParticles) */
 
@@ -386,6 +455,16 @@ public:
     template <typename T>
     static pandora::StatusCode TemporarilyReplaceCurrentList(const pandora::Algorithm &algorithm, const std::string &newListName);
 
+    /**
+     *  @brief  Temporarily replace the current list with another list, identified by its list handle, which may only be a
+     *          temporary list
+     * 
+     *  @param  algorithm the algorithm calling this function
+     *  @param  newListHandle the handle of the replacement list
+     */
+    template <typename T>
+    static pandora::StatusCode TemporarilyReplaceCurrentList(const pandora::Algorithm &algorithm, const pandora::ListHandle newListHandle);
+
     /**
      *  @brief  Create a temporary list and set it to be the current list, enabling object creation
      * 
@@ -492,6 +571,20 @@ public:
         const float fraction1, const pandora::CaloHit *&pDaughterCaloHit1, const pandora::CaloHit *&pDaughterCaloHit2,
         const pandora::ObjectFactory<CaloHitFragment::Parameters, pandora::CaloHit> &factory = pandora::PandoraObjectFactory<CaloHitFragment::Parameters, pandora::CaloHit>());
 
+    /**
+     *  @brief  Fragment a number of calo hits, each into a number of daughter calo hits, with a specified energy division.
+     *          Either all or none of the calo hits will be fragmented.
+     *
+     *  @param  algorithm the algorithm calling this function
+     *  @param  originalCaloHits the original calo hits, which will be deleted
+     *  @param  fractions the fraction of energy to be assigned to each daughter fragment, which must sum to unity
+     *  @param  daughterCaloHits to receive the addresses of the daughter fragments, for each original calo hit in turn
+     *  @param  factory to create the fragmented calo hits
+     */
+    static pandora::StatusCode Fragment(const pandora::Algorithm &algorithm, const pandora::CaloHitVector &originalCaloHits,
+        const pandora::FloatVector &fractions, pandora::CaloHitVector &daughterCaloHits,
+        const pandora::ObjectFactory<CaloHitFragment::Parameters, pandora::CaloHit> &factory = pandora::PandoraObjectFactory<CaloHitFragment::Parameters, pandora::CaloHit>());
+
     /**
      *  @brief  Merge two calo hit fragments, originally from the same parent hit, to form a new calo hit
      *
@@ -577,6 +670,20 @@ public:
     static pandora::StatusCode MergeAndDeleteClusters(const pandora::Algorithm &algorithm, const pandora::Cluster *const pClusterToEnlarge,
         const pandora::Cluster *const pClusterToDelete, const std::string &enlargeListName, const std::string &deleteListName);
 
+    /**
+     *  @brief  Prepare selected plugin-evaluated properties (energy corrections, fast photon flag, shower start layer, shower
+     *          profile) for a list of clusters, using the batch interfaces of the relevant plugins and filling the cluster caches.
+     *          Properties that are already up to date are not recalculated. If the thread pool is used, the plugins must be
+     *          safe for concurrent const calls.
+     * 
+     *  @param  algorithm the algorithm calling this function
+     *  @param  clusterList the list of clusters
+     *  @param  clusterProperties the cluster properties to prepare, a bitwise or of pandora::ClusterProperty values
+     *  @param  useThreadPool whether to divide the clusters into chunks, processed concurrently using the pandora thread pool
+     */
+    static pandora::StatusCode PrepareClusterProperties(const pandora::Algorithm &algorithm, const pandora::ClusterList &clusterList,
+        const unsigned int clusterProperties, const bool useThreadPool = false);
+
 
     /* Pfo-related functions */
 
@@ -101,6 +101,11 @@ private:
      */
     StatusCode RepeatEventPreparation() const;
 
+    /**
+     *  @brief  Complete the event preparation stages deferred by the pandora settings, each of which runs at most once per event
+     */
+    StatusCode CompleteEventPreparation() const;
+
     /**
      *  @brief  Create an algorithm tool instance, via one of the algorithm tool factories registered with pandora.
      *          This function is expected to be called whilst reading the settings for a parent algorithm.
@@ -137,6 +142,14 @@ private:
      StatusCode RunClusteringAlgorithm(const Algorithm &algorithm, const std::string &clusteringAlgorithmName,
         const ClusterList *&pNewClusterList, std::string &newClusterListName) const;
 
+    /**
+     *  @brief  Run a read-only task for each index in the range [0, nIndices), over the pandora thread pool, with the content api locked
+     * 
+     *  @param  nIndices the number of indices
+     *  @param  task the task
+     */
+    StatusCode RunReadOnlyTasks(const unsigned int nIndices, const ThreadPool::Task &task) const;
+
 
     /* List-manipulation functions */
 
@@ -157,6 +170,23 @@ private:
     template <typename T>
     StatusCode GetCurrentListName(std::string &listName) const;
 
+    /**
+     *  @brief  Get the current list handle
+     * 
+     *  @param  listHandle to receive the current list handle
+     */
+    template <typename T>
+    StatusCode GetCurrentListHandle(ListHandle &listHandle) const;
+
+    /**
+     *  @brief  Get the handle for a named list
+     * 
+     *  @param  listName the name of the list
+     *  @param  listHandle to receive the list handle
+     */
+    template <typename T>
+    StatusCode GetListHandle(const std::string &listName, ListHandle &listHandle) const;
+
     /**
      *  @brief  Replace the current list with a pre-saved list; use this new list as a permanent replacement
      *          for the current list (will persist outside the current algorithm)
@@ -167,6 +197,15 @@ private:
     template <typename T>
     StatusCode ReplaceCurrentList(const Algorithm &algorithm, const std::string &newListName) const;
 
+    /**
+     *  @brief  Replace the current list with a pre-saved list, identified by its list handle
+     * 
+     *  @param  algorithm the algorithm calling this function
+     *  @param  newListHandle the handle of the replacement list
+     */
+    template <typename T>
+    StatusCode ReplaceCurrentList(const Algorithm &algorithm, const ListHandle newListHandle) const;
+
     /**
      *  @brief  Drop the current list, returning the current list to its default empty/null state
      * 
@@ -184,6 +223,15 @@ private:
     template <typename T>
     StatusCode GetList(const std::string &listName, const T *&pT) const;
 
+    /**
+     *  @brief  Get a list, identified by its list handle
+     * 
+     *  @param  listHandle the list handle
+     *  @param  pT to receive the address of the list
+     */
+    template <typename T>
+    StatusCode GetList(const ListHandle listHandle, const T *&pT) const;
+
 
     /* List-manipulation functions: input objects only (CaloHits, Tracks, MCParticles) */
 
@@ -249,6 +297,14 @@ private:
     template <typename T>
     StatusCode TemporarilyReplaceCurrentList(const std::string &newListName) const;
 
+    /**
+     *  @brief  Temporarily replace the current list with another list, identified by its list handle
+     * 
+     *  @param  newListHandle the handle of the replacement list
+     */
+    template <typename T>
+    StatusCode TemporarilyReplaceCurrentList(const ListHandle newListHandle) const;
+
     /**
      *  @brief  Create a temporary list and set it to be the current list, enabling object creation
      * 
@@ -344,6 +400,17 @@ private:
     StatusCode Fragment(const CaloHit *const pOriginalCaloHit, const float fraction1, const CaloHit *&pDaughterCaloHit1,
         const CaloHit *&pDaughterCaloHit2, const ObjectFactory<PandoraContentApi::CaloHitFragment::Parameters, CaloHit> &factory) const;
 
+    /**
+     *  @brief  Fragment a number of calo hits, each into a number of daughter calo hits, with a specified energy division
+     *
+     *  @param  originalCaloHits the original calo hits, which will be deleted
+     *  @param  fractions the fraction of energy to be assigned to each daughter fragment, which must sum to unity
+     *  @param  daughterCaloHits to receive the addresses of the daughter fragments, for each original calo hit in turn
+     *  @param  factory to create the fragmented calo hits
+     */
+    StatusCode Fragment(const CaloHitVector &originalCaloHits, const FloatVector &fractions, CaloHitVector &daughterCaloHits,
+        const ObjectFactory<PandoraContentApi::CaloHitFragment::Parameters, CaloHit> &factory) const;
+
     /**
      *  @brief  Merge two calo hit fragments, originally from the same parent hit, to form a new calo hit
      *
@@ -419,6 +486,15 @@ private:
     StatusCode MergeAndDeleteClusters(const Cluster *const pClusterToEnlarge, const Cluster *const pClusterToDelete, const std::string &enlargeListName,
         const std::string &deleteListName) const;
 
+    /**
+     *  @brief  Prepare selected plugin-evaluated properties for a list of clusters, filling the cluster caches
+     * 
+     *  @param  clusterList the list of clusters
+     *  @param  clusterProperties the cluster properties to prepare, a bitwise or of ClusterProperty values
+     *  @param  useThreadPool whether to divide the clusters into chunks, processed concurrently using the pandora thread pool
+     */
+    StatusCode PrepareClusterProperties(const ClusterList &clusterList, const unsigned int clusterProperties, const bool useThreadPool) const;
+
 
     /* Pfo-related functions */
 
@@ -21,14 +21,27 @@ class MCParticleHelper
 {
 public:
     /**
-     *  @brief  Find the mc particle making the largest contribution to a specified calo hit or cluster
+     *  @brief  Find the mc particle making the largest contribution to a specified calo hit, track, cluster or particle flow object.
+     *          Calo hits and tracks cache their main mc particle once per event, when their mc particle weights are set, whilst
+     *          clusters maintain their summed mc particle weights as calo hits are added or removed. Cluster and particle flow
+     *          object queries therefore scale with the number of contributing mc particles, rather than the number of calo hits.
      * 
-     *  @param  pT address of the calo hit or cluster to examine
+     *  @param  pT address of the calo hit, track, cluster or particle flow object to examine
      * 
      *  @return address of the main mc particle
      */
     template <typename T>
     static const MCParticle *GetMainMCParticle(const T *const pT);
+
+private:
+    /**
+     *  @brief  Find the mc particle with the largest weight in a specified mc particle weight map
+     * 
+     *  @param  mcParticleWeightMap the mc particle weight map
+     * 
+     *  @return address of the main mc particle, null if no mc particle has a positive weight
+     */
+    static const MCParticle *GetMainMCParticle(const MCParticleWeightMap &mcParticleWeightMap);
 };
 
 } // namespace pandora
@@ -107,6 +107,13 @@ private:
     SpecificAlgorithmInstanceMap    m_specificAlgorithmInstanceMap;     ///< The specific algorithm instance map
     StringVector                    m_pandoraAlgorithms;                ///< The ordered list of names of top-level algorithms, to be run by pandora
 
+    typedef std::map<std::string, unsigned int> ExceptionCountMap;
+
+    ExceptionCountMap               m_exceptionCountMap;                ///< The number of status code exceptions thrown in the current event, by algorithm name
+#if __cplusplus > 199711L
+    std::atomic<unsigned int>       m_nExceptionsThrown;                ///< The number of status code exceptions thrown whilst running algorithms
+#endif
+
     typedef std::vector<AlgorithmTool*> AlgorithmToolList;
     typedef std::map<const std::string, AlgorithmToolFactory *const> AlgorithmToolFactoryMap;
 
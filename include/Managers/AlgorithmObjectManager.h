@@ -94,6 +94,13 @@ protected:
      */
     virtual StatusCode TemporarilyReplaceCurrentList(const std::string &listName);
 
+    /**
+     *  @brief  Temporarily replace the current list with another list, identified by its interned list handle
+     * 
+     *  @param  listHandle the handle of the new current (and algorithm input) list
+     */
+    virtual StatusCode TemporarilyReplaceCurrentList(const ListHandle listHandle);
+
     /**
      *  @brief  Delete an object from a specified list
      * 
@@ -140,6 +147,7 @@ protected:
      *  @param  listName the name of the new current (and algorithm input) list
      */
     virtual StatusCode ReplaceCurrentAndAlgorithmInputLists(const Algorithm *const pAlgorithm, const std::string &listName);
+    using Manager<T>::ReplaceCurrentAndAlgorithmInputLists;
 
     /**
      *  @brief  Drop the current list, returning the current list to its default empty/null state
@@ -86,11 +86,58 @@ private:
      */
     StatusCode CreateTemporaryListAndSetCurrent(const Algorithm *const pAlgorithm, const ClusterList &clusterList, std::string &temporaryListName);
 
+    /**
+     *  @brief  Change the current calo hit list to a temporary list holding a specified list of calo hits, recording the list
+     *          membership of each calo hit
+     * 
+     *  @param  pAlgorithm address of the algorithm changing the current calo hit list
+     *  @param  caloHitList the calo hit list
+     *  @param  temporaryListName to receive the name of the temporary list
+     */
+    StatusCode CreateTemporaryListAndSetCurrent(const Algorithm *const pAlgorithm, const CaloHitList &caloHitList, std::string &temporaryListName);
+
+    /**
+     *  @brief  Save a list of calo hits as a new list with a specified name, recording the list membership of each calo hit
+     * 
+     *  @param  listName the name of the new list
+     *  @param  caloHitList the calo hit list
+     */
+    StatusCode SaveList(const std::string &listName, const CaloHitList &caloHitList);
+
+    /**
+     *  @brief  Add a list of calo hits to a saved list, recording the list membership of each calo hit
+     * 
+     *  @param  listName the name of the saved list
+     *  @param  caloHitList the calo hit list
+     */
+    StatusCode AddObjectsToList(const std::string &listName, const CaloHitList &caloHitList);
+
     /**
      *  @brief  Erase all calo hit manager content
      */
     StatusCode EraseAllContent();
 
+    /**
+     *  @brief  Reset the manager for the next event, ending any sliding window
+     */
+    StatusCode ResetForNextEvent();
+
+    /**
+     *  @brief  Reset the manager for the next time slice of continuous readout, retaining the calo hits with times at or after the
+     *          start of the sliding window. The retained calo hits are made available, lose their mc particle associations and form
+     *          the initial content of the input list. Calo hits created subsequently are also added to the new input list.
+     *
+     *  @param  windowStartTime the start time of the sliding window
+     */
+    StatusCode ResetForNextWindow(const float windowStartTime);
+
+    /**
+     *  @brief  Reserve capacity in the input list and the calo hit list membership records for a specified number of calo hits
+     *
+     *  @param  nObjects the number of calo hits
+     */
+    void ReserveEventCapacity(const unsigned int nObjects);
+
     /**
      *  @brief  Match calo hits to their correct mc particles for particle flow
      * 
@@ -126,6 +173,18 @@ private:
     StatusCode MergeCaloHitFragments(const CaloHit *const pFragmentCaloHit1, const CaloHit *const pFragmentCaloHit2,
         const CaloHit *&pMergedCaloHit, const ObjectFactory<PandoraContentApi::CaloHitFragment::Parameters, CaloHit> &factory);
 
+    /**
+     *  @brief  Fragment a number of calo hits, each into a number of daughter calo hits, with a specified energy division. All the
+     *          original calo hits are validated before any fragments are created, so that either all or none are fragmented.
+     *
+     *  @param  originalCaloHits the original calo hits, which will be deleted
+     *  @param  fractions the fraction of energy to be assigned to each daughter fragment, which must sum to unity
+     *  @param  daughterCaloHits to receive the addresses of the daughter fragments, for each original calo hit in turn
+     *  @param  factory to create the calo hit fragments
+     */
+    StatusCode FragmentCaloHits(const CaloHitVector &originalCaloHits, const FloatVector &fractions, CaloHitVector &daughterCaloHits,
+        const ObjectFactory<PandoraContentApi::CaloHitFragment::Parameters, CaloHit> &factory);
+
     /**
      *  @brief  Whether a calo hit can be fragmented into two daughter calo hits with the specified energy division
      * 
@@ -136,6 +195,16 @@ private:
      */
     bool CanFragmentCaloHit(const CaloHit *const pOriginalCaloHit, const float fraction1) const;
 
+    /**
+     *  @brief  Whether a calo hit can be fragmented into a number of daughter calo hits with the specified energy division
+     * 
+     *  @param  pOriginalCaloHit address of the original calo hit
+     *  @param  fractions the fraction of energy to be assigned to each daughter fragment
+     * 
+     *  @return boolean
+     */
+    bool CanFragmentCaloHit(const CaloHit *const pOriginalCaloHit, const FloatVector &fractions) const;
+
     /**
      *  @brief  Whether two candidate calo hit fragments can be merged
      * 
@@ -176,8 +245,9 @@ private:
      *  @brief  Update all calo hit lists to account for changes by daughter recluster processes
      * 
      *  @param  caloHitMetadata description of the changes made by daughter reclustering processes
+     *  @param  initialCaloHitList the calo hit list provided as input to the daughter reclustering processes
      */
-    StatusCode Update(const CaloHitMetadata &caloHitMetadata);
+    StatusCode Update(const CaloHitMetadata &caloHitMetadata, const CaloHitList &initialCaloHitList);
 
     /**
      *  @brief  Update all calo hit lists to account for a specific calo hit replacement
@@ -194,9 +264,94 @@ private:
      */
     StatusCode Update(CaloHitList *const pCaloHitList, const CaloHitReplacement &caloHitReplacement);
 
+    /**
+     *  @brief  Apply a calo hit replacement to the current reclustering metadata or, if not reclustering, to all calo hit lists
+     * 
+     *  @param  caloHitReplacement the calo hit replacement
+     */
+    StatusCode ApplyReplacement(const CaloHitReplacement &caloHitReplacement);
+
+    /**
+     *  @brief  Give a new list its own copy of any calo hits it shares with another list, if reclustering is in progress. The lists
+     *          held by the recluster metadata are modified directly, so must not share their contents with other lists.
+     * 
+     *  @param  listName the name of the new list
+     */
+    void UnshareListIfReclustering(const std::string &listName);
+
+    /**
+     *  @brief  Record that a list of calo hits has been added to a named list
+     * 
+     *  @param  caloHitList the calo hit list
+     *  @param  listName the name of the list to which the calo hits have been added
+     */
+    void RecordListMembership(const CaloHitList &caloHitList, const std::string &listName);
+
+    /**
+     *  @brief  Record that a calo hit has been added to the list with a specified handle
+     * 
+     *  @param  pCaloHit address of the calo hit
+     *  @param  listHandle the list handle
+     */
+    void RecordListMembership(const CaloHit *const pCaloHit, const ListHandle listHandle);
+
+    /**
+     *  @brief  If the named list was created sharing the contents of another managed list, record that it inherits the membership
+     *          records of that list, rather than recording the membership of each calo hit
+     * 
+     *  @param  caloHitList the calo hit list from which the named list was created
+     *  @param  listName the list name
+     * 
+     *  @return whether the membership has been recorded
+     */
+    bool RecordSharedListMembership(const CaloHitList &caloHitList, const std::string &listName);
+
+    /**
+     *  @brief  Whether a calo hit list contains any of a number of candidate calo hits
+     * 
+     *  @param  caloHitList the calo hit list
+     *  @param  candidateCaloHits the candidate calo hits
+     * 
+     *  @return boolean
+     */
+    bool ContainsAnyCaloHit(const CaloHitList &caloHitList, const CaloHitList &candidateCaloHits) const;
+
+    /**
+     *  @brief  Assign the next dense per-event calo hit index to a newly created calo hit
+     * 
+     *  @param  pCaloHit address of the calo hit
+     */
+    void AssignCaloHitIndex(const CaloHit *const pCaloHit);
+
+    /**
+     *  @brief  Match a contiguous range of calo hits to their correct mc particles for particle flow
+     * 
+     *  @param  caloHitToPfoTargetsMap the calo hit uid to mc pfo target map
+     *  @param  caloHitVector the vector of calo hits
+     *  @param  beginIndex the index of the first calo hit in the range
+     *  @param  endIndex the index one past the last calo hit in the range
+     */
+    void MatchCaloHitRangeToMCPfoTargets(const UidToMCParticleWeightMap &caloHitToPfoTargetsMap, const CaloHitVector &caloHitVector,
+        const unsigned int beginIndex, const unsigned int endIndex) const;
+
+    class MCPfoTargetMatchingTask;
+
+    typedef std::vector<ListHandleVector> ListHandleVectorVector;
+
+    static const float              FRAGMENT_FRACTION_TOLERANCE;        ///< The tolerance on the sum of fragment energy fractions
+    static const unsigned int       N_HITS_PER_MATCHING_TASK;           ///< The minimum number of calo hits to match to mc particles per thread pool task
+    static const std::string        NEW_INPUT_LIST_NAME;                ///< The name of the list holding the calo hits created in a sliding window
+
+    unsigned int                    m_nCaloHitIndices;                  ///< The number of calo hit indices assigned in the current event
+    ListHandleVectorVector          m_caloHitListHandles;               ///< The handles of the lists that (may) contain each calo hit, by calo hit index
+    ListHandleVectorVector          m_sharingListHandles;               ///< The handles of the lists inheriting the membership records of each list
     unsigned int                    m_nReclusteringProcesses;           ///< The number of reclustering algorithms currently in operation
+    unsigned int                    m_maxNReclusteringProcesses;        ///< The maximum number of simultaneous reclustering algorithms in the current event
+    unsigned int                    m_nFragmentedCaloHits;              ///< The number of calo hits fragmented in the current event
+    unsigned int                    m_nMergedCaloHitFragments;          ///< The number of calo hit fragment merges in the current event
     ReclusterMetadata              *m_pCurrentReclusterMetadata;        ///< Address of the current recluster metadata
     ReclusterMetadataList           m_reclusterMetadataList;            ///< The recluster metadata list
+    bool                            m_isSlidingWindowActive;            ///< Whether a sliding window is active, with new calo hits recorded separately
 
     friend class PandoraApiImpl;
     friend class PandoraContentApiImpl;
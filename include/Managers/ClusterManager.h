@@ -152,6 +152,43 @@ private:
      */
     StatusCode RemoveTrackAssociations(const TrackToClusterMap &trackToClusterList) const;
 
+    /**
+     *  @brief  Recalculate the mc particle weight maps of all clusters, required if calo hit mc particle weights have been
+     *          assigned after the clusters were created
+     */
+    void ResetMCParticleWeights() const;
+
+    typedef std::map<std::string, ClusterList> NameToClusterListMap;
+
+    /**
+     *  @brief  Select the clusters in saved lists that consist solely of calo hits with times at or after the start of the sliding
+     *          window, removing them from their lists so that they survive the reset. The selected clusters are made available and
+     *          released from their track associations and track seeds. Must be called whilst all the calo hits still exist.
+     *
+     *  @param  windowStartTime the start time of the sliding window
+     *  @param  windowClusterListMap to receive the selected clusters, keyed by the names of the saved lists that held them
+     */
+    StatusCode SelectClustersForNextWindow(const float windowStartTime, NameToClusterListMap &windowClusterListMap);
+
+    /**
+     *  @brief  Reset the manager for the next time slice of continuous readout, restoring the selected clusters to saved lists of
+     *          the same names
+     *
+     *  @param  windowClusterListMap the clusters selected for the next window, keyed by list name
+     *  @param  retainedClusterList to receive the list of retained clusters
+     */
+    StatusCode ResetForNextWindow(const NameToClusterListMap &windowClusterListMap, ClusterList &retainedClusterList);
+
+    /**
+     *  @brief  Whether all the calo hits in a cluster lie within a sliding window, with times at or after the window start time
+     *
+     *  @param  pCluster address of the cluster
+     *  @param  windowStartTime the start time of the sliding window
+     *
+     *  @return boolean
+     */
+    bool IsWithinWindow(const Cluster *const pCluster, const float windowStartTime) const;
+
     friend class PandoraContentApiImpl;
     friend class PandoraImpl;
 };
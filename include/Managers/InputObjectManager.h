@@ -86,7 +86,42 @@ protected:
      */
     virtual StatusCode CreateInitialLists();
 
+    /**
+     *  @brief  Set the expected number of input objects per event, used to pre-reserve the input list and per-object containers
+     *
+     *  @param  nObjects the expected number of input objects per event, zero to rely only upon the running estimate
+     */
+    StatusCode SetEventSizeHint(const unsigned int nObjects);
+
+    /**
+     *  @brief  Set whether to retain the capacity of the input list when the manager content is erased, for reuse in the next event
+     *
+     *  @param  shouldRetainCapacity whether to retain the input list capacity
+     */
+    void SetShouldRetainCapacity(const bool shouldRetainCapacity);
+
+    /**
+     *  @brief  Get the expected number of input objects per event: the larger of the client hint and the running estimate, which
+     *          follows the largest recent events and decays by half per event
+     *
+     *  @return the expected number of input objects per event
+     */
+    unsigned int GetExpectedEventSize() const;
+
+    /**
+     *  @brief  Reserve capacity in the input list, and any per-object containers, for a specified number of input objects
+     *
+     *  @param  nObjects the number of input objects
+     */
+    virtual void ReserveEventCapacity(const unsigned int nObjects);
+
     static const std::string        INPUT_LIST_NAME;                    ///< The name of the input list
+
+private:
+    unsigned int                    m_eventSizeHint;                    ///< The client hint for the number of input objects per event
+    unsigned int                    m_eventSizeEstimate;                ///< The running estimate of the number of input objects per event
+    bool                            m_shouldRetainCapacity;             ///< Whether to retain the input list capacity between events
+    ObjectList                      m_retainedInputList;                ///< Empty list holding the retained input list capacity
 };
 
 } // namespace pandora
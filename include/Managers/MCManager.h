@@ -51,6 +51,13 @@ private:
      */
     StatusCode EraseAllContent();
 
+    /**
+     *  @brief  Reserve capacity in the input list and the uid to mc particle map for a specified number of mc particles
+     *
+     *  @param  nObjects the number of mc particles
+     */
+    void ReserveEventCapacity(const unsigned int nObjects);
+
     /**
      *  @brief  Set mc particle relationship
      * 
@@ -136,8 +143,8 @@ private:
     StatusCode RemoveMCParticleRelationships(const MCParticle *const pMCParticle) const;
 
     typedef std::map<Uid, float> UidToWeightMap;
-    typedef std::map<Uid, UidToWeightMap> ObjectRelationMap;
-    typedef std::multimap<Uid, Uid> MCParticleRelationMap;
+    typedef std::LOOKUP_CONTAINER<Uid, UidToWeightMap> ObjectRelationMap;
+    typedef std::vector<std::pair<Uid, Uid> > MCParticleRelationVector;
 
     /**
      *  @brief  Set an object (e.g. calo hit or track) to mc particle relationship
@@ -159,7 +166,7 @@ private:
     StatusCode CreateUidToPfoTargetsMap(UidToMCParticleWeightMap &uidToMCParticleWeightMap, const ObjectRelationMap &objectRelationMap) const;
 
     UidToMCParticleMap              m_uidToMCParticleMap;               ///< The uid to mc particle map
-    MCParticleRelationMap           m_parentDaughterRelationMap;        ///< The mc particle parent-daughter relation map
+    MCParticleRelationVector        m_parentDaughterRelationVector;     ///< The registered mc particle parent-daughter uid pairs
     ObjectRelationMap               m_caloHitToMCParticleMap;           ///< The calo hit to mc particle relation map
     ObjectRelationMap               m_trackToMCParticleMap;             ///< The track to mc particle relation map
 
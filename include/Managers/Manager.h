@@ -15,6 +15,7 @@ namespace pandora
 {
 
 class Algorithm;
+class ObjectResourceReport;
 class Pandora;
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -42,13 +43,23 @@ protected:
     typedef std::MANAGED_CONTAINER<const T *> ObjectList;
 
     /**
-     *  @brief  Get a list
+     *  @brief  Get a list. The address received for a list sharing the contents of another list is that of the shared contents, with
+     *          no copy made. Such an address remains valid until the end of the event, but reflects the contents of the list only until
+     *          either list is next modified via GetModifiableList.
      * 
      *  @param  listName the name of the list
      *  @param  pObjectList to receive the list
      */
     virtual StatusCode GetList(const std::string &listName, const ObjectList *&pObjectList) const;
 
+    /**
+     *  @brief  Get a list, via its interned list handle
+     * 
+     *  @param  listHandle the list handle
+     *  @param  pObjectList to receive the list
+     */
+    virtual StatusCode GetList(const ListHandle listHandle, const ObjectList *&pObjectList) const;
+
     /**
      *  @brief  Get the current list
      * 
@@ -57,6 +68,31 @@ protected:
      */
     virtual StatusCode GetCurrentList(const ObjectList *&pObjectList, std::string &listName) const;
 
+    /**
+     *  @brief  Find the handle for a named list, without interning the name. Names are interned only when lists are created or saved,
+     *          after which the handle remains valid for the lifetime of the manager, including across events, whether or not a list
+     *          with the specified name currently exists.
+     * 
+     *  @param  listName the name of the list
+     *  @param  listHandle to receive the list handle
+     */
+    virtual StatusCode FindListHandle(const std::string &listName, ListHandle &listHandle) const;
+
+    /**
+     *  @brief  Get the name of the list associated with a specified handle
+     * 
+     *  @param  listHandle the list handle
+     *  @param  listName to receive the name of the list
+     */
+    virtual StatusCode GetListName(const ListHandle listHandle, std::string &listName) const;
+
+    /**
+     *  @brief  Get the handle for the current list
+     * 
+     *  @param  listHandle to receive the handle for the current list
+     */
+    virtual StatusCode GetCurrentListHandle(ListHandle &listHandle) const;
+
     /**
      *  @brief  Get the current list name
      * 
@@ -96,6 +132,14 @@ protected:
      */
     virtual StatusCode ReplaceCurrentAndAlgorithmInputLists(const Algorithm *const pAlgorithm, const std::string &listName);
 
+    /**
+     *  @brief  Replace the current and algorithm input lists with a pre-existing list, specified via its interned list handle
+     *
+     *  @param  pAlgorithm address of the algorithm changing the current list
+     *  @param  listHandle the handle of the new current (and algorithm input) list
+     */
+    virtual StatusCode ReplaceCurrentAndAlgorithmInputLists(const Algorithm *const pAlgorithm, const ListHandle listHandle);
+
     /**
      *  @brief  Drop the current list, returning the current list to its default empty/null state
      * 
@@ -141,6 +185,90 @@ protected:
      */
     virtual StatusCode CreateInitialLists();
 
+    /**
+     *  @brief  Create a new, empty list with a specified name
+     * 
+     *  @param  listName the name of the list
+     *  @param  pObjectList to receive the address of the new list
+     */
+    StatusCode CreateList(const std::string &listName, ObjectList *&pObjectList);
+
+    /**
+     *  @brief  Create a new list with a specified name, holding the objects in a specified list. If the specified list is itself
+     *          held by the manager, the new list shares its contents, in O(1), until either list is modified via GetModifiableList.
+     *          The list modified keeps the shared contents if it was the source of the sharing, otherwise it receives its own copy.
+     * 
+     *  @param  listName the name of the list
+     *  @param  objectList the list of objects
+     */
+    StatusCode CreateList(const std::string &listName, const ObjectList &objectList);
+
+    /**
+     *  @brief  Create a temporary list associated with a particular algorithm, holding the objects in a specified list
+     *
+     *  @param  pAlgorithm address of the algorithm
+     *  @param  objectList the list of objects
+     *  @param  temporaryListName to receive the name of the temporary list
+     */
+    StatusCode CreateTemporaryList(const Algorithm *const pAlgorithm, const ObjectList &objectList, std::string &temporaryListName);
+
+    /**
+     *  @brief  Get a list in order to modify its contents. Any sharing of contents between this list and other lists is ended first.
+     * 
+     *  @param  listName the name of the list
+     *  @param  pObjectList to receive the list
+     */
+    StatusCode GetModifiableList(const std::string &listName, ObjectList *&pObjectList);
+
+    /**
+     *  @brief  Erase a list, deleting the list (but not the objects it contains)
+     * 
+     *  @param  listName the name of the list
+     */
+    StatusCode EraseList(const std::string &listName);
+
+    /**
+     *  @brief  Set the current list name, keeping the current list handle consistent
+     * 
+     *  @param  listName the name of the new current list
+     */
+    void SetCurrentListName(const std::string &listName);
+
+    /**
+     *  @brief  Give a list that shares the contents of another list its own copy of the contents
+     * 
+     *  @param  listName the name of the list
+     */
+    StatusCode UnshareList(const std::string &listName);
+
+    /**
+     *  @brief  Get the handle for a named list, interning the name if required. To be used only when creating or saving lists.
+     * 
+     *  @param  listName the name of the list
+     * 
+     *  @return the list handle
+     */
+    ListHandle InternListHandle(const std::string &listName);
+
+    /**
+     *  @brief  Record the creation of an object in the current event
+     */
+    void RecordObjectCreation();
+
+    /**
+     *  @brief  Record the deletion of objects in the current event, prior to the event reset
+     * 
+     *  @param  nObjects the number of objects deleted
+     */
+    void RecordObjectDeletions(const unsigned int nObjects);
+
+    /**
+     *  @brief  Get the resource report describing the objects and named lists held by the manager in the current event
+     * 
+     *  @param  objectResourceReport to receive the object resource report
+     */
+    void GetResourceReport(ObjectResourceReport &objectResourceReport) const;
+
     /**
      *  @brief  Access a modifiable object, when provided with address to const object
      * 
@@ -158,17 +286,34 @@ protected:
     public:
         std::string                 m_parentListName;                   ///< The current list when algorithm was initialized
         StringSet                   m_temporaryListNames;               ///< The temporary list names
-        unsigned int                m_numberOfListsCreated;             ///< The number of lists created by the algorithm
     };
 
     typedef std::map<std::string, ObjectList *> NameToListMap;
     typedef std::map<const Algorithm *, AlgorithmInfo> AlgorithmInfoMap;
+    typedef std::map<std::string, ListHandle> NameToHandleMap;
+    typedef std::vector<ObjectList *> HandleToListVector;
+    typedef std::vector<ObjectList *> ObjectListVector;
+    typedef std::set<const ObjectList *> ObjectListSet;
 
     NameToListMap                   m_nameToListMap;                    ///< The name to list map
     AlgorithmInfoMap                m_algorithmInfoMap;                 ///< The algorithm info map
 
+    NameToHandleMap                 m_nameToHandleMap;                  ///< The interned list name to list handle map, persisting across events
+    StringVector                    m_handleToNameVector;               ///< The interned list names, indexed by list handle
+    HandleToListVector              m_handleToListVector;               ///< The addresses of the lists, indexed by list handle, null if not present
+    ListHandleVector                m_temporaryListHandles;             ///< The handles of the temporary list names, indexed by creation order
+    unsigned int                    m_nTemporaryListsCreated;           ///< The number of temporary lists created in the current event
+
     std::string                     m_currentListName;                  ///< The name of the current list
+    ListHandle                      m_currentListHandle;                ///< The handle of the current list
     StringSet                       m_savedLists;                       ///< The set of saved lists
+    StringSet                       m_sharedListNames;                  ///< The names of lists sharing the contents held by another list
+    ObjectListSet                   m_managedLists;                     ///< The addresses of the contents held by the named lists
+    ObjectListSet                   m_unsharedLists;                    ///< The addresses of contents once shared by lists since given their own copy
+    ObjectListVector                m_retiredLists;                     ///< The addresses of erased contents, still held until the end of the event
+    unsigned int                    m_nObjectsCreated;                  ///< The number of objects created in the current event
+    unsigned int                    m_nObjectsDeleted;                  ///< The number of objects deleted in the current event
+    unsigned int                    m_peakNLiveObjects;                 ///< The peak number of live objects in the current event
     static const std::string        NULL_LIST_NAME;                     ///< The name of the default empty (NULL) list
 
     const Pandora *const            m_pPandora;                         ///< The associated pandora object
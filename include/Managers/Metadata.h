@@ -27,7 +27,57 @@ public:
 };
 
 typedef std::vector<CaloHitReplacement *> CaloHitReplacementList;
-typedef std::map<const CaloHit *, bool> CaloHitUsageMap;
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+/**
+ *  @brief  CaloHitBitSet class, a dense set of calo hits, addressed via the per-event calo hit indices assigned by the calo hit manager
+ */
+class CaloHitBitSet
+{
+public:
+    /**
+     *  @brief  Whether the calo hit with a specified index is in the set
+     * 
+     *  @param  index the calo hit index
+     * 
+     *  @return boolean
+     */
+    bool Test(const unsigned int index) const;
+
+    /**
+     *  @brief  Add the calo hit with a specified index to, or remove it from, the set
+     * 
+     *  @param  index the calo hit index
+     *  @param  value whether the calo hit should be in the set
+     */
+    void Set(const unsigned int index, const bool value);
+
+    /**
+     *  @brief  Whether all calo hits in this set are also present in another set
+     * 
+     *  @param  rhs the other set
+     * 
+     *  @return boolean
+     */
+    bool IsSubsetOf(const CaloHitBitSet &rhs) const;
+
+    /**
+     *  @brief  Overwrite the contents of this set for all calo hits in a mask, taking values from another set
+     * 
+     *  @param  mask the set of calo hits to overwrite
+     *  @param  values the set providing the new values, which must be a subset of the mask
+     */
+    void Overwrite(const CaloHitBitSet &mask, const CaloHitBitSet &values);
+
+private:
+    typedef std::vector<uint64_t> WordVector;
+
+    static const unsigned int   N_BITS_PER_WORD = 64;           ///< The number of bits in each word
+
+    WordVector                  m_words;                        ///< The words holding the bits
+};
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -43,9 +93,11 @@ public:
      * 
      *  @param  pCaloHitList address of the associated calo hit list
      *  @param  caloHitListName name of the associated calo hit list
+     *  @param  pInitialHitSet address of the set of calo hits in the list, shared (and only copied when modified) by each metadata
      *  @param  initialHitAvailability the initial availability of the calo hits
      */
-    CaloHitMetadata(CaloHitList *const pCaloHitList, const std::string &caloHitListName, const bool initialHitAvailability);
+    CaloHitMetadata(CaloHitList *const pCaloHitList, const std::string &caloHitListName, const CaloHitBitSet *const pInitialHitSet,
+        const bool initialHitAvailability);
 
     /**
      *  @brief  Destructor
@@ -90,13 +142,6 @@ public:
      */
     void Clear();
 
-    /**
-     *  @brief  Get the calo hit usage map
-     * 
-     *  @return the calo hit usage map
-     */
-    const CaloHitUsageMap &GetCaloHitUsageMap() const;
-
     /**
      *  @brief  Get the calo hit replacement list
      * 
@@ -105,9 +150,40 @@ public:
     const CaloHitReplacementList &GetCaloHitReplacementList() const;
 
 private:
+    /**
+     *  @brief  Get the set of calo hits in the associated list
+     * 
+     *  @return the set of calo hits
+     */
+    const CaloHitBitSet &GetHitSet() const;
+
+    /**
+     *  @brief  Get the set of available calo hits
+     * 
+     *  @return the set of available calo hits
+     */
+    const CaloHitBitSet &GetAvailableHitSet() const;
+
+    /**
+     *  @brief  Get a modifiable set of calo hits in the associated list, taking a private copy of any shared set
+     * 
+     *  @return the modifiable set of calo hits
+     */
+    CaloHitBitSet &GetModifiableHitSet();
+
+    /**
+     *  @brief  Get a modifiable set of available calo hits, taking a private copy of any shared set
+     * 
+     *  @return the modifiable set of available calo hits
+     */
+    CaloHitBitSet &GetModifiableAvailableHitSet();
+
     CaloHitList                *m_pCaloHitList;                     ///< Address of the associated calo hit list
     std::string                 m_caloHitListName;                  ///< The name of the associated calo hit list
-    CaloHitUsageMap             m_caloHitUsageMap;                  ///< The calo hit usage map
+    const CaloHitBitSet        *m_pSharedHitSet;                    ///< Address of the shared set of calo hits, null once privately copied
+    const CaloHitBitSet        *m_pSharedAvailableHitSet;           ///< Address of the shared set of available hits, null once privately copied
+    CaloHitBitSet               m_hitSet;                           ///< The private set of calo hits in the associated list
+    CaloHitBitSet               m_availableHitSet;                  ///< The private set of available calo hits
     CaloHitReplacementList      m_caloHitReplacementList;           ///< The calo hit replacement list
 };
 
@@ -165,11 +241,19 @@ public:
      */
     CaloHitMetadata *GetCurrentCaloHitMetadata();
 
+    /**
+     *  @brief  Get the number of replacement calo hits held by the calo hit metadata, which will be deleted with the recluster metadata
+     * 
+     *  @return the number of replacement calo hits
+     */
+    unsigned int GetNReplacementCaloHits() const;
+
 private:
     typedef std::map<std::string, CaloHitMetadata *> NameToMetadataMap;
 
     CaloHitMetadata            *m_pCurrentCaloHitMetadata;          ///< Address of the current calo hit metadata
     CaloHitList                 m_caloHitList;                      ///< Copy of the reclustering input calo hit list
+    CaloHitBitSet               m_caloHitSet;                       ///< The set of input calo hits, shared by each calo hit metadata
     NameToMetadataMap           m_nameToMetadataMap;                ///< The recluster list name to metadata map
 };
 
@@ -178,18 +262,64 @@ typedef std::vector<ReclusterMetadata *> ReclusterMetadataList;
 //------------------------------------------------------------------------------------------------------------------------------------------
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-inline const CaloHitUsageMap &CaloHitMetadata::GetCaloHitUsageMap() const
+inline bool CaloHitBitSet::Test(const unsigned int index) const
 {
-    return m_caloHitUsageMap;
+    const unsigned int wordIndex(index / N_BITS_PER_WORD);
+
+    if (wordIndex >= m_words.size())
+        return false;
+
+    return (0 != (m_words[wordIndex] & (static_cast<uint64_t>(1) << (index % N_BITS_PER_WORD))));
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+inline void CaloHitBitSet::Set(const unsigned int index, const bool value)
+{
+    const unsigned int wordIndex(index / N_BITS_PER_WORD);
+
+    if (wordIndex >= m_words.size())
+    {
+        if (!value)
+            return;
+
+        m_words.resize(wordIndex + 1, 0);
+    }
+
+    const uint64_t bit(static_cast<uint64_t>(1) << (index % N_BITS_PER_WORD));
+
+    if (value)
+    {
+        m_words[wordIndex] |= bit;
+    }
+    else
+    {
+        m_words[wordIndex] &= ~bit;
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 inline const CaloHitReplacementList &CaloHitMetadata::GetCaloHitReplacementList() const
 {
     return m_caloHitReplacementList;
 }
 
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline const CaloHitBitSet &CaloHitMetadata::GetHitSet() const
+{
+    return ((NULL != m_pSharedHitSet) ? *m_pSharedHitSet : m_hitSet);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline const CaloHitBitSet &CaloHitMetadata::GetAvailableHitSet() const
+{
+    return ((NULL != m_pSharedAvailableHitSet) ? *m_pSharedAvailableHitSet : m_availableHitSet);
+}
+
 //------------------------------------------------------------------------------------------------------------------------------------------
 //------------------------------------------------------------------------------------------------------------------------------------------
 
@@ -88,6 +88,24 @@ private:
      */
     StatusCode RemoveParentDaughterAssociation(const ParticleFlowObject *const pParentPfo, const ParticleFlowObject *const pDaughterPfo) const;
 
+    /**
+     *  @brief  Take ownership of a list of particle flow objects, released by the manager of another pandora instance, and add them
+     *          to a list with a specified name; create new list if required
+     *
+     *  @param  listName the name of the list to receive the particle flow objects
+     *  @param  pfoList the list of particle flow objects to adopt
+     */
+    StatusCode AdoptObjects(const std::string &listName, const PfoList &pfoList);
+
+    /**
+     *  @brief  Give up ownership of a list of particle flow objects, removing them from all lists without deleting them, so that
+     *          they can be adopted by the manager of another pandora instance. Any parent-daughter relationships with particle
+     *          flow objects outside the list are removed.
+     *
+     *  @param  pfoList the list of particle flow objects to release
+     */
+    StatusCode ReleaseObjects(const PfoList &pfoList);
+
     friend class PandoraApiImpl;
     friend class PandoraContentApiImpl;
     friend class PandoraImpl;
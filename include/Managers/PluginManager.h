@@ -15,6 +15,7 @@ namespace pandora
 
 class BFieldPlugin;
 class PseudoLayerPlugin;
+class RegionPartitionPlugin;
 class ShowerProfilePlugin;
 
 class EnergyCorrections;
@@ -64,6 +65,13 @@ public:
      */
     const ShowerProfilePlugin *GetShowerProfilePlugin() const;
 
+    /**
+     *  @brief  Get the region partition plugin
+     * 
+     *  @return address of the region partition plugin
+     */
+    const RegionPartitionPlugin *GetRegionPartitionPlugin() const;
+
     /**
      *  @brief  Get the pandora energy corrections instance
      * 
@@ -100,6 +108,13 @@ private:
      */
     StatusCode SetShowerProfilePlugin(ShowerProfilePlugin *const pShowerProfilePlugin);
 
+    /**
+     *  @brief  Set the region partition plugin
+     * 
+     *  @param  pRegionPartitionPlugin address of the region partition plugin
+     */
+    StatusCode SetRegionPartitionPlugin(RegionPartitionPlugin *const pRegionPartitionPlugin);
+
     /**
      *  @brief  Initialize plugins
      * 
@@ -110,6 +125,7 @@ private:
     BFieldPlugin                   *m_pBFieldPlugin;                    ///< Address of the bfield plugin
     PseudoLayerPlugin              *m_pPseudoLayerPlugin;               ///< Address of the pseudolayer plugin
     ShowerProfilePlugin            *m_pShowerProfilePlugin;             ///< The shower profile plugin
+    RegionPartitionPlugin          *m_pRegionPartitionPlugin;           ///< The region partition plugin
 
     EnergyCorrections              *m_pEnergyCorrections;               ///< The energy corrections
     ParticleId                     *m_pParticleId;                      ///< The particle id
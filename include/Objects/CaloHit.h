@@ -202,6 +202,13 @@ public:
      */
     const MCParticleWeightMap &GetMCParticleWeightMap() const;
 
+    /**
+     *  @brief  Get address of the mc particle making the largest contribution to the calo hit
+     * 
+     *  @return address of the main mc particle
+     */
+    const MCParticle *GetMainMCParticle() const;
+
     /**
      *  @brief  Get the address of the parent calo hit in the user framework
      */
@@ -295,7 +302,39 @@ protected:
      */
     void SetAvailability(bool isAvailable);
 
+    /**
+     *  @brief  Get the dense per-event index of the calo hit, used to address calo hit availability during reclustering
+     * 
+     *  @return the calo hit index
+     */
+    unsigned int GetCaloHitIndex() const;
+
+    /**
+     *  @brief  Set the dense per-event index of the calo hit
+     * 
+     *  @param  caloHitIndex the calo hit index
+     */
+    void SetCaloHitIndex(const unsigned int caloHitIndex);
+
+    // ATTN: Members are ordered so that the properties read in typical per-hit loops (position, energies, layers, availability)
+    // share the leading cache line of the object; geometry, material and mc information follow
     const CartesianVector   m_positionVector;           ///< Position vector of center of calorimeter cell, units mm
+    const float             m_inputEnergy;              ///< Corrected energy of calorimeter cell in user framework, units GeV
+    const float             m_mipEquivalentEnergy;      ///< The calibrated mip equivalent energy, units mip
+    const float             m_electromagneticEnergy;    ///< The calibrated electromagnetic energy measure, units GeV
+    const float             m_hadronicEnergy;           ///< The calibrated hadronic energy measure, units GeV
+    float                   m_weight;                   ///< The calo hit weight, which may not be unity if the hit has been fragmented
+    unsigned int            m_pseudoLayer;              ///< The pseudo layer to which the calo hit has been assigned
+    const unsigned int      m_layer;                    ///< The subdetector readout layer number
+    const HitType           m_hitType;                  ///< The type of calorimeter hit
+    const HitRegion         m_hitRegion;                ///< Region of the detector in which the calo hit is located
+    unsigned int            m_caloHitIndex;             ///< The dense per-event index of the calo hit, assigned by the calo hit manager
+    bool                    m_isAvailable;              ///< Whether the calo hit is available to be added to a cluster
+    bool                    m_isPossibleMip;            ///< Whether the calo hit is a possible mip hit
+    bool                    m_isIsolated;               ///< Whether the calo hit is isolated
+    bool                    m_isPseudoLayerSet;         ///< Whether the pseudo layer has been assigned
+    const MCParticle       *m_pMainMCParticle;          ///< The mc particle with the largest weight, cached when the weight map is set
+
     const CartesianVector   m_expectedDirection;        ///< Unit vector in direction of expected hit propagation
     const CartesianVector   m_cellNormalVector;         ///< Unit normal to the sampling layer, pointing outwards from the origin
 
@@ -303,33 +342,22 @@ protected:
     const float             m_cellSize0;                ///< Cell size 0 [pointing: pseudo rapidity, eta, rectangular: up in ENDCAP, along beam in BARREL, units mm]
     const float             m_cellSize1;                ///< Cell size 1 [pointing: azimuthal angle, phi, rectangular: perpendicular to size 0 and thickness, units mm]
     const float             m_cellThickness;            ///< Thickness of cell, units mm
+    float                   m_cellLengthScale;          ///< Typical length scale [pointing: measured at cell mid-point, rectangular: std::sqrt(cellSize0 * cellSize1), units mm ]
 
     const float             m_nCellRadiationLengths;    ///< Absorber material in front of cell, units radiation lengths
     const float             m_nCellInteractionLengths;  ///< Absorber material in front of cell, units interaction lengths
 
     const float             m_time;                     ///< Time of (earliest) energy deposition in this cell, units ns
-    const float             m_inputEnergy;              ///< Corrected energy of calorimeter cell in user framework, units GeV
-    const float             m_mipEquivalentEnergy;      ///< The calibrated mip equivalent energy, units mip
-    const float             m_electromagneticEnergy;    ///< The calibrated electromagnetic energy measure, units GeV
-    const float             m_hadronicEnergy;           ///< The calibrated hadronic energy measure, units GeV
-
     const bool              m_isDigital;                ///< Whether cell should be treated as digital (implies constant cell energy)
-    const HitType           m_hitType;                  ///< The type of calorimeter hit
-    const HitRegion         m_hitRegion;                ///< Region of the detector in which the calo hit is located
-    const unsigned int      m_layer;                    ///< The subdetector readout layer number
-    InputUInt               m_pseudoLayer;              ///< The pseudo layer to which the calo hit has been assigned
     const bool              m_isInOuterSamplingLayer;   ///< Whether cell is in one of the outermost detector sampling layers
 
-    float                   m_cellLengthScale;          ///< Typical length scale [pointing: measured at cell mid-point, rectangular: std::sqrt(cellSize0 * cellSize1), units mm ]
-    bool                    m_isPossibleMip;            ///< Whether the calo hit is a possible mip hit
-    bool                    m_isIsolated;               ///< Whether the calo hit is isolated
-    bool                    m_isAvailable;              ///< Whether the calo hit is available to be added to a cluster
-    float                   m_weight;                   ///< The calo hit weight, which may not be unity if the hit has been fragmented
-
-    MCParticleWeightMap     m_mcParticleWeightMap;      ///< The mc particle weight map
+    MCParticleWeightMap    *m_pMCParticleWeightMap;     ///< The mc particle weight map, held apart from the hit and NULL if there are no mc particles
     const void             *m_pParentAddress;           ///< The address of the parent calo hit in the user framework
 
+    static const MCParticleWeightMap m_emptyMCParticleWeightMap;  ///< The weight map returned for calo hits with no mc particles
+
     friend class CaloHitMetadata;
+    friend class ReclusterMetadata;
     friend class CaloHitManager;
     friend class InputObjectManager<CaloHit>;
     friend class PandoraObjectFactory<PandoraApi::CaloHit::Parameters, CaloHit>;
@@ -453,7 +481,10 @@ inline unsigned int CaloHit::GetLayer() const
 
 inline unsigned int CaloHit::GetPseudoLayer() const
 {
-    return m_pseudoLayer.Get();
+    if (!m_isPseudoLayerSet)
+        throw StatusCodeException(STATUS_CODE_NOT_INITIALIZED);
+
+    return m_pseudoLayer;
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -516,7 +547,7 @@ inline bool CaloHit::IsIsolated() const
 
 inline const MCParticleWeightMap &CaloHit::GetMCParticleWeightMap() const
 {
-    return m_mcParticleWeightMap;
+    return (NULL != m_pMCParticleWeightMap) ? *m_pMCParticleWeightMap : m_emptyMCParticleWeightMap;
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -540,6 +571,20 @@ inline void CaloHit::SetAvailability(bool isAvailable)
     m_isAvailable = isAvailable;
 }
 
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline unsigned int CaloHit::GetCaloHitIndex() const
+{
+    return m_caloHitIndex;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline void CaloHit::SetCaloHitIndex(const unsigned int caloHitIndex)
+{
+    m_caloHitIndex = caloHitIndex;
+}
+
 } // namespace pandora
 
 #endif // #ifndef PANDORA_CALO_HIT_H
@@ -297,6 +297,29 @@ inline CartesianVector CartesianVector::GetCrossProduct(const CartesianVector &r
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+inline float CartesianVector::GetCosOpeningAngle(const CartesianVector &rhs) const
+{
+    const float magnitudesSquared(this->GetMagnitudeSquared() * rhs.GetMagnitudeSquared());
+
+    if (magnitudesSquared < std::numeric_limits<float>::epsilon())
+        throw StatusCodeException(STATUS_CODE_NOT_INITIALIZED);
+
+    float cosTheta = this->GetDotProduct(rhs) / std::sqrt(magnitudesSquared);
+
+    if (cosTheta > 1.f)
+    {
+        cosTheta = 1.f;
+    }
+    else if (cosTheta < -1.f)
+    {
+        cosTheta = -1.f;
+    }
+
+    return cosTheta;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 inline float CartesianVector::GetOpeningAngle(const CartesianVector &rhs) const
 {
     return std::acos(this->GetCosOpeningAngle(rhs));
@@ -304,6 +327,18 @@ inline float CartesianVector::GetOpeningAngle(const CartesianVector &rhs) const
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+inline CartesianVector CartesianVector::GetUnitVector() const
+{
+    const float magnitude(this->GetMagnitude());
+
+    if (std::fabs(magnitude) < std::numeric_limits<float>::epsilon())
+        throw StatusCodeException(STATUS_CODE_INVALID_PARAMETER);
+
+    return CartesianVector(m_x / magnitude, m_y / magnitude, m_z / magnitude);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 inline CartesianVector &CartesianVector::operator=(const CartesianVector &rhs)
 {
     this->SetValues(rhs.m_x, rhs.m_y, rhs.m_z);
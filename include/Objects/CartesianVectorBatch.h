@@ -0,0 +1,167 @@
+/**
+ *  @file   PandoraSDK/include/Objects/CartesianVectorBatch.h
+ *
+ *  @brief  Header file for the cartesian vector batch class.
+ *
+ *  $Log: $
+ */
+#ifndef PANDORA_CARTESIAN_VECTOR_BATCH_H
+#define PANDORA_CARTESIAN_VECTOR_BATCH_H 1
+
+#include "Objects/CartesianVector.h"
+
+#include "Pandora/PandoraInternal.h"
+
+namespace pandora
+{
+
+/**
+ *  @brief  CartesianVectorBatch class, holding a set of cartesian vectors as separate, contiguous arrays of x, y and z coordinates.
+ *          The batch operations compare every vector with a single reference in fixed-length, branch-free inner loops over blocks
+ *          of vectors, which compilers can vectorize for any target without architecture-specific intrinsics. Each result is
+ *          computed with the same sequence of floating point operations as the corresponding CartesianVector member function, so
+ *          the results are identical.
+ */
+class CartesianVectorBatch
+{
+public:
+    /**
+     *  @brief  Default constructor
+     */
+    CartesianVectorBatch();
+
+    /**
+     *  @brief  Constructor, from a list of cartesian vectors
+     *
+     *  @param  pointList the list of cartesian vectors
+     */
+    CartesianVectorBatch(const CartesianPointList &pointList);
+
+    /**
+     *  @brief  Reserve space for a specified number of cartesian vectors
+     *
+     *  @param  nVectors the number of cartesian vectors
+     */
+    void Reserve(const unsigned int nVectors);
+
+    /**
+     *  @brief  Add a cartesian vector to the batch
+     *
+     *  @param  cartesianVector the cartesian vector
+     */
+    void Add(const CartesianVector &cartesianVector);
+
+    /**
+     *  @brief  Remove all cartesian vectors from the batch
+     */
+    void Clear();
+
+    /**
+     *  @brief  Get the number of cartesian vectors in the batch
+     *
+     *  @return the number of cartesian vectors
+     */
+    unsigned int GetSize() const;
+
+    /**
+     *  @brief  Get a cartesian vector from the batch
+     *
+     *  @param  index the index of the cartesian vector
+     *
+     *  @return the cartesian vector
+     */
+    CartesianVector GetVector(const unsigned int index) const;
+
+    /**
+     *  @brief  Get the dot product of each cartesian vector with a reference vector
+     *
+     *  @param  reference the reference vector
+     *  @param  dotProducts to receive the dot products, in batch order
+     */
+    void GetDotProducts(const CartesianVector &reference, FloatVector &dotProducts) const;
+
+    /**
+     *  @brief  Get the squared distance from each cartesian vector to a point
+     *
+     *  @param  point the point
+     *  @param  distancesSquared to receive the squared distances, in batch order
+     */
+    void GetDistancesSquared(const CartesianVector &point, FloatVector &distancesSquared) const;
+
+    /**
+     *  @brief  Get the squared distance from each cartesian vector to a line, equal to the squared magnitude of the cross product
+     *          of the line direction with the displacement from the line point
+     *
+     *  @param  linePoint a point on the line
+     *  @param  lineDirection the line direction, which should be a unit vector
+     *  @param  distancesSquared to receive the squared distances, in batch order
+     */
+    void GetDistancesSquaredToLine(const CartesianVector &linePoint, const CartesianVector &lineDirection, FloatVector &distancesSquared) const;
+
+    /**
+     *  @brief  Get the cosine of the opening angle of each cartesian vector with respect to a reference vector
+     *
+     *  @param  reference the reference vector
+     *  @param  cosOpeningAngles to receive the cosines of the opening angles, in batch order
+     */
+    void GetCosOpeningAngles(const CartesianVector &reference, FloatVector &cosOpeningAngles) const;
+
+private:
+    /**
+     *  @brief  Get the cosine of an opening angle, clamped to the range [-1, 1], as in CartesianVector::GetCosOpeningAngle
+     *
+     *  @param  dotProduct the dot product of the two vectors
+     *  @param  magnitudesSquared the product of the squared magnitudes of the two vectors
+     *
+     *  @return the cosine of the opening angle
+     */
+    static float GetCosOpeningAngle(const float dotProduct, const float magnitudesSquared);
+
+    FloatVector     m_x;                ///< The x coordinates
+    FloatVector     m_y;                ///< The y coordinates
+    FloatVector     m_z;                ///< The z coordinates
+
+    static const unsigned int BLOCK_SIZE;   ///< The number of vectors processed together in the fixed-length inner loops
+};
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline CartesianVectorBatch::CartesianVectorBatch()
+{
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline void CartesianVectorBatch::Add(const CartesianVector &cartesianVector)
+{
+    m_x.push_back(cartesianVector.GetX());
+    m_y.push_back(cartesianVector.GetY());
+    m_z.push_back(cartesianVector.GetZ());
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline void CartesianVectorBatch::Clear()
+{
+    m_x.clear();
+    m_y.clear();
+    m_z.clear();
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline unsigned int CartesianVectorBatch::GetSize() const
+{
+    return m_x.size();
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline CartesianVector CartesianVectorBatch::GetVector(const unsigned int index) const
+{
+    return CartesianVector(m_x.at(index), m_y.at(index), m_z.at(index));
+}
+
+} // namespace pandora
+
+#endif // #ifndef PANDORA_CARTESIAN_VECTOR_BATCH_H
@@ -16,6 +16,10 @@
 
 #include "Pandora/PandoraInternal.h"
 
+#if __cplusplus > 199711L
+    #include <atomic>
+#endif
+
 namespace pandora
 {
 
@@ -26,7 +30,8 @@ template<typename T, typename S> class PandoraObjectFactory;
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 /**
- *  @brief  Cluster class
+ *  @brief  Cluster class. The lazily calculated properties are safe for concurrent const access from several threads, but a cluster
+ *          must not be modified while any other thread is accessing it.
  */
 class Cluster
 {
@@ -187,6 +192,14 @@ public:
      */
     const TrackList &GetAssociatedTrackList() const;
 
+    /**
+     *  @brief  Get the mc particle weight map for the cluster, summing the mc particle weights of the (non-isolated) constituent
+     *          calo hits. The map is maintained incrementally as calo hits are added to, or removed from, the cluster.
+     * 
+     *  @return the mc particle weight map
+     */
+    const MCParticleWeightMap &GetMCParticleWeightMap() const;
+
     /**
      *  @brief  Whether the cluster is available to be added to a particle flow object
      * 
@@ -321,9 +334,10 @@ protected:
      *  @brief  Calculate the typical hit type for a specified layer
      * 
      *  @param  pseudoLayer the pseudo layer
+     *  @param  lazyProperty the lazy property flag for the layer hit type
      *  @param  layerHitType to receive the typical layer hit type
      */
-    void CalculateLayerHitType(const unsigned int pseudoLayer, InputHitType &layerHitType) const;
+    void CalculateLayerHitType(const unsigned int pseudoLayer, const unsigned int lazyProperty, InputHitType &layerHitType) const;
 
     /**
      *  @brief  PerformClusterEnergyCorrections
@@ -353,6 +367,134 @@ protected:
      */
     void CalculateShowerProfile(const Pandora &pandora) const;
 
+    /**
+     *  @brief  Store the corrected energy estimates, unless already stored by another thread
+     * 
+     *  @param  correctedElectromagneticEnergy the corrected electromagnetic energy
+     *  @param  correctedHadronicEnergy the corrected hadronic energy
+     *  @param  trackComparisonEnergy the energy to use in comparisons with track momentum
+     */
+    void SetEnergyCorrections(const float correctedElectromagneticEnergy, const float correctedHadronicEnergy, const float trackComparisonEnergy) const;
+
+    /**
+     *  @brief  Store the fast photon flag, unless already stored by another thread
+     * 
+     *  @param  fastPhotonFlag the fast photon flag
+     */
+    void SetFastPhotonFlag(const bool fastPhotonFlag) const;
+
+    /**
+     *  @brief  Store the shower start layer, unless already stored by another thread
+     * 
+     *  @param  showerStartLayer the shower start layer
+     */
+    void SetShowerStartLayer(const unsigned int showerStartLayer) const;
+
+    /**
+     *  @brief  Store the shower profile properties, unless already stored by another thread
+     * 
+     *  @param  showerProfileStart the shower profile start
+     *  @param  showerProfileDiscrepancy the shower profile discrepancy
+     */
+    void SetShowerProfile(const float showerProfileStart, const float showerProfileDiscrepancy) const;
+
+    /**
+     *  @brief  Calculate selected plugin-evaluated properties for a vector of clusters, using the batch plugin interfaces, and
+     *          store them in the cluster caches. Properties that are already up to date are not recalculated.
+     * 
+     *  @param  pandora the associated pandora instance
+     *  @param  clusterVector the vector of clusters
+     *  @param  clusterProperties the cluster properties to prepare, a bitwise or of ClusterProperty values
+     *  @param  useThreadPool whether to divide the clusters into chunks, processed concurrently using the pandora thread pool
+     */
+    static StatusCode PrepareProperties(const Pandora &pandora, const ClusterVector &clusterVector, const unsigned int clusterProperties,
+        const bool useThreadPool);
+
+    /**
+     *  @brief  Calculate selected plugin-evaluated properties for a vector of clusters, on the calling thread
+     * 
+     *  @param  pandora the associated pandora instance
+     *  @param  clusterVector the vector of clusters
+     *  @param  clusterProperties the cluster properties to prepare, a bitwise or of ClusterProperty values
+     */
+    static void CalculateProperties(const Pandora &pandora, const ClusterVector &clusterVector, const unsigned int clusterProperties);
+
+    /**
+     *  @brief  Perform energy corrections for a vector of clusters, using the batch plugin interfaces
+     * 
+     *  @param  pandora the associated pandora instance
+     *  @param  clusterVector the vector of clusters
+     */
+    static void PerformEnergyCorrections(const Pandora &pandora, const ClusterVector &clusterVector);
+
+    /**
+     *  @brief  Calculate the fast photon flag for a vector of clusters, using the batch plugin interface
+     * 
+     *  @param  pandora the associated pandora instance
+     *  @param  clusterVector the vector of clusters
+     */
+    static void CalculateFastPhotonFlags(const Pandora &pandora, const ClusterVector &clusterVector);
+
+    /**
+     *  @brief  Calculate the shower start layer for a vector of clusters, using the batch plugin interface
+     * 
+     *  @param  pandora the associated pandora instance
+     *  @param  clusterVector the vector of clusters
+     */
+    static void CalculateShowerStartLayers(const Pandora &pandora, const ClusterVector &clusterVector);
+
+    /**
+     *  @brief  Calculate the shower profile for a vector of clusters, using the batch plugin interface
+     * 
+     *  @param  pandora the associated pandora instance
+     *  @param  clusterVector the vector of clusters
+     */
+    static void CalculateShowerProfiles(const Pandora &pandora, const ClusterVector &clusterVector);
+
+    /**
+     *  @brief  Select the clusters for which a lazily calculated property is not up to date
+     * 
+     *  @param  clusterVector the vector of clusters
+     *  @param  lazyProperty the lazy property flag
+     *  @param  outdatedClusterVector to receive the clusters for which the property is not up to date
+     */
+    static void SelectOutdatedClusters(const ClusterVector &clusterVector, const unsigned int lazyProperty, ClusterVector &outdatedClusterVector);
+
+    class PropertyCalculationTask;
+
+    /**
+     *  @brief  Whether a lazily calculated property is up to date. The value of the property may only be read once this is true.
+     * 
+     *  @param  lazyProperty the lazy property flag
+     * 
+     *  @return boolean
+     */
+    bool IsUpToDate(const unsigned int lazyProperty) const;
+
+    /**
+     *  @brief  Claim the right to store a newly calculated lazy property. Concurrent const calls may calculate the same property,
+     *          but only the first to claim it stores its value; the others wait until that value has been published.
+     * 
+     *  @param  lazyProperty the lazy property flag
+     * 
+     *  @return whether the calling thread should store the property value and then publish it
+     */
+    bool ClaimLazyProperty(const unsigned int lazyProperty) const;
+
+    /**
+     *  @brief  Publish a stored lazy property, making its value available to all threads
+     * 
+     *  @param  lazyProperty the lazy property flag
+     */
+    void PublishLazyProperty(const unsigned int lazyProperty) const;
+
+    /**
+     *  @brief  Mark lazily calculated properties as out of date. Must not be called concurrently with any const access.
+     * 
+     *  @param  lazyProperties the lazy property flags
+     */
+    void ResetLazyProperties(const unsigned int lazyProperties);
+
     /**
      *  @brief  Reset all cluster properties
      */
@@ -370,6 +512,25 @@ protected:
      */
     StatusCode AddHitsFromSecondCluster(const Cluster *const pCluster);
 
+    /**
+     *  @brief  Add the mc particle weights of a calo hit to the cluster mc particle weight map
+     * 
+     *  @param  pCaloHit the address of the calo hit
+     */
+    void AddMCParticleWeights(const CaloHit *const pCaloHit);
+
+    /**
+     *  @brief  Remove the mc particle weights of a calo hit from the cluster mc particle weight map
+     * 
+     *  @param  pCaloHit the address of the calo hit
+     */
+    StatusCode RemoveMCParticleWeights(const CaloHit *const pCaloHit);
+
+    /**
+     *  @brief  Recalculate the cluster mc particle weight map from the current calo hit mc particle weights
+     */
+    void ResetMCParticleWeights();
+
     /**
      *  @brief  Add an association between the cluster and a track
      * 
@@ -408,9 +569,28 @@ protected:
 
     typedef std::map<unsigned int, SimplePoint> PointByPseudoLayerMap;///< The point by pseudo layer typedef
     typedef std::map<HitType, float> HitTypeToEnergyMap;        ///< The hit type to energy map typedef
+    typedef std::map<const MCParticle *, unsigned int> MCParticleHitCountMap;///< The mc particle to number of contributing hits map typedef
+
+#if __cplusplus > 199711L
+    typedef std::atomic<unsigned int> LazyPropertyFlags;        ///< The lazy property flags typedef
+#else
+    typedef unsigned int LazyPropertyFlags;                     ///< The lazy property flags typedef
+#endif
+
+    static const unsigned int   INITIAL_DIRECTION;              ///< The lazy property flag for the initial direction
+    static const unsigned int   FIT_TO_ALL_HITS;                ///< The lazy property flag for the fit to all hits
+    static const unsigned int   ENERGY_CORRECTIONS;             ///< The lazy property flag for the corrected energies
+    static const unsigned int   FAST_PHOTON_FLAG;               ///< The lazy property flag for the fast photon flag
+    static const unsigned int   SHOWER_START_LAYER;             ///< The lazy property flag for the shower start layer
+    static const unsigned int   SHOWER_PROFILE;                 ///< The lazy property flag for the shower profile
+    static const unsigned int   INNER_LAYER_HIT_TYPE;           ///< The lazy property flag for the inner layer hit type
+    static const unsigned int   OUTER_LAYER_HIT_TYPE;           ///< The lazy property flag for the outer layer hit type
+    static const unsigned int   ALL_LAZY_PROPERTIES;            ///< The combination of all lazy property flags
+    static const unsigned int   LAZY_PROPERTY_CLAIM_SHIFT;      ///< The shift from a lazy property flag to the flag recording its claim
+    static const unsigned int   CHUNKS_PER_THREAD;              ///< The number of cluster chunks per thread when preparing properties concurrently
 
     OrderedCaloHitList          m_orderedCaloHitList;           ///< The ordered calo hit list
-    CaloHitList                 m_isolatedCaloHitList;          ///< The list of isolated hits, which contribute only towards cluster energy
+    LazyContainer<CaloHitList>  m_isolatedCaloHitList;          ///< The list of isolated hits, which contribute only towards cluster energy
 
     unsigned int                m_nCaloHits;                    ///< The number of calo hits
     unsigned int                m_nPossibleMipHits;             ///< The number of calo hits that have been flagged as possible mip hits
@@ -430,11 +610,10 @@ protected:
     InputUInt                   m_innerPseudoLayer;             ///< The innermost pseudo layer in the cluster
     InputUInt                   m_outerPseudoLayer;             ///< The outermost pseudo layer in the cluster
 
-    mutable CartesianVector     m_initialDirection;             ///< The initial direction of the cluster
-    mutable bool                m_isDirectionUpToDate;          ///< Whether the initial direction of the cluster is up to date
+    mutable LazyPropertyFlags   m_lazyPropertyFlags;            ///< The claimed and published flags for the lazily calculated properties
 
+    mutable CartesianVector     m_initialDirection;             ///< The initial direction of the cluster
     mutable ClusterFitResult    m_fitToAllHitsResult;           ///< The result of a linear fit to all calo hits in the cluster
-    mutable bool                m_isFitUpToDate;                ///< Whether the fit to all calo hits is up to date
 
     mutable InputFloat          m_correctedElectromagneticEnergy;///< The corrected electromagnetic estimate of the cluster energy, units GeV
     mutable InputFloat          m_correctedHadronicEnergy;      ///< The corrected hadronic estimate of the cluster energy, units GeV
@@ -448,11 +627,15 @@ protected:
     mutable InputHitType        m_innerLayerHitType;            ///< The typical inner layer hit type
     mutable InputHitType        m_outerLayerHitType;            ///< The typical outer layer hit type
 
-    TrackList                   m_associatedTrackList;          ///< The list of tracks associated with the cluster
+    LazyContainer<TrackList>    m_associatedTrackList;          ///< The list of tracks associated with the cluster
+
+    MCParticleWeightMap         m_mcParticleWeightMap;          ///< The summed mc particle weights of the constituent calo hits
+    MCParticleHitCountMap       m_mcParticleHitCountMap;        ///< The number of constituent calo hits to which each mc particle contributes
 
     bool                        m_isAvailable;                  ///< Whether the cluster is available to be added to a particle flow object
 
     friend class ClusterManager;
+    friend class PandoraContentApiImpl;
     friend class AlgorithmObjectManager<Cluster>;
     friend class PandoraObjectFactory<PandoraContentApi::Cluster::Parameters, Cluster>;
 };
@@ -468,7 +651,7 @@ inline const OrderedCaloHitList &Cluster::GetOrderedCaloHitList() const
 
 inline const CaloHitList &Cluster::GetIsolatedCaloHitList() const
 {
-    return m_isolatedCaloHitList;
+    return m_isolatedCaloHitList.Get();
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -482,7 +665,7 @@ inline unsigned int Cluster::GetNCaloHits() const
 
 inline unsigned int Cluster::GetNIsolatedCaloHits() const
 {
-    return m_isolatedCaloHitList.size();
+    return m_isolatedCaloHitList.Get().size();
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -576,7 +759,7 @@ inline unsigned int Cluster::GetOuterPseudoLayer() const
 
 inline const CartesianVector &Cluster::GetInitialDirection() const
 {
-    if (!m_isDirectionUpToDate)
+    if (!this->IsUpToDate(INITIAL_DIRECTION))
         this->CalculateInitialDirection();
 
     return m_initialDirection;
@@ -586,7 +769,7 @@ inline const CartesianVector &Cluster::GetInitialDirection() const
 
 inline const ClusterFitResult &Cluster::GetFitToAllHitsResult() const
 {
-    if (!m_isFitUpToDate)
+    if (!this->IsUpToDate(FIT_TO_ALL_HITS))
         this->CalculateFitToAllHitsResult();
 
     return m_fitToAllHitsResult;
@@ -596,8 +779,8 @@ inline const ClusterFitResult &Cluster::GetFitToAllHitsResult() const
 
 inline HitType Cluster::GetInnerLayerHitType() const
 {
-    if (!m_innerLayerHitType.IsInitialized())
-        this->CalculateLayerHitType(m_innerPseudoLayer.Get(), m_innerLayerHitType);
+    if (!this->IsUpToDate(INNER_LAYER_HIT_TYPE))
+        this->CalculateLayerHitType(m_innerPseudoLayer.Get(), INNER_LAYER_HIT_TYPE, m_innerLayerHitType);
 
     return m_innerLayerHitType.Get();
 }
@@ -606,8 +789,8 @@ inline HitType Cluster::GetInnerLayerHitType() const
 
 inline HitType Cluster::GetOuterLayerHitType() const
 {
-    if (!m_outerLayerHitType.IsInitialized())
-        this->CalculateLayerHitType(m_outerPseudoLayer.Get(), m_outerLayerHitType);
+    if (!this->IsUpToDate(OUTER_LAYER_HIT_TYPE))
+        this->CalculateLayerHitType(m_outerPseudoLayer.Get(), OUTER_LAYER_HIT_TYPE, m_outerLayerHitType);
 
     return m_outerLayerHitType.Get();
 }
@@ -616,14 +799,21 @@ inline HitType Cluster::GetOuterLayerHitType() const
 
 inline const TrackList &Cluster::GetAssociatedTrackList() const
 {
-    return m_associatedTrackList;
+    return m_associatedTrackList.Get();
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline const MCParticleWeightMap &Cluster::GetMCParticleWeightMap() const
+{
+    return m_mcParticleWeightMap;
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 inline float Cluster::GetCorrectedElectromagneticEnergy(const Pandora &pandora) const
 {
-    if (!m_correctedElectromagneticEnergy.IsInitialized())
+    if (!this->IsUpToDate(ENERGY_CORRECTIONS))
         this->PerformEnergyCorrections(pandora);
 
     return m_correctedElectromagneticEnergy.Get();
@@ -633,7 +823,7 @@ inline float Cluster::GetCorrectedElectromagneticEnergy(const Pandora &pandora)
 
 inline float Cluster::GetCorrectedHadronicEnergy(const Pandora &pandora) const
 {
-    if (!m_correctedHadronicEnergy.IsInitialized())
+    if (!this->IsUpToDate(ENERGY_CORRECTIONS))
         this->PerformEnergyCorrections(pandora);
 
     return m_correctedHadronicEnergy.Get();
@@ -643,7 +833,7 @@ inline float Cluster::GetCorrectedHadronicEnergy(const Pandora &pandora) const
 
 inline float Cluster::GetTrackComparisonEnergy(const Pandora &pandora) const
 {
-    if (!m_trackComparisonEnergy.IsInitialized())
+    if (!this->IsUpToDate(ENERGY_CORRECTIONS))
         this->PerformEnergyCorrections(pandora);
 
     return m_trackComparisonEnergy.Get();
@@ -653,7 +843,7 @@ inline float Cluster::GetTrackComparisonEnergy(const Pandora &pandora) const
 
 inline bool Cluster::IsPhotonFast(const Pandora &pandora) const
 {
-    if (!m_isPhotonFast.IsInitialized())
+    if (!this->IsUpToDate(FAST_PHOTON_FLAG))
         this->CalculateFastPhotonFlag(pandora);
 
     return m_isPhotonFast.Get();
@@ -663,7 +853,7 @@ inline bool Cluster::IsPhotonFast(const Pandora &pandora) const
 
 inline unsigned int Cluster::GetShowerStartLayer(const Pandora &pandora) const
 {
-    if (!m_showerStartLayer.IsInitialized())
+    if (!this->IsUpToDate(SHOWER_START_LAYER))
         this->CalculateShowerStartLayer(pandora);
 
     return m_showerStartLayer.Get();
@@ -673,7 +863,7 @@ inline unsigned int Cluster::GetShowerStartLayer(const Pandora &pandora) const
 
 inline float Cluster::GetShowerProfileStart(const Pandora &pandora) const
 {
-    if (!m_showerProfileStart.IsInitialized())
+    if (!this->IsUpToDate(SHOWER_PROFILE))
         this->CalculateShowerProfile(pandora);
 
     return m_showerProfileStart.Get();
@@ -683,7 +873,7 @@ inline float Cluster::GetShowerProfileStart(const Pandora &pandora) const
 
 inline float Cluster::GetShowerProfileDiscrepancy(const Pandora &pandora) const
 {
-    if (!m_showerProfileDiscrepancy.IsInitialized())
+    if (!this->IsUpToDate(SHOWER_PROFILE))
         this->CalculateShowerProfile(pandora);
 
     return m_showerProfileDiscrepancy.Get();
@@ -707,11 +897,24 @@ inline bool Cluster::IsAvailable() const
 inline void Cluster::RemoveTrackSeed()
 {
     m_pTrackSeed = NULL;
+    m_initialDirection.SetValues(0.f, 0.f, 0.f);
+    this->ResetLazyProperties(INITIAL_DIRECTION);
     this->CalculateInitialDirection();
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+inline bool Cluster::IsUpToDate(const unsigned int lazyProperty) const
+{
+#if __cplusplus > 199711L
+    return (0 != (m_lazyPropertyFlags.load(std::memory_order_acquire) & lazyProperty));
+#else
+    return (0 != (m_lazyPropertyFlags & lazyProperty));
+#endif
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 inline void Cluster::SetAvailability(bool isAvailable)
 {
     m_isAvailable = isAvailable;
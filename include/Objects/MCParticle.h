@@ -197,8 +197,8 @@ protected:
     const MCParticleType    m_mcParticleType;           ///< The type of the mc particle, e.g. vertex, 2D-projection, etc.
 
     const MCParticle       *m_pPfoTarget;               ///< The address of the pfo target
-    MCParticleList          m_daughterList;             ///< The list of mc daughter particles
-    MCParticleList          m_parentList;               ///< The list of mc parent particles
+    LazyContainer<MCParticleList> m_daughterList;       ///< The list of mc daughter particles
+    LazyContainer<MCParticleList> m_parentList;         ///< The list of mc parent particles
 
     friend class MCManager;
     friend class InputObjectManager<MCParticle>;
@@ -209,7 +209,7 @@ protected:
 
 inline bool MCParticle::IsRootParticle() const
 {
-    return m_parentList.empty();
+    return m_parentList.Get().empty();
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -303,14 +303,14 @@ inline MCParticleType MCParticle::GetMCParticleType() const
 
 inline const MCParticleList &MCParticle::GetParentList() const
 {
-    return m_parentList;
+    return m_parentList.Get();
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 inline const MCParticleList &MCParticle::GetDaughterList() const
 {
-    return m_daughterList;
+    return m_daughterList.Get();
 }
 
 } // namespace pandora
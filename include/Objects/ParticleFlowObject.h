@@ -208,10 +208,10 @@ protected:
 
     TrackList               m_trackList;                ///< The track list
     ClusterList             m_clusterList;              ///< The cluster list
-    VertexList              m_vertexList;               ///< The vertex list
+    LazyContainer<VertexList> m_vertexList;             ///< The vertex list
 
-    PfoList                 m_parentPfoList;            ///< The list of parent pfos
-    PfoList                 m_daughterPfoList;          ///< The list of daughter pfos
+    LazyContainer<PfoList>  m_parentPfoList;            ///< The list of parent pfos
+    LazyContainer<PfoList>  m_daughterPfoList;          ///< The list of daughter pfos
 
     friend class ParticleFlowObjectManager;
     friend class AlgorithmObjectManager<ParticleFlowObject>;
@@ -273,7 +273,7 @@ inline const ClusterList &ParticleFlowObject::GetClusterList() const
 
 inline const VertexList &ParticleFlowObject::GetVertexList() const
 {
-    return m_vertexList;
+    return m_vertexList.Get();
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -294,28 +294,28 @@ inline unsigned int ParticleFlowObject::GetNClusters() const
 
 inline const PfoList &ParticleFlowObject::GetParentPfoList() const
 {
-    return m_parentPfoList;
+    return m_parentPfoList.Get();
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 inline const PfoList &ParticleFlowObject::GetDaughterPfoList() const
 {
-    return m_daughterPfoList;
+    return m_daughterPfoList.Get();
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 inline unsigned int ParticleFlowObject::GetNParentPfos() const
 {
-    return m_parentPfoList.size();
+    return m_parentPfoList.Get().size();
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 inline unsigned int ParticleFlowObject::GetNDaughterPfos() const
 {
-    return m_daughterPfoList.size();
+    return m_daughterPfoList.Get().size();
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
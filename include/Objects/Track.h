@@ -283,12 +283,13 @@ protected:
     const bool              m_canFormClusterlessPfo;    ///< Whether track should form a pfo, even if it has no associated cluster
 
     const Cluster          *m_pAssociatedCluster;       ///< The address of an associated cluster
-    MCParticleWeightMap     m_mcParticleWeightMap;      ///< The mc particle weight map
+    LazyContainer<MCParticleWeightMap> m_mcParticleWeightMap; ///< The mc particle weight map, allocated only if non-empty
+    const MCParticle       *m_pMainMCParticle;          ///< The mc particle with the largest weight, cached when the weight map is set
     const void             *m_pParentAddress;           ///< The address of the parent track in the user framework
 
-    TrackList               m_parentTrackList;          ///< The list of parent track addresses
-    TrackList               m_siblingTrackList;         ///< The list of sibling track addresses
-    TrackList               m_daughterTrackList;        ///< The list of daughter track addresses
+    LazyContainer<TrackList> m_parentTrackList;         ///< The list of parent track addresses
+    LazyContainer<TrackList> m_siblingTrackList;        ///< The list of sibling track addresses
+    LazyContainer<TrackList> m_daughterTrackList;       ///< The list of daughter track addresses
 
     bool                    m_isAvailable;              ///< Whether the track is available to be added to a particle flow object
 
@@ -431,7 +432,7 @@ inline const Cluster *Track::GetAssociatedCluster() const
 
 inline const MCParticleWeightMap &Track::GetMCParticleWeightMap() const
 {
-    return m_mcParticleWeightMap;
+    return m_mcParticleWeightMap.Get();
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -445,21 +446,21 @@ inline const void *Track::GetParentTrackAddress() const
 
 inline const TrackList &Track::GetParentTrackList() const
 {
-    return m_parentTrackList;
+    return m_parentTrackList.Get();
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 inline const TrackList &Track::GetSiblingTrackList() const
 {
-    return m_siblingTrackList;
+    return m_siblingTrackList.Get();
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 inline const TrackList &Track::GetDaughterTrackList() const
 {
-    return m_daughterTrackList;
+    return m_daughterTrackList.Get();
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
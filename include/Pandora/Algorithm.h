@@ -8,7 +8,12 @@
 #ifndef PANDORA_ALGORITHM_H
 #define PANDORA_ALGORITHM_H 1
 
+#include "Api/PandoraContentApi.h"
+
+#include "Pandora/FrozenListView.h"
+#include "Pandora/Pandora.h"
 #include "Pandora/Process.h"
+#include "Pandora/ThreadPool.h"
 
 namespace pandora
 {
@@ -25,10 +30,163 @@ protected:
      */
     virtual StatusCode Run() = 0;
 
+    /**
+     *  @brief  Call a functor for each element of a vector, distributing the calls over the pandora thread pool. The functor may be
+     *          called concurrently from several threads, so it may only read shared state, e.g. via const access to clusters, and must
+     *          not make content api calls. Content api calls, even list reads, are not guaranteed to leave the shared event state
+     *          untouched, so any lists required should be obtained before the call.
+     * 
+     *  @param  elementVector the vector of elements
+     *  @param  functor the functor, called as functor(element) and returning a status code
+     * 
+     *  @return the first failure status code, whether returned or thrown by the functor, otherwise STATUS_CODE_SUCCESS
+     */
+    template <typename T, typename FUNCTOR>
+    StatusCode ParallelFor(const std::vector<T> &elementVector, const FUNCTOR &functor) const;
+
+    /**
+     *  @brief  Call a functor for each element of a list, distributing the calls over the pandora thread pool, as for vectors
+     * 
+     *  @param  elementList the list of elements
+     *  @param  functor the functor, called as functor(element) and returning a status code
+     * 
+     *  @return the first failure status code, whether returned or thrown by the functor, otherwise STATUS_CODE_SUCCESS
+     */
+    template <typename T, typename FUNCTOR>
+    StatusCode ParallelFor(const std::MANAGED_CONTAINER<T> &elementList, const FUNCTOR &functor) const;
+
+    /**
+     *  @brief  Run a set of algorithm tools concurrently, over the pandora thread pool, against a frozen view of the current lists.
+     *          The content api is locked whilst the tools run, so any attempt by a tool to modify the managers fails with
+     *          STATUS_CODE_NOT_ALLOWED. Each tool instead records its proposed changes in its own output, and the outputs are
+     *          returned in tool order so that the algorithm can apply them serially, and reproducibly, once the tools have finished.
+     *          A tool appearing more than once in the vector is rejected with STATUS_CODE_INVALID_PARAMETER. The output type must
+     *          not be bool.
+     * 
+     *  @param  toolVector the vector of algorithm tools
+     *  @param  functor the functor, called as functor(pTool, frozenListView, output) and returning a status code
+     *  @param  outputVector to receive the outputs, one per tool, replacing any existing contents
+     * 
+     *  @return the first failure status code, whether returned or thrown by the functor, otherwise STATUS_CODE_SUCCESS
+     */
+    template <typename TOOL, typename FUNCTOR, typename OUTPUT>
+    StatusCode RunToolsConcurrently(const std::vector<TOOL *> &toolVector, const FUNCTOR &functor, std::vector<OUTPUT> &outputVector) const;
+
+    /**
+     *  @brief  Run a set of algorithm tools concurrently, as above, against a frozen list view prepared by the algorithm, e.g. one to
+     *          which named lists have been added. The view must have been constructed by this algorithm, with no subsequent changes
+     *          to the lists.
+     * 
+     *  @param  frozenListView the frozen list view
+     *  @param  toolVector the vector of algorithm tools
+     *  @param  functor the functor, called as functor(pTool, frozenListView, output) and returning a status code
+     *  @param  outputVector to receive the outputs, one per tool, replacing any existing contents
+     * 
+     *  @return the first failure status code, whether returned or thrown by the functor, otherwise STATUS_CODE_SUCCESS
+     */
+    template <typename TOOL, typename FUNCTOR, typename OUTPUT>
+    StatusCode RunToolsConcurrently(const FrozenListView &frozenListView, const std::vector<TOOL *> &toolVector, const FUNCTOR &functor,
+        std::vector<OUTPUT> &outputVector) const;
+
+private:
+    /**
+     *  @brief  ConcurrentToolTask class, calling a functor for each algorithm tool, with the frozen list view and the tool output
+     */
+    template <typename TOOL, typename FUNCTOR, typename OUTPUT>
+    class ConcurrentToolTask : public ThreadPool::Task
+    {
+    public:
+        /**
+         *  @brief  Constructor
+         * 
+         *  @param  toolVector the vector of algorithm tools
+         *  @param  frozenListView the frozen list view
+         *  @param  functor the functor
+         *  @param  outputVector the vector of outputs, one per tool
+         */
+        ConcurrentToolTask(const std::vector<TOOL *> &toolVector, const FrozenListView &frozenListView, const FUNCTOR &functor,
+            std::vector<OUTPUT> &outputVector);
+
+        StatusCode Run(const unsigned int index) const;
+
+    private:
+        const std::vector<TOOL *>  &m_toolVector;       ///< The vector of algorithm tools
+        const FrozenListView       &m_frozenListView;   ///< The frozen list view
+        const FUNCTOR              &m_functor;          ///< The functor
+        std::vector<OUTPUT>        &m_outputVector;     ///< The vector of outputs, one per tool
+    };
+
     friend class AlgorithmManager;
     friend class PandoraContentApiImpl;
 };
 
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename T, typename FUNCTOR>
+inline StatusCode Algorithm::ParallelFor(const std::vector<T> &elementVector, const FUNCTOR &functor) const
+{
+    const VectorTask<T, FUNCTOR> task(elementVector, functor);
+    return this->GetPandora().GetThreadPool()->ParallelFor(elementVector.size(), task);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename T, typename FUNCTOR>
+inline StatusCode Algorithm::ParallelFor(const std::MANAGED_CONTAINER<T> &elementList, const FUNCTOR &functor) const
+{
+    const std::vector<T> elementVector(elementList.begin(), elementList.end());
+    return this->ParallelFor(elementVector, functor);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename TOOL, typename FUNCTOR, typename OUTPUT>
+inline StatusCode Algorithm::RunToolsConcurrently(const std::vector<TOOL *> &toolVector, const FUNCTOR &functor,
+    std::vector<OUTPUT> &outputVector) const
+{
+    const FrozenListView frozenListView(*this);
+    return this->RunToolsConcurrently(frozenListView, toolVector, functor, outputVector);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename TOOL, typename FUNCTOR, typename OUTPUT>
+inline StatusCode Algorithm::RunToolsConcurrently(const FrozenListView &frozenListView, const std::vector<TOOL *> &toolVector,
+    const FUNCTOR &functor, std::vector<OUTPUT> &outputVector) const
+{
+    const std::set<TOOL *> toolSet(toolVector.begin(), toolVector.end());
+
+    if (toolSet.size() != toolVector.size())
+        return STATUS_CODE_INVALID_PARAMETER;
+
+    outputVector.clear();
+    outputVector.resize(toolVector.size());
+
+    const ConcurrentToolTask<TOOL, FUNCTOR, OUTPUT> task(toolVector, frozenListView, functor, outputVector);
+    return PandoraContentApi::RunReadOnlyTasks(*this, toolVector.size(), task);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename TOOL, typename FUNCTOR, typename OUTPUT>
+inline Algorithm::ConcurrentToolTask<TOOL, FUNCTOR, OUTPUT>::ConcurrentToolTask(const std::vector<TOOL *> &toolVector,
+        const FrozenListView &frozenListView, const FUNCTOR &functor, std::vector<OUTPUT> &outputVector) :
+    m_toolVector(toolVector),
+    m_frozenListView(frozenListView),
+    m_functor(functor),
+    m_outputVector(outputVector)
+{
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename TOOL, typename FUNCTOR, typename OUTPUT>
+inline StatusCode Algorithm::ConcurrentToolTask<TOOL, FUNCTOR, OUTPUT>::Run(const unsigned int index) const
+{
+    return m_functor(m_toolVector[index], m_frozenListView, m_outputVector[index]);
+}
+
 //------------------------------------------------------------------------------------------------------------------------------------------
 //------------------------------------------------------------------------------------------------------------------------------------------
 
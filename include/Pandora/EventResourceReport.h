@@ -0,0 +1,103 @@
+/**
+ *  @file   PandoraSDK/include/Pandora/EventResourceReport.h
+ *
+ *  @brief  Header file for the event resource report classes.
+ *
+ *  $Log: $
+ */
+#ifndef PANDORA_EVENT_RESOURCE_REPORT_H
+#define PANDORA_EVENT_RESOURCE_REPORT_H 1
+
+#include "Pandora/PandoraInternal.h"
+
+namespace pandora
+{
+
+/**
+ *  @brief  ObjectResourceReport class, describing the objects and named lists held by a single object manager in the current event
+ */
+class ObjectResourceReport
+{
+public:
+    typedef std::map<std::string, unsigned int> ListSizeMap;
+
+    /**
+     *  @brief  Default constructor
+     */
+    ObjectResourceReport();
+
+    /**
+     *  @brief  Get the estimated high-water memory use, in bytes: the peak number of live objects multiplied by the object size, together
+     *          with an estimate for the current named list entries. Memory owned by the objects themselves is not included.
+     *
+     *  @return the estimated high-water memory use
+     */
+    unsigned long GetEstimatedPeakBytes() const;
+
+    /**
+     *  @brief  Print the report
+     *
+     *  @param  objectType the object type name, used as a label
+     */
+    void Print(const std::string &objectType) const;
+
+    unsigned int            m_nObjectsCreated;          ///< The number of objects created in the current event
+    unsigned int            m_nObjectsDeleted;          ///< The number of objects deleted in the current event, prior to the event reset
+    unsigned int            m_peakNLiveObjects;         ///< The peak number of live objects in the current event
+    unsigned int            m_objectSize;               ///< The size of a single object, in bytes
+    unsigned int            m_nListEntries;             ///< The total number of entries in the named lists
+    ListSizeMap             m_listSizes;                ///< The sizes of the named lists, by list name
+
+    static const unsigned int ESTIMATED_BYTES_PER_LIST_ENTRY;   ///< The estimated memory use for a single named list entry, in bytes
+};
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+/**
+ *  @brief  EventResourceReport class, describing the resources used by the current event, for use in capacity planning. A report reflects
+ *          the state at the time it is requested, so should be requested after processing and before the event is reset.
+ */
+class EventResourceReport
+{
+public:
+    typedef std::map<std::string, unsigned int> AlgorithmExceptionCountMap;
+
+    /**
+     *  @brief  Default constructor
+     */
+    EventResourceReport();
+
+    /**
+     *  @brief  Get the peak number of live objects, summed over all object types
+     *
+     *  @return the peak number of live objects
+     */
+    unsigned int GetPeakNLiveObjects() const;
+
+    /**
+     *  @brief  Get the estimated high-water memory use, in bytes, summed over all object types
+     *
+     *  @return the estimated high-water memory use
+     */
+    unsigned long GetEstimatedPeakBytes() const;
+
+    /**
+     *  @brief  Print the report
+     */
+    void Print() const;
+
+    ObjectResourceReport    m_caloHits;                 ///< The calo hit resource report
+    ObjectResourceReport    m_tracks;                   ///< The track resource report
+    ObjectResourceReport    m_mcParticles;              ///< The mc particle resource report
+    ObjectResourceReport    m_clusters;                 ///< The cluster resource report
+    ObjectResourceReport    m_pfos;                     ///< The pfo resource report
+    ObjectResourceReport    m_vertices;                 ///< The vertex resource report
+    unsigned int            m_maxReclusteringDepth;     ///< The maximum number of simultaneous reclustering processes in the current event
+    unsigned int            m_nFragmentedCaloHits;      ///< The number of calo hits fragmented in the current event
+    unsigned int            m_nMergedCaloHitFragments;  ///< The number of calo hit fragment merges in the current event
+    AlgorithmExceptionCountMap m_algorithmExceptionCounts; ///< The number of status code exceptions thrown whilst running each algorithm, and its daughters, by name
+};
+
+} // namespace pandora
+
+#endif // #ifndef PANDORA_EVENT_RESOURCE_REPORT_H
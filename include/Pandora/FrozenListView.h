@@ -0,0 +1,366 @@
+/**
+ *  @file   PandoraSDK/include/Pandora/FrozenListView.h
+ * 
+ *  @brief  Header file for the frozen list view class.
+ * 
+ *  $Log: $
+ */
+#ifndef PANDORA_FROZEN_LIST_VIEW_H
+#define PANDORA_FROZEN_LIST_VIEW_H 1
+
+#include "Pandora/PandoraInternal.h"
+#include "Pandora/StatusCodes.h"
+
+namespace pandora
+{
+
+class Algorithm;
+class GeometryManager;
+class PandoraSettings;
+class PluginManager;
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+/**
+ *  @brief  FrozenListView class, holding the current lists and the pandora services as seen by an algorithm at construction, together
+ *          with any named lists added before the tasks are run. The view provides the read-only access required by tasks run whilst
+ *          the content api is locked, as the content api itself cannot then be used. The view remains valid only until the calling
+ *          algorithm next modifies the lists.
+ */
+class FrozenListView
+{
+public:
+    /**
+     *  @brief  Constructor
+     * 
+     *  @param  algorithm the algorithm whose current lists are to be frozen
+     */
+    FrozenListView(const Algorithm &algorithm);
+
+    /**
+     *  @brief  Add a named list to the view, which must be done before the content api is locked
+     * 
+     *  @param  algorithm the algorithm calling this function
+     *  @param  listName the name of the list
+     */
+    template <typename T>
+    StatusCode AddList(const Algorithm &algorithm, const std::string &listName);
+
+    /**
+     *  @brief  Get the current calo hit list, throws STATUS_CODE_NOT_INITIALIZED if there was no current calo hit list
+     * 
+     *  @return the current calo hit list
+     */
+    const CaloHitList &GetCaloHitList() const;
+
+    /**
+     *  @brief  Get a named calo hit list added to the view, throws STATUS_CODE_NOT_FOUND if no such list was added
+     * 
+     *  @param  listName the name of the list
+     * 
+     *  @return the named calo hit list
+     */
+    const CaloHitList &GetCaloHitList(const std::string &listName) const;
+
+    /**
+     *  @brief  Get the current track list, throws STATUS_CODE_NOT_INITIALIZED if there was no current track list
+     * 
+     *  @return the current track list
+     */
+    const TrackList &GetTrackList() const;
+
+    /**
+     *  @brief  Get a named track list added to the view, throws STATUS_CODE_NOT_FOUND if no such list was added
+     * 
+     *  @param  listName the name of the list
+     * 
+     *  @return the named track list
+     */
+    const TrackList &GetTrackList(const std::string &listName) const;
+
+    /**
+     *  @brief  Get the current mc particle list, throws STATUS_CODE_NOT_INITIALIZED if there was no current mc particle list
+     * 
+     *  @return the current mc particle list
+     */
+    const MCParticleList &GetMCParticleList() const;
+
+    /**
+     *  @brief  Get a named mc particle list added to the view, throws STATUS_CODE_NOT_FOUND if no such list was added
+     * 
+     *  @param  listName the name of the list
+     * 
+     *  @return the named mc particle list
+     */
+    const MCParticleList &GetMCParticleList(const std::string &listName) const;
+
+    /**
+     *  @brief  Get the current cluster list, throws STATUS_CODE_NOT_INITIALIZED if there was no current cluster list
+     * 
+     *  @return the current cluster list
+     */
+    const ClusterList &GetClusterList() const;
+
+    /**
+     *  @brief  Get a named cluster list added to the view, throws STATUS_CODE_NOT_FOUND if no such list was added
+     * 
+     *  @param  listName the name of the list
+     * 
+     *  @return the named cluster list
+     */
+    const ClusterList &GetClusterList(const std::string &listName) const;
+
+    /**
+     *  @brief  Get the current pfo list, throws STATUS_CODE_NOT_INITIALIZED if there was no current pfo list
+     * 
+     *  @return the current pfo list
+     */
+    const PfoList &GetPfoList() const;
+
+    /**
+     *  @brief  Get a named pfo list added to the view, throws STATUS_CODE_NOT_FOUND if no such list was added
+     * 
+     *  @param  listName the name of the list
+     * 
+     *  @return the named pfo list
+     */
+    const PfoList &GetPfoList(const std::string &listName) const;
+
+    /**
+     *  @brief  Get the current vertex list, throws STATUS_CODE_NOT_INITIALIZED if there was no current vertex list
+     * 
+     *  @return the current vertex list
+     */
+    const VertexList &GetVertexList() const;
+
+    /**
+     *  @brief  Get a named vertex list added to the view, throws STATUS_CODE_NOT_FOUND if no such list was added
+     * 
+     *  @param  listName the name of the list
+     * 
+     *  @return the named vertex list
+     */
+    const VertexList &GetVertexList(const std::string &listName) const;
+
+    /**
+     *  @brief  Get the pandora settings instance
+     * 
+     *  @return the address of the pandora settings instance
+     */
+    const PandoraSettings *GetSettings() const;
+
+    /**
+     *  @brief  Get the pandora geometry instance
+     * 
+     *  @return the address of the pandora geometry instance
+     */
+    const GeometryManager *GetGeometry() const;
+
+    /**
+     *  @brief  Get the pandora plugin instance, providing access to user registered functions and calculators
+     * 
+     *  @return the address of the pandora plugin instance
+     */
+    const PluginManager *GetPlugins() const;
+
+private:
+    /**
+     *  @brief  Get a list held by the view
+     * 
+     *  @param  pT address of the list, NULL if there was no current list
+     * 
+     *  @return the list
+     */
+    template <typename T>
+    static const T &GetList(const T *const pT);
+
+    /**
+     *  @brief  Add a named list to a name to list map
+     * 
+     *  @param  algorithm the algorithm calling this function
+     *  @param  listName the name of the list
+     *  @param  nameToListMap the name to list map
+     */
+    template <typename T>
+    static StatusCode AddList(const Algorithm &algorithm, const std::string &listName, std::map<std::string, const T *> &nameToListMap);
+
+    /**
+     *  @brief  Get a named list from a name to list map
+     * 
+     *  @param  listName the name of the list
+     *  @param  nameToListMap the name to list map
+     * 
+     *  @return the list
+     */
+    template <typename T>
+    static const T &GetList(const std::string &listName, const std::map<std::string, const T *> &nameToListMap);
+
+    typedef std::map<std::string, const CaloHitList *> NameToCaloHitListMap;
+    typedef std::map<std::string, const TrackList *> NameToTrackListMap;
+    typedef std::map<std::string, const MCParticleList *> NameToMCParticleListMap;
+    typedef std::map<std::string, const ClusterList *> NameToClusterListMap;
+    typedef std::map<std::string, const PfoList *> NameToPfoListMap;
+    typedef std::map<std::string, const VertexList *> NameToVertexListMap;
+
+    const CaloHitList          *m_pCaloHitList;         ///< The current calo hit list
+    const TrackList            *m_pTrackList;           ///< The current track list
+    const MCParticleList       *m_pMCParticleList;      ///< The current mc particle list
+    const ClusterList          *m_pClusterList;         ///< The current cluster list
+    const PfoList              *m_pPfoList;             ///< The current pfo list
+    const VertexList           *m_pVertexList;          ///< The current vertex list
+    const PandoraSettings      *m_pPandoraSettings;     ///< The pandora settings instance
+    const GeometryManager      *m_pGeometryManager;     ///< The pandora geometry instance
+    const PluginManager        *m_pPluginManager;       ///< The pandora plugin instance
+    NameToCaloHitListMap        m_nameToCaloHitListMap;     ///< The named calo hit lists added to the view
+    NameToTrackListMap          m_nameToTrackListMap;       ///< The named track lists added to the view
+    NameToMCParticleListMap     m_nameToMCParticleListMap;  ///< The named mc particle lists added to the view
+    NameToClusterListMap        m_nameToClusterListMap;     ///< The named cluster lists added to the view
+    NameToPfoListMap            m_nameToPfoListMap;         ///< The named pfo lists added to the view
+    NameToVertexListMap         m_nameToVertexListMap;      ///< The named vertex lists added to the view
+};
+
+template <>
+StatusCode FrozenListView::AddList<CaloHitList>(const Algorithm &algorithm, const std::string &listName);
+template <>
+StatusCode FrozenListView::AddList<TrackList>(const Algorithm &algorithm, const std::string &listName);
+template <>
+StatusCode FrozenListView::AddList<MCParticleList>(const Algorithm &algorithm, const std::string &listName);
+template <>
+StatusCode FrozenListView::AddList<ClusterList>(const Algorithm &algorithm, const std::string &listName);
+template <>
+StatusCode FrozenListView::AddList<PfoList>(const Algorithm &algorithm, const std::string &listName);
+template <>
+StatusCode FrozenListView::AddList<VertexList>(const Algorithm &algorithm, const std::string &listName);
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline const CaloHitList &FrozenListView::GetCaloHitList() const
+{
+    return FrozenListView::GetList(m_pCaloHitList);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline const CaloHitList &FrozenListView::GetCaloHitList(const std::string &listName) const
+{
+    return FrozenListView::GetList(listName, m_nameToCaloHitListMap);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline const TrackList &FrozenListView::GetTrackList() const
+{
+    return FrozenListView::GetList(m_pTrackList);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline const TrackList &FrozenListView::GetTrackList(const std::string &listName) const
+{
+    return FrozenListView::GetList(listName, m_nameToTrackListMap);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline const MCParticleList &FrozenListView::GetMCParticleList() const
+{
+    return FrozenListView::GetList(m_pMCParticleList);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline const MCParticleList &FrozenListView::GetMCParticleList(const std::string &listName) const
+{
+    return FrozenListView::GetList(listName, m_nameToMCParticleListMap);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline const ClusterList &FrozenListView::GetClusterList() const
+{
+    return FrozenListView::GetList(m_pClusterList);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline const ClusterList &FrozenListView::GetClusterList(const std::string &listName) const
+{
+    return FrozenListView::GetList(listName, m_nameToClusterListMap);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline const PfoList &FrozenListView::GetPfoList() const
+{
+    return FrozenListView::GetList(m_pPfoList);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline const PfoList &FrozenListView::GetPfoList(const std::string &listName) const
+{
+    return FrozenListView::GetList(listName, m_nameToPfoListMap);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline const VertexList &FrozenListView::GetVertexList() const
+{
+    return FrozenListView::GetList(m_pVertexList);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline const VertexList &FrozenListView::GetVertexList(const std::string &listName) const
+{
+    return FrozenListView::GetList(listName, m_nameToVertexListMap);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline const PandoraSettings *FrozenListView::GetSettings() const
+{
+    return m_pPandoraSettings;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline const GeometryManager *FrozenListView::GetGeometry() const
+{
+    return m_pGeometryManager;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline const PluginManager *FrozenListView::GetPlugins() const
+{
+    return m_pPluginManager;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename T>
+inline const T &FrozenListView::GetList(const T *const pT)
+{
+    if (NULL == pT)
+        throw StatusCodeException(STATUS_CODE_NOT_INITIALIZED);
+
+    return *pT;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename T>
+inline const T &FrozenListView::GetList(const std::string &listName, const std::map<std::string, const T *> &nameToListMap)
+{
+    typename std::map<std::string, const T *>::const_iterator iter = nameToListMap.find(listName);
+
+    if (nameToListMap.end() == iter)
+        throw StatusCodeException(STATUS_CODE_NOT_FOUND);
+
+    return *(iter->second);
+}
+
+} // namespace pandora
+
+#endif // #ifndef PANDORA_FROZEN_LIST_VIEW_H
@@ -14,6 +14,7 @@ namespace pandora
 {
 
 class AlgorithmManager;
+class ApiRecorder;
 class CaloHitManager;
 class ClusterManager;
 class EnergyCorrectionsPlugin;
@@ -26,6 +27,8 @@ class PandoraSettings;
 class ParticleFlowObjectManager;
 class ParticleIdPlugin;
 class PluginManager;
+class ThreadPool;
+class TiXmlDocument;
 class TrackManager;
 class VertexManager;
 
@@ -48,14 +51,15 @@ public:
     ~Pandora();
 
     /**
-     *  @brief  Get the pandora api impl
+     *  @brief  Get the pandora api impl. Throws STATUS_CODE_NOT_ALLOWED whilst the content api is locked for read-only tasks, so that
+     *          client calls cannot modify the event under the running tasks.
      * 
      *  @return Address of the pandora api impl
      */
     const PandoraApiImpl *GetPandoraApiImpl() const;
 
     /**
-     *  @brief  Get the pandora content api impl
+     *  @brief  Get the pandora content api impl. Throws STATUS_CODE_NOT_ALLOWED whilst the content api is locked for read-only tasks.
      * 
      *  @return Address of the pandora content api impl
      */
@@ -82,6 +86,13 @@ public:
      */
     const PluginManager *GetPlugins() const;
 
+    /**
+     *  @brief  Get the pandora thread pool, used to distribute read-only work over several threads
+     * 
+     *  @return the address of the pandora thread pool
+     */
+    const ThreadPool *GetThreadPool() const;
+
 private:
     /**
      *  @brief  Prepare event, calculating properties of input objects for later use in algorithms
@@ -105,6 +116,13 @@ private:
      */
     StatusCode ReadSettings(const std::string &xmlFileName);
 
+    /**
+     *  @brief  Read pandora settings
+     * 
+     *  @param  xmlDocument the xml document containing the settings
+     */
+    StatusCode ReadSettings(TiXmlDocument &xmlDocument);
+
     AlgorithmManager            *m_pAlgorithmManager;           ///< The algorithm manager
     CaloHitManager              *m_pCaloHitManager;             ///< The hit manager
     ClusterManager              *m_pClusterManager;             ///< The cluster manager
@@ -116,10 +134,14 @@ private:
     VertexManager               *m_pVertexManager;              ///< The vertex manager
 
     PandoraSettings             *m_pPandoraSettings;            ///< The pandora settings instance
+    ThreadPool                  *m_pThreadPool;                 ///< The pandora thread pool
     PandoraApiImpl              *m_pPandoraApiImpl;             ///< The pandora api implementation
     PandoraContentApiImpl       *m_pPandoraContentApiImpl;      ///< The pandora content api implementation
     PandoraImpl                 *m_pPandoraImpl;                ///< The pandora implementation
+    ApiRecorder                 *m_pApiRecorder;                ///< The api recorder, if recording of api input calls is enabled
+    bool                         m_isContentApiLocked;          ///< Whether the content api is locked, whilst read-only tasks are running
 
+    friend class ApiReplayer;
     friend class PandoraApiImpl;
     friend class PandoraContentApiImpl;
     friend class PandoraImpl;
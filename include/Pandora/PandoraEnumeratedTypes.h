@@ -136,6 +136,21 @@ enum Granularity
     VERY_COARSE
 };
 
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+/**
+ *  @brief  Cluster property enum, identifying the plugin-evaluated cluster properties that can be prepared for a list of clusters.
+ *          Values may be combined with bitwise or.
+ */
+enum ClusterProperty
+{
+    CLUSTER_ENERGY_CORRECTIONS = 1 << 0,
+    CLUSTER_FAST_PHOTON_FLAG = 1 << 1,
+    CLUSTER_SHOWER_START_LAYER = 1 << 2,
+    CLUSTER_SHOWER_PROFILE = 1 << 3,
+    ALL_CLUSTER_PROPERTIES = (1 << 4) - 1
+};
+
 } // namespace pandora
 
 #endif // #ifndef PANDORA_ENUMERATED_TYPES_H
@@ -11,6 +11,10 @@
 namespace pandora
 {
 
+class EventResourceReport;
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 /**
  *  @brief  PandoraImpl class
  */
@@ -19,14 +23,32 @@ class PandoraImpl
 private:
     /**
      *  @brief  Prepare mc particles: select mc pfo targets, match tracks and calo hits to the correct mc
-     *          particles for particle flow
+     *          particles for particle flow. Depending upon the pandora settings, this stage may be skipped or
+     *          deferred until requested by an algorithm.
      */
-    StatusCode PrepareMCParticles() const;
+    StatusCode PrepareMCParticles();
 
     /**
-     *  @brief  Prepare tracks: add track associations (parent-daughter and sibling)
+     *  @brief  Prepare tracks: create the input track list and add track associations (parent-daughter and sibling).
+     *          Depending upon the pandora settings, the association stage may be skipped or deferred until requested
+     *          by an algorithm.
      */
-    StatusCode PrepareTracks() const;
+    StatusCode PrepareTracks();
+
+    /**
+     *  @brief  Perform any mc particle preparation that has been deferred for the current event
+     */
+    StatusCode PrepareMCParticlesIfPending();
+
+    /**
+     *  @brief  Perform any track association that has been deferred for the current event
+     */
+    StatusCode AssociateTracksIfPending();
+
+    /**
+     *  @brief  Select mc pfo targets, match tracks and calo hits to the correct mc particles for particle flow
+     */
+    StatusCode PerformMCParticlePreparation() const;
 
     /**
      *  @brief  Prepare calo hits: order the hits by pseudo layer, calculate density weights, identify
@@ -72,7 +94,77 @@ private:
     /**
      *  @brief  Ï event, calling manager reset functions and any registered reset functions
      */
-    StatusCode ResetEvent() const;
+    StatusCode ResetEvent();
+
+    /**
+     *  @brief  Advance the sliding window used for continuous readout, in place of the event reset. Calo hits with times at or after
+     *          the window start time are retained, together with the clusters in saved lists that consist solely of such calo hits.
+     *          All other objects are deleted, as for the event reset.
+     * 
+     *  @param  windowStartTime the start time of the sliding window
+     */
+    StatusCode AdvanceSlidingWindow(const float windowStartTime);
+
+    /**
+     *  @brief  Reset the per-event state and the managers, in a single order shared by the event reset and the sliding window advance
+     * 
+     *  @param  isNewWindow whether to retain the calo hits and clusters within a new sliding window, rather than reset the whole event
+     *  @param  windowStartTime the start time of the sliding window, used only if advancing the sliding window
+     */
+    StatusCode ResetEventContent(const bool isNewWindow, const float windowStartTime);
+
+    /**
+     *  @brief  Get the resource report for the current event
+     * 
+     *  @param  eventResourceReport to receive the event resource report
+     */
+    StatusCode GetEventResourceReport(EventResourceReport &eventResourceReport) const;
+
+    /**
+     *  @brief  Print the resource report for the current event if it exceeds either of the thresholds specified in the pandora settings
+     */
+    StatusCode PrintEventResourceReportIfRequired() const;
+
+    /**
+     *  @brief  Add a pandora instance to reconstruct a region of each event, in isolated manager state
+     * 
+     *  @param  pRegionPandora address of the region pandora instance
+     */
+    StatusCode AddRegionInstance(const Pandora *const pRegionPandora);
+
+    /**
+     *  @brief  Get the region pandora instance to which an input object should be passed, as chosen by the region partition plugin
+     * 
+     *  @param  parameters the input object parameters
+     *  @param  pRegionPandora to receive the address of the region pandora instance, or NULL if no region instances have been added
+     */
+    template <typename PARAMETERS>
+    StatusCode GetRegionInstance(const PARAMETERS &parameters, const Pandora *&pRegionPandora) const;
+
+    /**
+     *  @brief  Get the region pandora instance to which the calo hit with a specified parent address was passed
+     * 
+     *  @param  pCaloHitParentAddress address of the parent calo hit in the user framework
+     * 
+     *  @return address of the region pandora instance, or NULL if the calo hit was not passed to a region instance
+     */
+    const Pandora *GetCaloHitRegionInstance(const void *const pCaloHitParentAddress) const;
+
+    /**
+     *  @brief  Get the region pandora instance to which the track with a specified parent address was passed
+     * 
+     *  @param  pTrackParentAddress address of the parent track in the user framework
+     * 
+     *  @return address of the region pandora instance, or NULL if the track was not passed to a region instance
+     */
+    const Pandora *GetTrackRegionInstance(const void *const pTrackParentAddress) const;
+
+    /**
+     *  @brief  Process the current event in each region pandora instance, concurrently, then transfer the current pfos from each
+     *          successfully processed region to the region pfo list, which becomes the current pfo list. Regions that fail are
+     *          reported and contribute no pfos.
+     */
+    StatusCode ProcessRegions() const;
 
     /**
      *  @brief  Constructor
@@ -81,9 +173,24 @@ private:
      */
     PandoraImpl(Pandora *const pPandora);
 
-    Pandora                *m_pPandora;             ///< The pandora object to provide an interface to
+    class RegionProcessingTask;
+    typedef std::vector<const Pandora *> PandoraVector;
+    typedef std::vector<StatusCode> StatusCodeVector;
+    typedef std::LOOKUP_CONTAINER<const void *, const Pandora *> AddressToPandoraMap;
+
+    Pandora                *m_pPandora;                             ///< The pandora object to provide an interface to
+    bool                    m_isMCParticlePreparationPending;       ///< Whether mc particle preparation is deferred for the current event
+    bool                    m_isTrackAssociationPending;            ///< Whether track association is deferred for the current event
+    PandoraVector           m_regionPandoraVector;                  ///< The region pandora instances, indexed by region
+    const Pandora          *m_pPrimaryPandora;                      ///< The primary pandora instance, if this is a region instance
+    AddressToPandoraMap     m_caloHitRegionMap;                     ///< The region instances to which calo hits were passed, by parent address
+    AddressToPandoraMap     m_trackRegionMap;                       ///< The region instances to which tracks were passed, by parent address
+
+    static const std::string REGION_PFO_LIST_NAME;                  ///< The name of the list holding the merged region pfos
 
     friend class Pandora;
+    friend class PandoraApiImpl;
+    friend class PandoraContentApiImpl;
 };
 
 } // namespace pandora
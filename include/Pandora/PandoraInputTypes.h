@@ -16,14 +16,21 @@
 #include "Pandora/StatusCodes.h"
 
 #include <cmath>
+#include <new>
 #include <string>
 #include <vector>
 
+#if __cplusplus > 199711L
+    #include <type_traits>
+    #include <utility>
+#endif
+
 namespace pandora
 {
 
 /**
- *  @brief  PandoraInputType template class
+ *  @brief  PandoraInputType template class. The value is held in storage within the pandora type itself, so setting, copying
+ *          and resetting the pandora type never allocate memory, beyond any allocation made by the held type itself.
  */
 template <typename T>
 class PandoraInputType
@@ -47,12 +54,21 @@ public:
     PandoraInputType(const T &t);
 
     /**
-     *  @brief  Copy constructor (EXPENSIVE WITH LARGE OBJECTS)
+     *  @brief  Copy constructor
      * 
      *  @param  rhs the initial pandora type
      */
     PandoraInputType(const PandoraInputType<T> &rhs);
 
+#if __cplusplus > 199711L
+    /**
+     *  @brief  Move constructor, leaving rhs uninitialized
+     * 
+     *  @param  rhs the initial pandora type
+     */
+    PandoraInputType(PandoraInputType<T> &&rhs);
+#endif
+
     /**
      *  @brief  Set the value held by the pandora type
      *
@@ -60,6 +76,15 @@ public:
      */
     void Set(const T &t);
 
+#if __cplusplus > 199711L
+    /**
+     *  @brief  Set the value held by the pandora type, moving from the provided value
+     *
+     *  @param  t the value
+     */
+    void Set(T &&t);
+#endif
+
     /**
      *  @brief  Get the value held by the pandora type
      *
@@ -87,12 +112,28 @@ public:
     bool operator= (const T &rhs); 
 
     /**
-     *  @brief  Assignment operator for parent pandora type (EXPENSIVE WITH LARGE OBJECTS)
+     *  @brief  Assignment operator for parent pandora type
      * 
      *  @throw  status code exception
      */   
     bool operator= (const PandoraInputType<T> &rhs);
 
+#if __cplusplus > 199711L
+    /**
+     *  @brief  Move assignment operator for the pandora type
+     * 
+     *  @return whether assignment succeeded
+     */
+    bool operator= (T &&rhs); 
+
+    /**
+     *  @brief  Move assignment operator for parent pandora type, leaving rhs uninitialized
+     * 
+     *  @throw  status code exception
+     */   
+    bool operator= (PandoraInputType<T> &&rhs);
+#endif
+
 private:
     /**
      *  @brief  Whether pandora type is valid (not inf or nan)
@@ -101,8 +142,34 @@ private:
      */
     bool IsValid(const T &t) const;
 
-    T      *m_pValue;           ///< Address of the actual value being held by the pandora type
-    bool    m_isInitialized;    ///< Whether the pandora type is initialized
+    /**
+     *  @brief  Get the address of the value storage
+     * 
+     *  @return the address of the value storage
+     */
+    T *GetAddress();
+
+    /**
+     *  @brief  Get the address of the value storage
+     * 
+     *  @return the address of the value storage
+     */
+    const T *GetAddress() const;
+
+#if __cplusplus > 199711L
+    typedef typename std::aligned_storage<sizeof(T), alignof(T)>::type Storage;
+#else
+    union Storage
+    {
+        char        m_bytes[sizeof(T)];     ///< The value bytes
+        double      m_double;               ///< Member ensuring suitable alignment
+        long        m_long;                 ///< Member ensuring suitable alignment
+        void       *m_pPointer;             ///< Member ensuring suitable alignment
+    };
+#endif
+
+    Storage     m_storage;          ///< The storage for the value held by the pandora type, valid only if initialized
+    bool        m_isInitialized;    ///< Whether the pandora type is initialized
 };
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -134,7 +201,7 @@ typedef std::vector<CaloHitAddressList> ClusterAddressList;
 
 template <typename T>
 inline PandoraInputType<T>::PandoraInputType() :
-    m_pValue(NULL),
+    m_storage(),
     m_isInitialized(false)
 {
 }
@@ -144,44 +211,82 @@ inline PandoraInputType<T>::PandoraInputType() :
 template <typename T>
 inline PandoraInputType<T>::~PandoraInputType()
 {
-    if (NULL != m_pValue)
-        delete m_pValue;
+    this->Reset();
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 template <typename T>
 inline PandoraInputType<T>::PandoraInputType(const T &t) :
-    m_pValue(new T(t)),
     m_isInitialized(true)
 {
+    new (this->GetAddress()) T(t);
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 template <typename T>
 inline PandoraInputType<T>::PandoraInputType(const PandoraInputType<T> &rhs) :
-    m_pValue(NULL),
     m_isInitialized(rhs.m_isInitialized)
 {
     if (rhs.m_isInitialized)
-        m_pValue = new T(*rhs.m_pValue);
+        new (this->GetAddress()) T(*rhs.GetAddress());
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+#if __cplusplus > 199711L
+template <typename T>
+inline PandoraInputType<T>::PandoraInputType(PandoraInputType<T> &&rhs) :
+    m_isInitialized(rhs.m_isInitialized)
+{
+    if (rhs.m_isInitialized)
+    {
+        new (this->GetAddress()) T(std::move(*rhs.GetAddress()));
+        rhs.Reset();
+    }
+}
+#endif
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 template <typename T>
 inline void PandoraInputType<T>::Set(const T &t)
 {
+    if (!this->IsValid(t))
+        throw StatusCodeException(STATUS_CODE_INVALID_PARAMETER);
+
     if (m_isInitialized)
-        delete m_pValue;
+    {
+        *this->GetAddress() = t;
+    }
+    else
+    {
+        new (this->GetAddress()) T(t);
+        m_isInitialized = true;
+    }
+}
 
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+#if __cplusplus > 199711L
+template <typename T>
+inline void PandoraInputType<T>::Set(T &&t)
+{
     if (!this->IsValid(t))
         throw StatusCodeException(STATUS_CODE_INVALID_PARAMETER);
 
-    m_pValue = new T(t);
-    m_isInitialized = true;
+    if (m_isInitialized)
+    {
+        *this->GetAddress() = std::move(t);
+    }
+    else
+    {
+        new (this->GetAddress()) T(std::move(t));
+        m_isInitialized = true;
+    }
 }
+#endif
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
@@ -191,7 +296,7 @@ inline const T &PandoraInputType<T>::Get() const
     if (!m_isInitialized)
         throw StatusCodeException(STATUS_CODE_NOT_INITIALIZED);
 
-    return *m_pValue;
+    return *this->GetAddress();
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -199,11 +304,10 @@ inline const T &PandoraInputType<T>::Get() const
 template <typename T>
 inline void PandoraInputType<T>::Reset()
 {
-    if (NULL != m_pValue)
-        delete m_pValue;
+    if (m_isInitialized)
+        this->GetAddress()->~T();
 
     m_isInitialized = false;
-    m_pValue = NULL;
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -233,7 +337,7 @@ inline bool PandoraInputType<T>::operator= (const PandoraInputType<T> &rhs)
 
     if (rhs.m_isInitialized)
     {
-        this->Set(*rhs.m_pValue);
+        this->Set(*rhs.GetAddress());
     }
     else
     {
@@ -245,6 +349,54 @@ inline bool PandoraInputType<T>::operator= (const PandoraInputType<T> &rhs)
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+#if __cplusplus > 199711L
+template <typename T>
+inline bool PandoraInputType<T>::operator= (T &&rhs)
+{
+    this->Set(std::move(rhs));
+    return m_isInitialized;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename T>
+inline bool PandoraInputType<T>::operator= (PandoraInputType<T> &&rhs)
+{
+    if (this == &rhs)
+        return m_isInitialized;
+
+    if (rhs.m_isInitialized)
+    {
+        this->Set(std::move(*rhs.GetAddress()));
+        rhs.Reset();
+    }
+    else
+    {
+        this->Reset();
+    }
+
+    return m_isInitialized;
+}
+#endif
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename T>
+inline T *PandoraInputType<T>::GetAddress()
+{
+    return reinterpret_cast<T *>(&m_storage);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename T>
+inline const T *PandoraInputType<T>::GetAddress() const
+{
+    return reinterpret_cast<const T *>(&m_storage);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 #ifdef _MSC_VER
     #include <float.h>
     #define IS_NAN _isnan
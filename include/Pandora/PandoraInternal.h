@@ -16,10 +16,13 @@
 #include <vector>
 
 #if __cplusplus > 199711L
+    #include <unordered_map>
     #include <unordered_set>
     #define MANAGED_CONTAINER unordered_set
+    #define LOOKUP_CONTAINER unordered_map
 #else
     #define MANAGED_CONTAINER set
+    #define LOOKUP_CONTAINER map
 #endif
 
 #include <stdint.h>
@@ -45,6 +48,7 @@ class OrderedCaloHitList;
 class ParticleFlowObject;
 class ParticleIdPlugin;
 class PseudoLayerPlugin;
+class RegionPartitionPlugin;
 class ShowerProfilePlugin;
 class SubDetector;
 class Track;
@@ -155,6 +159,135 @@ inline bool PointerLessThan<T>::operator()(const T *lhs, const T *rhs) const
     return (*lhs < *rhs);
 }
 
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+/**
+ *  @brief  LazyContainer class, holding a container that is only allocated once it is first modified. Objects with several,
+ *          typically empty, relationship containers then carry a single pointer for each, rather than a full container.
+ */
+template <typename T>
+class LazyContainer
+{
+public:
+    /**
+     *  @brief  Default constructor
+     */
+    LazyContainer();
+
+    /**
+     *  @brief  Copy constructor
+     * 
+     *  @param  rhs the lazy container to copy
+     */
+    LazyContainer(const LazyContainer &rhs);
+
+    /**
+     *  @brief  Destructor
+     */
+    ~LazyContainer();
+
+    /**
+     *  @brief  Assignment operator
+     * 
+     *  @param  rhs the lazy container to assign
+     */
+    LazyContainer &operator=(const LazyContainer &rhs);
+
+    /**
+     *  @brief  Get the container, which is a shared empty instance if the container has not yet been allocated
+     * 
+     *  @return the container
+     */
+    const T &Get() const;
+
+    /**
+     *  @brief  Get the container for modification, allocating it if required
+     * 
+     *  @return the container
+     */
+    T &GetModifiable();
+
+    /**
+     *  @brief  Clear the container, releasing its memory
+     */
+    void Clear();
+
+private:
+    T                  *m_pContainer;           ///< Address of the container, null until first modified
+    static const T      m_emptyContainer;       ///< The shared empty container
+};
+
+template <typename T>
+const T LazyContainer<T>::m_emptyContainer;
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename T>
+inline LazyContainer<T>::LazyContainer() :
+    m_pContainer(NULL)
+{
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename T>
+inline LazyContainer<T>::LazyContainer(const LazyContainer &rhs) :
+    m_pContainer((NULL != rhs.m_pContainer) ? new T(*rhs.m_pContainer) : NULL)
+{
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename T>
+inline LazyContainer<T>::~LazyContainer()
+{
+    delete m_pContainer;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename T>
+inline LazyContainer<T> &LazyContainer<T>::operator=(const LazyContainer &rhs)
+{
+    if (this != &rhs)
+    {
+        T *const pContainer((NULL != rhs.m_pContainer) ? new T(*rhs.m_pContainer) : NULL);
+        delete m_pContainer;
+        m_pContainer = pContainer;
+    }
+
+    return *this;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename T>
+inline const T &LazyContainer<T>::Get() const
+{
+    return ((NULL != m_pContainer) ? *m_pContainer : m_emptyContainer);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename T>
+inline T &LazyContainer<T>::GetModifiable()
+{
+    if (NULL == m_pContainer)
+        m_pContainer = new T;
+
+    return *m_pContainer;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename T>
+inline void LazyContainer<T>::Clear()
+{
+    delete m_pContainer;
+    m_pContainer = NULL;
+}
+
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 typedef std::MANAGED_CONTAINER<const CaloHit *> CaloHitList;
@@ -180,15 +313,20 @@ typedef std::vector<AlgorithmTool *> AlgorithmToolList;
 typedef std::set<std::string> StringSet;
 typedef std::vector<std::string> StringVector;
 typedef std::vector<int> IntVector;
+typedef std::vector<unsigned int> UIntVector;
+typedef std::vector<bool> BoolVector;
 typedef std::vector<float> FloatVector;
 typedef std::vector<CartesianVector> CartesianPointList;
 typedef std::vector<TrackState> TrackStateList;
 
+typedef unsigned int ListHandle;
+typedef std::vector<ListHandle> ListHandleVector;
+
 typedef const void * Uid;
-typedef std::map<Uid, const MCParticle *> UidToMCParticleMap;
+typedef std::LOOKUP_CONTAINER<Uid, const MCParticle *> UidToMCParticleMap;
 
 typedef std::map<const MCParticle *, float> MCParticleWeightMap;
-typedef std::map<Uid, MCParticleWeightMap> UidToMCParticleWeightMap;
+typedef std::LOOKUP_CONTAINER<Uid, MCParticleWeightMap> UidToMCParticleWeightMap;
 
 typedef std::map<const Cluster *, const Track * > ClusterToTrackMap;
 typedef std::map<const Track *, const Cluster * > TrackToClusterMap;
@@ -71,6 +71,48 @@ public:
      */
     bool UseSingleMCParticleAssociation() const;
 
+    /**
+     *  @brief  Whether to prepare mc particles (pfo target selection and matching of calo hits and tracks to pfo targets)
+     * 
+     *  @return boolean
+     */
+    bool ShouldPrepareMCParticles() const;
+
+    /**
+     *  @brief  Whether to defer mc particle preparation until requested via PandoraContentApi::CompleteEventPreparation
+     * 
+     *  @return boolean
+     */
+    bool ShouldPrepareMCParticlesOnDemand() const;
+
+    /**
+     *  @brief  Whether to add track parent-daughter and sibling associations
+     * 
+     *  @return boolean
+     */
+    bool ShouldAssociateTracks() const;
+
+    /**
+     *  @brief  Whether to defer track association until requested via PandoraContentApi::CompleteEventPreparation
+     * 
+     *  @return boolean
+     */
+    bool ShouldAssociateTracksOnDemand() const;
+
+    /**
+     *  @brief  Whether to retain the capacity of the input lists when the event is reset, for reuse in the next event
+     * 
+     *  @return boolean
+     */
+    bool ShouldRetainInputListCapacity() const;
+
+    /**
+     *  @brief  Whether status code exceptions should capture a back trace, in builds with back traces enabled
+     * 
+     *  @return boolean
+     */
+    bool ShouldCaptureExceptionBackTrace() const;
+
     /**
      *  @brief  Get the electromagnetic energy resolution as a fraction, X, such that sigmaE = ( X * E / sqrt(E) )
      * 
@@ -113,6 +155,27 @@ public:
      */
     float GetGapTolerance() const;
 
+    /**
+     *  @brief  Get the number of threads, including the calling thread, in the pandora thread pool
+     * 
+     *  @return the number of threads
+     */
+    unsigned int GetNThreads() const;
+
+    /**
+     *  @brief  Get the peak number of live objects in an event above which the event resource report is printed, zero to disable
+     * 
+     *  @return the resource report object threshold
+     */
+    unsigned int GetResourceReportObjectThreshold() const;
+
+    /**
+     *  @brief  Get the estimated peak memory use in an event above which the event resource report is printed, units MB, zero to disable
+     * 
+     *  @return the resource report memory threshold
+     */
+    float GetResourceReportMemoryThreshold() const;
+
 private:
     /**
      *  @brief  Initialize pandora settings
@@ -133,6 +196,12 @@ private:
     bool     m_singleHitTypeClusteringMode;                 ///< Whether to allow only single hit types in individual clusters
     bool     m_shouldCollapseMCParticlesToPfoTarget;        ///< Whether to collapse mc particle decay chains down to just the pfo target
     bool     m_useSingleMCParticleAssociation;              ///< Whether to allow only single mc particle association to objects (largest weight)
+    bool     m_shouldPrepareMCParticles;                    ///< Whether to prepare mc particles
+    bool     m_shouldPrepareMCParticlesOnDemand;            ///< Whether to defer mc particle preparation until requested by an algorithm
+    bool     m_shouldAssociateTracks;                       ///< Whether to add track parent-daughter and sibling associations
+    bool     m_shouldAssociateTracksOnDemand;               ///< Whether to defer track association until requested by an algorithm
+    bool     m_shouldRetainInputListCapacity;               ///< Whether to retain the input list capacity when the event is reset
+    bool     m_shouldCaptureExceptionBackTrace;             ///< Whether status code exceptions should capture a back trace
 
     float    m_electromagneticEnergyResolution;             ///< Electromagnetic energy resolution, X, such that sigmaE = ( X * E / sqrt(E) )
     float    m_hadronicEnergyResolution;                    ///< Hadronic energy resolution, X, such that sigmaE = ( X * E / sqrt(E) )
@@ -141,6 +210,9 @@ private:
     float    m_mcPfoSelectionLowEnergyNPCutOff;             ///< Low energy cut-off for selection of protons/neutrons as MCPFOs
 
     float    m_gapTolerance;                                ///< Tolerance allowed when declaring a point to be "in" a gap region, units mm
+    unsigned int m_nThreads;                                ///< The number of threads, including the calling thread, in the pandora thread pool
+    unsigned int m_resourceReportObjectThreshold;           ///< The peak number of live objects above which the event resource report is printed
+    float    m_resourceReportMemoryThreshold;               ///< The estimated peak memory above which the event resource report is printed, units MB
 
     const Pandora *const m_pPandora;                        ///< The associated pandora object
 
@@ -185,6 +257,48 @@ inline bool PandoraSettings::UseSingleMCParticleAssociation() const
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+inline bool PandoraSettings::ShouldPrepareMCParticles() const
+{
+    return m_shouldPrepareMCParticles;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline bool PandoraSettings::ShouldPrepareMCParticlesOnDemand() const
+{
+    return m_shouldPrepareMCParticlesOnDemand;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline bool PandoraSettings::ShouldAssociateTracks() const
+{
+    return m_shouldAssociateTracks;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline bool PandoraSettings::ShouldAssociateTracksOnDemand() const
+{
+    return m_shouldAssociateTracksOnDemand;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline bool PandoraSettings::ShouldRetainInputListCapacity() const
+{
+    return m_shouldRetainInputListCapacity;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline bool PandoraSettings::ShouldCaptureExceptionBackTrace() const
+{
+    return m_shouldCaptureExceptionBackTrace;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 inline float PandoraSettings::GetElectromagneticEnergyResolution() const
 {
     return m_electromagneticEnergyResolution;
@@ -225,6 +339,27 @@ inline float PandoraSettings::GetGapTolerance() const
     return m_gapTolerance;
 }
 
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline unsigned int PandoraSettings::GetNThreads() const
+{
+    return m_nThreads;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline unsigned int PandoraSettings::GetResourceReportObjectThreshold() const
+{
+    return m_resourceReportObjectThreshold;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline float PandoraSettings::GetResourceReportMemoryThreshold() const
+{
+    return m_resourceReportMemoryThreshold;
+}
+
 } // namespace pandora
 
 #endif // #ifndef PANDORA_SETTINGS_H
@@ -0,0 +1,333 @@
+/**
+ *  @file   PandoraSDK/include/Pandora/PfoExportBuffer.h
+ *
+ *  @brief  Header file for the pfo export buffer class.
+ *
+ *  $Log: $
+ */
+#ifndef PANDORA_PFO_EXPORT_BUFFER_H
+#define PANDORA_PFO_EXPORT_BUFFER_H 1
+
+#include "Pandora/PandoraInternal.h"
+#include "Pandora/StatusCodes.h"
+
+namespace pandora
+{
+
+/**
+ *  @brief  PfoExportBuffer class, holding a flat, contiguous copy of a list of particle flow objects for transfer to a client framework.
+ *          Each pfo is identified by its index in the buffer. The pfo properties are held in per-pfo arrays. Each relationship is held
+ *          in compressed sparse row form: the entries for pfo i occupy [offsets[i], offsets[i + 1]) of the corresponding entry array.
+ *          Clusters are identified by their index in the buffer, calo hits and tracks by their parent (client) addresses. A buffer
+ *          may be reused from event to event, in which case its arrays retain their capacity.
+ */
+class PfoExportBuffer
+{
+public:
+    typedef std::vector<const void *> AddressVector;
+
+    /**
+     *  @brief  Default constructor
+     */
+    PfoExportBuffer();
+
+    /**
+     *  @brief  Get the number of pfos in the buffer
+     *
+     *  @return the number of pfos
+     */
+    unsigned int GetNPfos() const;
+
+    /**
+     *  @brief  Get the number of clusters in the buffer
+     *
+     *  @return the number of clusters
+     */
+    unsigned int GetNClusters() const;
+
+    /**
+     *  @brief  Get the pfo particle ids, by pfo index
+     *
+     *  @return the pfo particle ids
+     */
+    const IntVector &GetParticleIds() const;
+
+    /**
+     *  @brief  Get the pfo charges, by pfo index
+     *
+     *  @return the pfo charges
+     */
+    const IntVector &GetCharges() const;
+
+    /**
+     *  @brief  Get the pfo masses, by pfo index
+     *
+     *  @return the pfo masses
+     */
+    const FloatVector &GetMasses() const;
+
+    /**
+     *  @brief  Get the pfo energies, by pfo index
+     *
+     *  @return the pfo energies
+     */
+    const FloatVector &GetEnergies() const;
+
+    /**
+     *  @brief  Get the pfo momentum x components, by pfo index
+     *
+     *  @return the pfo momentum x components
+     */
+    const FloatVector &GetMomentumX() const;
+
+    /**
+     *  @brief  Get the pfo momentum y components, by pfo index
+     *
+     *  @return the pfo momentum y components
+     */
+    const FloatVector &GetMomentumY() const;
+
+    /**
+     *  @brief  Get the pfo momentum z components, by pfo index
+     *
+     *  @return the pfo momentum z components
+     */
+    const FloatVector &GetMomentumZ() const;
+
+    /**
+     *  @brief  Get the offsets of each pfo's clusters in the cluster index range, with number of pfos + 1 entries
+     *
+     *  @return the pfo cluster offsets
+     */
+    const UIntVector &GetPfoClusterOffsets() const;
+
+    /**
+     *  @brief  Get the offsets of each cluster's calo hits in the calo hit address array, with number of clusters + 1 entries
+     *
+     *  @return the cluster calo hit offsets
+     */
+    const UIntVector &GetClusterCaloHitOffsets() const;
+
+    /**
+     *  @brief  Get the parent addresses of the calo hits in each cluster, including isolated calo hits, by cluster
+     *
+     *  @return the calo hit parent addresses
+     */
+    const AddressVector &GetCaloHitAddresses() const;
+
+    /**
+     *  @brief  Get the offsets of each pfo's tracks in the track address array, with number of pfos + 1 entries
+     *
+     *  @return the pfo track offsets
+     */
+    const UIntVector &GetPfoTrackOffsets() const;
+
+    /**
+     *  @brief  Get the parent addresses of the tracks in each pfo, by pfo
+     *
+     *  @return the track parent addresses
+     */
+    const AddressVector &GetTrackAddresses() const;
+
+    /**
+     *  @brief  Get the offsets of each pfo's parents in the parent pfo index array, with number of pfos + 1 entries
+     *
+     *  @return the pfo parent offsets
+     */
+    const UIntVector &GetPfoParentOffsets() const;
+
+    /**
+     *  @brief  Get the indices of the parents of each pfo, by pfo. Parents absent from the exported list are omitted.
+     *
+     *  @return the parent pfo indices
+     */
+    const UIntVector &GetParentPfoIndices() const;
+
+    /**
+     *  @brief  Get the offsets of each pfo's daughters in the daughter pfo index array, with number of pfos + 1 entries
+     *
+     *  @return the pfo daughter offsets
+     */
+    const UIntVector &GetPfoDaughterOffsets() const;
+
+    /**
+     *  @brief  Get the indices of the daughters of each pfo, by pfo. Daughters absent from the exported list are omitted.
+     *
+     *  @return the daughter pfo indices
+     */
+    const UIntVector &GetDaughterPfoIndices() const;
+
+private:
+    /**
+     *  @brief  Replace the buffer contents with a flat copy of a pfo list
+     *
+     *  @param  pfoList the pfo list
+     */
+    void Fill(const PfoList &pfoList);
+
+    /**
+     *  @brief  Remove all contents from the buffer, retaining the capacity of its arrays
+     */
+    void Clear();
+
+    /**
+     *  @brief  Append the indices of those pfos in a related pfo list that are present in the buffer
+     *
+     *  @param  relatedPfoList the related pfo list
+     *  @param  pfoIndices the pfo index array to receive the indices
+     */
+    void AppendPfoIndices(const PfoList &relatedPfoList, UIntVector &pfoIndices) const;
+
+    typedef std::pair<const ParticleFlowObject *, unsigned int> PfoIndexPair;
+    typedef std::vector<PfoIndexPair> PfoIndexVector;
+
+    IntVector           m_particleIds;              ///< The pfo particle ids
+    IntVector           m_charges;                  ///< The pfo charges
+    FloatVector         m_masses;                   ///< The pfo masses
+    FloatVector         m_energies;                 ///< The pfo energies
+    FloatVector         m_momentumX;                ///< The pfo momentum x components
+    FloatVector         m_momentumY;                ///< The pfo momentum y components
+    FloatVector         m_momentumZ;                ///< The pfo momentum z components
+    UIntVector          m_pfoClusterOffsets;        ///< The pfo cluster offsets
+    UIntVector          m_clusterCaloHitOffsets;    ///< The cluster calo hit offsets
+    AddressVector       m_caloHitAddresses;         ///< The calo hit parent addresses
+    UIntVector          m_pfoTrackOffsets;          ///< The pfo track offsets
+    AddressVector       m_trackAddresses;           ///< The track parent addresses
+    UIntVector          m_pfoParentOffsets;         ///< The pfo parent offsets
+    UIntVector          m_parentPfoIndices;         ///< The parent pfo indices
+    UIntVector          m_pfoDaughterOffsets;       ///< The pfo daughter offsets
+    UIntVector          m_daughterPfoIndices;       ///< The daughter pfo indices
+    PfoIndexVector      m_pfoIndices;               ///< The pfo indices, sorted by pfo address, used to resolve pfo relationships
+
+    friend class PandoraApiImpl;
+};
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline unsigned int PfoExportBuffer::GetNPfos() const
+{
+    return m_particleIds.size();
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline unsigned int PfoExportBuffer::GetNClusters() const
+{
+    return (m_clusterCaloHitOffsets.empty() ? 0 : m_clusterCaloHitOffsets.size() - 1);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline const IntVector &PfoExportBuffer::GetParticleIds() const
+{
+    return m_particleIds;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline const IntVector &PfoExportBuffer::GetCharges() const
+{
+    return m_charges;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline const FloatVector &PfoExportBuffer::GetMasses() const
+{
+    return m_masses;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline const FloatVector &PfoExportBuffer::GetEnergies() const
+{
+    return m_energies;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline const FloatVector &PfoExportBuffer::GetMomentumX() const
+{
+    return m_momentumX;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline const FloatVector &PfoExportBuffer::GetMomentumY() const
+{
+    return m_momentumY;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline const FloatVector &PfoExportBuffer::GetMomentumZ() const
+{
+    return m_momentumZ;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline const UIntVector &PfoExportBuffer::GetPfoClusterOffsets() const
+{
+    return m_pfoClusterOffsets;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline const UIntVector &PfoExportBuffer::GetClusterCaloHitOffsets() const
+{
+    return m_clusterCaloHitOffsets;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline const PfoExportBuffer::AddressVector &PfoExportBuffer::GetCaloHitAddresses() const
+{
+    return m_caloHitAddresses;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline const UIntVector &PfoExportBuffer::GetPfoTrackOffsets() const
+{
+    return m_pfoTrackOffsets;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline const PfoExportBuffer::AddressVector &PfoExportBuffer::GetTrackAddresses() const
+{
+    return m_trackAddresses;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline const UIntVector &PfoExportBuffer::GetPfoParentOffsets() const
+{
+    return m_pfoParentOffsets;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline const UIntVector &PfoExportBuffer::GetParentPfoIndices() const
+{
+    return m_parentPfoIndices;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline const UIntVector &PfoExportBuffer::GetPfoDaughterOffsets() const
+{
+    return m_pfoDaughterOffsets;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline const UIntVector &PfoExportBuffer::GetDaughterPfoIndices() const
+{
+    return m_daughterPfoIndices;
+}
+
+} // namespace pandora
+
+#endif // #ifndef PANDORA_PFO_EXPORT_BUFFER_H
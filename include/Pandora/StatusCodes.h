@@ -10,10 +10,10 @@
 
 #include <exception>
 #include <string>
+#include <vector>
 
-#if defined(__GNUC__) && defined(BACKTRACE)
-    #include <cstdlib>
-    #include <execinfo.h>
+#if __cplusplus > 199711L
+    #include <atomic>
 #endif
 
 #define PANDORA_RETURN_RESULT_IF(StatusCode1, Operator, Command)                                        \
@@ -113,7 +113,8 @@ std::string StatusCodeToString(const StatusCode statusCode);
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 /**
- *  @brief  StatusCodeException class
+ *  @brief  StatusCodeException class. When built with BACKTRACE (gcc only), the raw return addresses are captured at construction and
+ *          only symbolised if the back trace is requested.
  */
 class StatusCodeException
 {
@@ -145,40 +146,63 @@ public:
     std::string ToString() const;
 
     /**
-     *  @brief  Get back trace at point of exception construction (gcc only)
+     *  @brief  Get back trace at point of exception construction (gcc only), symbolised on first request
      * 
      *  @return The back trace
      */
     const std::string &GetBackTrace() const;
 
-private:
-    const StatusCode    m_statusCode;   ///< The status code
-    std::string         m_backTrace;    ///< The back trace
-};
+    /**
+     *  @brief  Set whether subsequently constructed exceptions should capture a back trace. This is a process-wide setting.
+     * 
+     *  @param  shouldCaptureBackTrace whether to capture back traces
+     */
+    static void SetShouldCaptureBackTrace(const bool shouldCaptureBackTrace);
 
-//------------------------------------------------------------------------------------------------------------------------------------------
+    /**
+     *  @brief  Get the number of status code exceptions constructed in this process, for use in instrumentation
+     * 
+     *  @return the number of status code exceptions constructed
+     */
+    static unsigned int GetNExceptionsThrown();
 
-inline StatusCodeException::StatusCodeException(const StatusCode statusCode) :
-    m_statusCode(statusCode)
-{
-#if defined(__GNUC__) && defined(BACKTRACE)
-    const size_t maxDepth = 100;
-    void *stackAddresses[maxDepth];
+#if __cplusplus > 199711L
+    /**
+     *  @brief  Set a counter to be incremented, in addition to the process-wide count, by each status code exception constructed on
+     *          the calling thread. This allows exceptions to be attributed to a single pandora instance when several run concurrently.
+     * 
+     *  @param  pExceptionCounter address of the counter, or null for no counter
+     * 
+     *  @return address of the counter previously set for the calling thread, or null
+     */
+    static std::atomic<unsigned int> *SetThreadExceptionCounter(std::atomic<unsigned int> *const pExceptionCounter);
 
-    size_t stackDepth = backtrace(stackAddresses, maxDepth);
-    char **stackStrings = backtrace_symbols(stackAddresses, stackDepth);
+    /**
+     *  @brief  Get the counter incremented by each status code exception constructed on the calling thread
+     * 
+     *  @return address of the counter, or null
+     */
+    static std::atomic<unsigned int> *GetThreadExceptionCounter();
+#endif
 
-    m_backTrace = "\nBackTrace\n    ";
+private:
+    static const unsigned int MAX_BACKTRACE_DEPTH = 100;            ///< The maximum number of return addresses to capture
 
-    for (size_t i = 1; i < stackDepth; ++i)
-    {
-        m_backTrace += stackStrings[i];
-        m_backTrace += "\n    ";
-    }
+    // ATTN: The layout must not depend on BACKTRACE, so that client code built without it can still throw and catch these exceptions
+    const StatusCode    m_statusCode;                               ///< The status code
+    std::vector<void *> m_stackAddresses;                           ///< The captured return addresses, empty unless built with BACKTRACE
+    mutable std::string m_backTrace;                                ///< The symbolised back trace, filled on first request
+
+#if __cplusplus > 199711L
+    static std::atomic<bool>            m_shouldCaptureBackTrace;   ///< Whether to capture back traces
+    static std::atomic<unsigned int>    m_nExceptionsThrown;        ///< The number of status code exceptions constructed
 
-    free(stackStrings); // malloc()ed by backtrace_symbols
+    static thread_local std::atomic<unsigned int> *m_pThreadExceptionCounter; ///< The counter for exceptions constructed on this thread
+#else
+    static bool                         m_shouldCaptureBackTrace;   ///< Whether to capture back traces
+    static unsigned int                 m_nExceptionsThrown;        ///< The number of status code exceptions constructed
 #endif
-}
+};
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
@@ -200,13 +224,6 @@ inline std::string StatusCodeException::ToString() const
     return StatusCodeToString(m_statusCode);
 }
 
-//------------------------------------------------------------------------------------------------------------------------------------------
-
-inline const std::string &StatusCodeException::GetBackTrace() const
-{
-    return m_backTrace;
-}
-
 //------------------------------------------------------------------------------------------------------------------------------------------
 //------------------------------------------------------------------------------------------------------------------------------------------
 
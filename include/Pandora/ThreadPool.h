@@ -0,0 +1,157 @@
+/**
+ *  @file   PandoraSDK/include/Pandora/ThreadPool.h
+ *
+ *  @brief  Header file for the thread pool class.
+ *
+ *  $Log: $
+ */
+#ifndef PANDORA_THREAD_POOL_H
+#define PANDORA_THREAD_POOL_H 1
+
+#include "Pandora/PandoraInternal.h"
+#include "Pandora/StatusCodes.h"
+
+namespace pandora
+{
+
+/**
+ *  @brief  ThreadPool class, owned by the pandora instance and sized by the NumberOfThreads pandora setting. The pool distributes
+ *          independent, indexed tasks over a fixed set of worker threads, with the calling thread also taking part. Without c++11,
+ *          or with a single thread, all tasks are run in order on the calling thread.
+ */
+class ThreadPool
+{
+public:
+    /**
+     *  @brief  Task class, to be run once for each index in a parallel loop. Implementations may be called concurrently from
+     *          several threads, so must not modify any shared state.
+     */
+    class Task
+    {
+    public:
+        /**
+         *  @brief  Destructor
+         */
+        virtual ~Task();
+
+        /**
+         *  @brief  Run the task for a specified index
+         *
+         *  @param  index the index
+         */
+        virtual StatusCode Run(const unsigned int index) const = 0;
+    };
+
+    /**
+     *  @brief  Default constructor, creating a pool with a single (the calling) thread
+     */
+    ThreadPool();
+
+    /**
+     *  @brief  Destructor
+     */
+    ~ThreadPool();
+
+    /**
+     *  @brief  Get the number of threads, including the calling thread, over which tasks are distributed
+     *
+     *  @return the number of threads
+     */
+    unsigned int GetNThreads() const;
+
+    /**
+     *  @brief  Run a task for each index in the range [0, nIndices), distributed over the pool threads, returning once all have
+     *          completed. Calls made from within a running task are run in order on the calling thread.
+     *
+     *  @param  nIndices the number of indices
+     *  @param  task the task
+     *
+     *  @return the first failure status code reported by any task, whether returned or thrown, otherwise STATUS_CODE_SUCCESS
+     */
+    StatusCode ParallelFor(const unsigned int nIndices, const Task &task) const;
+
+private:
+    /**
+     *  @brief  Set the number of threads, replacing any existing worker threads
+     *
+     *  @param  nThreads the number of threads, including the calling thread
+     */
+    StatusCode SetNThreads(const unsigned int nThreads);
+
+    /**
+     *  @brief  Run a task for a range of indices, in order, on the calling thread
+     *
+     *  @param  beginIndex the first index
+     *  @param  endIndex the index after the last index
+     *  @param  task the task
+     *
+     *  @return the first failure status code, otherwise STATUS_CODE_SUCCESS
+     */
+    static StatusCode RunTask(const unsigned int beginIndex, const unsigned int endIndex, const Task &task);
+
+    class Workers;
+
+    unsigned int            m_nThreads;             ///< The number of threads, including the calling thread
+    Workers                *m_pWorkers;             ///< The worker threads, if there is more than one thread
+
+    friend class PandoraImpl;
+};
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline unsigned int ThreadPool::GetNThreads() const
+{
+    return m_nThreads;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline ThreadPool::Task::~Task()
+{
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+/**
+ *  @brief  VectorTask class, calling a functor for each element of a vector
+ */
+template <typename T, typename FUNCTOR>
+class VectorTask : public ThreadPool::Task
+{
+public:
+    /**
+     *  @brief  Constructor
+     *
+     *  @param  elementVector the vector of elements
+     *  @param  functor the functor, called as functor(element) and returning a status code
+     */
+    VectorTask(const std::vector<T> &elementVector, const FUNCTOR &functor);
+
+    StatusCode Run(const unsigned int index) const;
+
+private:
+    const std::vector<T>   &m_elementVector;        ///< The vector of elements
+    const FUNCTOR          &m_functor;              ///< The functor
+};
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename T, typename FUNCTOR>
+inline VectorTask<T, FUNCTOR>::VectorTask(const std::vector<T> &elementVector, const FUNCTOR &functor) :
+    m_elementVector(elementVector),
+    m_functor(functor)
+{
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename T, typename FUNCTOR>
+inline StatusCode VectorTask<T, FUNCTOR>::Run(const unsigned int index) const
+{
+    return m_functor(m_elementVector[index]);
+}
+
+} // namespace pandora
+
+#endif // #ifndef PANDORA_THREAD_POOL_H
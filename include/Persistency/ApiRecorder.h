@@ -0,0 +1,248 @@
+/**
+ *  @file   PandoraSDK/include/Persistency/ApiRecorder.h
+ *
+ *  @brief  Header file for the api recorder class.
+ *
+ *  $Log: $
+ */
+#ifndef PANDORA_API_RECORDER_H
+#define PANDORA_API_RECORDER_H 1
+
+#include "Api/PandoraApi.h"
+
+#include "Persistency/PandoraIO.h"
+
+#include <fstream>
+#include <typeinfo>
+
+namespace pandora
+{
+
+/**
+ *  @brief  ApiRecorder class, writing a compact binary trace of the input calls made via the PandoraApi. The trace contains the
+ *          object parameters, relationships, geometry, settings and event boundaries exactly as provided by the client framework,
+ *          so that the same input can later be replayed, via the ApiReplayer, into a fresh pandora instance.
+ */
+class ApiRecorder
+{
+public:
+    /**
+     *  @brief  Constructor
+     *
+     *  @param  traceFileName the name of the output trace file (any existing file will be overwritten)
+     */
+    ApiRecorder(const std::string &traceFileName);
+
+    /**
+     *  @brief  Destructor
+     */
+    ~ApiRecorder();
+
+    /**
+     *  @brief  Record the creation of a calo hit
+     *
+     *  @param  parameters the calo hit parameters
+     *  @param  factory the factory that performed the object allocation
+     */
+    StatusCode Record(const PandoraApi::CaloHit::Parameters &parameters,
+        const ObjectFactory<PandoraApi::CaloHit::Parameters, PandoraApi::CaloHit::Object> &factory);
+
+    /**
+     *  @brief  Record the creation of a track
+     *
+     *  @param  parameters the track parameters
+     *  @param  factory the factory that performed the object allocation
+     */
+    StatusCode Record(const PandoraApi::Track::Parameters &parameters,
+        const ObjectFactory<PandoraApi::Track::Parameters, PandoraApi::Track::Object> &factory);
+
+    /**
+     *  @brief  Record the creation of a mc particle
+     *
+     *  @param  parameters the mc particle parameters
+     *  @param  factory the factory that performed the object allocation
+     */
+    StatusCode Record(const PandoraApi::MCParticle::Parameters &parameters,
+        const ObjectFactory<PandoraApi::MCParticle::Parameters, PandoraApi::MCParticle::Object> &factory);
+
+    /**
+     *  @brief  Record the creation of a sub detector
+     *
+     *  @param  parameters the sub detector parameters
+     *  @param  factory the factory that performed the object allocation
+     */
+    StatusCode Record(const PandoraApi::Geometry::SubDetector::Parameters &parameters,
+        const ObjectFactory<PandoraApi::Geometry::SubDetector::Parameters, PandoraApi::Geometry::SubDetector::Object> &factory);
+
+    /**
+     *  @brief  Record the creation of a line gap
+     *
+     *  @param  parameters the line gap parameters
+     *  @param  factory the factory that performed the object allocation
+     */
+    StatusCode Record(const PandoraApi::Geometry::LineGap::Parameters &parameters,
+        const ObjectFactory<PandoraApi::Geometry::LineGap::Parameters, PandoraApi::Geometry::LineGap::Object> &factory);
+
+    /**
+     *  @brief  Record the creation of a box gap
+     *
+     *  @param  parameters the box gap parameters
+     *  @param  factory the factory that performed the object allocation
+     */
+    StatusCode Record(const PandoraApi::Geometry::BoxGap::Parameters &parameters,
+        const ObjectFactory<PandoraApi::Geometry::BoxGap::Parameters, PandoraApi::Geometry::BoxGap::Object> &factory);
+
+    /**
+     *  @brief  Record the creation of a concentric gap
+     *
+     *  @param  parameters the concentric gap parameters
+     *  @param  factory the factory that performed the object allocation
+     */
+    StatusCode Record(const PandoraApi::Geometry::ConcentricGap::Parameters &parameters,
+        const ObjectFactory<PandoraApi::Geometry::ConcentricGap::Parameters, PandoraApi::Geometry::ConcentricGap::Object> &factory);
+
+    /**
+     *  @brief  Record a relationship between two objects in the user framework
+     *
+     *  @param  relationshipId the relationship identification
+     *  @param  address1 address of the first object in the user framework
+     *  @param  address2 address of the second object in the user framework
+     *  @param  weight the relationship weight
+     */
+    StatusCode RecordRelationship(const RelationshipId relationshipId, const void *const address1, const void *const address2, const float weight);
+
+    /**
+     *  @brief  Record the reading of pandora settings, storing the full xml content so that the trace is self-contained
+     *
+     *  @param  xmlFileName the name of the xml file containing the settings
+     */
+    StatusCode RecordSettings(const std::string &xmlFileName);
+
+    /**
+     *  @brief  Record the granularity level associated with a specified hit type
+     *
+     *  @param  hitType the specified hit type
+     *  @param  granularity the specified granularity
+     */
+    StatusCode RecordHitTypeGranularity(const HitType hitType, const Granularity granularity);
+
+    /**
+     *  @brief  Record a request to process the event
+     */
+    StatusCode RecordProcessEvent();
+
+    /**
+     *  @brief  Record a request to reset pandora for the next event
+     */
+    StatusCode RecordReset();
+
+    /**
+     *  @brief  Record a request to reset pandora for the next time slice, advancing the sliding window
+     * 
+     *  @param  windowStartTime the start time of the sliding window
+     */
+    StatusCode RecordAdvanceSlidingWindow(const float windowStartTime);
+
+private:
+    /**
+     *  @brief  Write the record identifier
+     *
+     *  @param  apiRecordId the api record identification
+     */
+    StatusCode WriteRecordId(const ApiRecordId apiRecordId);
+
+    /**
+     *  @brief  Write a flag indicating whether an object was allocated by a custom factory, rather than the default pandora factory,
+     *          so that replay can insist upon an equivalent factory
+     *
+     *  @param  factory the factory that performed the object allocation
+     */
+    template<typename PARAMETERS, typename OBJECT>
+    StatusCode WriteFactoryFlag(const ObjectFactory<PARAMETERS, OBJECT> &factory);
+
+    /**
+     *  @brief  Write a pandora input type, preceded by a flag indicating whether it is initialized
+     *
+     *  @param  input the pandora input type
+     */
+    template<typename T>
+    StatusCode WriteInput(const PandoraInputType<T> &input);
+
+    /**
+     *  @brief  Write a variable to the trace file
+     */
+    template<typename T>
+    StatusCode WriteVariable(const T &t);
+
+    std::ofstream               m_fileStream;           ///< The stream class to write to the trace file
+};
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template<typename PARAMETERS, typename OBJECT>
+inline StatusCode ApiRecorder::WriteFactoryFlag(const ObjectFactory<PARAMETERS, OBJECT> &factory)
+{
+    const bool isCustomFactory(typeid(factory) != typeid(PandoraObjectFactory<PARAMETERS, OBJECT>));
+    return this->WriteVariable(isCustomFactory);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template<typename T>
+inline StatusCode ApiRecorder::WriteInput(const PandoraInputType<T> &input)
+{
+    const bool isInitialized(input.IsInitialized());
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->WriteVariable(isInitialized));
+
+    if (isInitialized)
+        return this->WriteVariable(input.Get());
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template<typename T>
+inline StatusCode ApiRecorder::WriteVariable(const T &t)
+{
+    m_fileStream.write(reinterpret_cast<const char*>(&t), sizeof(T));
+
+    if (!m_fileStream.good())
+        return STATUS_CODE_FAILURE;
+
+    return STATUS_CODE_SUCCESS;
+}
+
+template<>
+inline StatusCode ApiRecorder::WriteVariable(const std::string &t)
+{
+    const unsigned int stringSize(t.size());
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->WriteVariable(stringSize));
+    m_fileStream.write(t.c_str(), stringSize);
+
+    if (!m_fileStream.good())
+        return STATUS_CODE_FAILURE;
+
+    return STATUS_CODE_SUCCESS;
+}
+
+template<>
+inline StatusCode ApiRecorder::WriteVariable(const CartesianVector &t)
+{
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->WriteVariable(t.GetX()));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->WriteVariable(t.GetY()));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->WriteVariable(t.GetZ()));
+    return STATUS_CODE_SUCCESS;
+}
+
+template<>
+inline StatusCode ApiRecorder::WriteVariable(const TrackState &t)
+{
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->WriteVariable(t.GetPosition()));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->WriteVariable(t.GetMomentum()));
+    return STATUS_CODE_SUCCESS;
+}
+
+} // namespace pandora
+
+#endif // #ifndef PANDORA_API_RECORDER_H
@@ -0,0 +1,283 @@
+/**
+ *  @file   PandoraSDK/include/Persistency/ApiReplayer.h
+ *
+ *  @brief  Header file for the api replayer class.
+ *
+ *  $Log: $
+ */
+#ifndef PANDORA_API_REPLAYER_H
+#define PANDORA_API_REPLAYER_H 1
+
+#include "Api/PandoraApi.h"
+
+#include "Persistency/PandoraIO.h"
+
+#include <cstring>
+#include <vector>
+
+namespace pandora
+{
+
+/**
+ *  @brief  ApiReplayer class, replaying an api trace written by the ApiRecorder into a pandora instance. The full trace is read
+ *          into memory on construction, so that replay proceeds at maximum speed, without file access between api calls.
+ *          Objects are recreated using the default pandora object factories, unless the trace shows that a custom factory was
+ *          used, in which case an equivalent factory must be provided before replay.
+ */
+class ApiReplayer
+{
+public:
+    /**
+     *  @brief  Constructor
+     *
+     *  @param  pandora the pandora instance into which the trace will be replayed
+     *  @param  traceFileName the name of the input trace file
+     */
+    ApiReplayer(const pandora::Pandora &pandora, const std::string &traceFileName);
+
+    /**
+     *  @brief  Replay the recorded api calls up to, and including, the next event reset or sliding window advance. Settings and
+     *          geometry calls recorded ahead of the first event are replayed alongside the first event. If the pandora instance is
+     *          itself recording its api input calls, recording is suspended whilst the calls are replayed.
+     *
+     *  @return STATUS_CODE_NOT_FOUND if the end of the trace has been reached
+     */
+    StatusCode ReplayNextEvent();
+
+    /**
+     *  @brief  Replay all remaining recorded api calls
+     */
+    StatusCode ReplayAll();
+
+    /**
+     *  @brief  Get the number of events replayed so far
+     *
+     *  @return the number of events replayed
+     */
+    unsigned int GetNEventsReplayed() const;
+
+    /**
+     *  @brief  Set the factory used to recreate calo hits originally created using a custom factory
+     *
+     *  @param  caloHitFactory the calo hit factory, which must outlive the replayer
+     */
+    void SetCaloHitFactory(const ObjectFactory<PandoraApi::CaloHit::Parameters, PandoraApi::CaloHit::Object> &caloHitFactory);
+
+    /**
+     *  @brief  Set the factory used to recreate tracks originally created using a custom factory
+     *
+     *  @param  trackFactory the track factory, which must outlive the replayer
+     */
+    void SetTrackFactory(const ObjectFactory<PandoraApi::Track::Parameters, PandoraApi::Track::Object> &trackFactory);
+
+    /**
+     *  @brief  Set the factory used to recreate mc particles originally created using a custom factory
+     *
+     *  @param  mcParticleFactory the mc particle factory, which must outlive the replayer
+     */
+    void SetMCParticleFactory(const ObjectFactory<PandoraApi::MCParticle::Parameters, PandoraApi::MCParticle::Object> &mcParticleFactory);
+
+private:
+    /**
+     *  @brief  Replay the recorded api calls up to, and including, the next event reset or sliding window advance
+     *
+     *  @return STATUS_CODE_NOT_FOUND if the end of the trace has been reached
+     */
+    StatusCode ReplayEventRecords();
+
+    /**
+     *  @brief  Replay the next recorded api call
+     *
+     *  @param  apiRecordId to receive the identifier of the replayed record
+     */
+    StatusCode ReplayNextRecord(ApiRecordId &apiRecordId);
+
+    /**
+     *  @brief  Replay the creation of an object, using the default pandora factory unless the record shows a custom factory was used
+     *
+     *  @param  pCustomFactory address of the factory equivalent to the custom factory, or NULL if none has been provided
+     */
+    template<typename PARAMETERS, typename OBJECT>
+    StatusCode ReplayObject(const ObjectFactory<PARAMETERS, OBJECT> *const pCustomFactory);
+
+    StatusCode ReadParameters(PandoraApi::CaloHit::Parameters &parameters);
+    StatusCode ReadParameters(PandoraApi::Track::Parameters &parameters);
+    StatusCode ReadParameters(PandoraApi::MCParticle::Parameters &parameters);
+    StatusCode ReadParameters(PandoraApi::Geometry::SubDetector::Parameters &parameters);
+    StatusCode ReadParameters(PandoraApi::Geometry::LineGap::Parameters &parameters);
+    StatusCode ReadParameters(PandoraApi::Geometry::BoxGap::Parameters &parameters);
+    StatusCode ReadParameters(PandoraApi::Geometry::ConcentricGap::Parameters &parameters);
+
+    StatusCode ReplayRelationship();
+    StatusCode ReplaySettings();
+    StatusCode ReplayHitTypeGranularity();
+    StatusCode ReplayAdvanceSlidingWindow();
+
+    /**
+     *  @brief  Read a pandora input type, preceded by a flag indicating whether it was initialized
+     *
+     *  @param  input to receive the pandora input type
+     */
+    template<typename T>
+    StatusCode ReadInput(PandoraInputType<T> &input);
+
+    /**
+     *  @brief  Read a variable from the in-memory trace
+     */
+    template<typename T>
+    StatusCode ReadVariable(T &t);
+
+    typedef std::vector<char> TraceBuffer;
+
+    const Pandora              *m_pPandora;             ///< Address of pandora instance into which the trace is replayed
+    TraceBuffer                 m_traceBuffer;          ///< The full contents of the trace file
+    size_t                      m_position;             ///< The current read position in the trace buffer
+    unsigned int                m_nEventsReplayed;      ///< The number of events replayed so far
+
+    const ObjectFactory<PandoraApi::CaloHit::Parameters, PandoraApi::CaloHit::Object>          *m_pCaloHitFactory;     ///< The calo hit factory
+    const ObjectFactory<PandoraApi::Track::Parameters, PandoraApi::Track::Object>              *m_pTrackFactory;       ///< The track factory
+    const ObjectFactory<PandoraApi::MCParticle::Parameters, PandoraApi::MCParticle::Object>    *m_pMCParticleFactory;  ///< The mc particle factory
+};
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline unsigned int ApiReplayer::GetNEventsReplayed() const
+{
+    return m_nEventsReplayed;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline void ApiReplayer::SetCaloHitFactory(const ObjectFactory<PandoraApi::CaloHit::Parameters, PandoraApi::CaloHit::Object> &caloHitFactory)
+{
+    m_pCaloHitFactory = &caloHitFactory;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline void ApiReplayer::SetTrackFactory(const ObjectFactory<PandoraApi::Track::Parameters, PandoraApi::Track::Object> &trackFactory)
+{
+    m_pTrackFactory = &trackFactory;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline void ApiReplayer::SetMCParticleFactory(const ObjectFactory<PandoraApi::MCParticle::Parameters, PandoraApi::MCParticle::Object> &mcParticleFactory)
+{
+    m_pMCParticleFactory = &mcParticleFactory;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template<typename T>
+inline StatusCode ApiReplayer::ReadVariable(T &t)
+{
+    if (sizeof(T) > m_traceBuffer.size() - m_position)
+        return STATUS_CODE_NOT_FOUND;
+
+    std::memcpy(&t, &m_traceBuffer[m_position], sizeof(T));
+    m_position += sizeof(T);
+
+    return STATUS_CODE_SUCCESS;
+}
+
+template<>
+inline StatusCode ApiReplayer::ReadVariable(std::string &t)
+{
+    unsigned int stringSize(0);
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->ReadVariable(stringSize));
+
+    if (stringSize > m_traceBuffer.size() - m_position)
+        return STATUS_CODE_FAILURE;
+
+    t = std::string(m_traceBuffer.begin() + m_position, m_traceBuffer.begin() + m_position + stringSize);
+    m_position += stringSize;
+
+    return STATUS_CODE_SUCCESS;
+}
+
+template<>
+inline StatusCode ApiReplayer::ReadVariable(CartesianVector &t)
+{
+    float x(0.f), y(0.f), z(0.f);
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->ReadVariable(x));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->ReadVariable(y));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->ReadVariable(z));
+    t = CartesianVector(x, y, z);
+
+    return STATUS_CODE_SUCCESS;
+}
+
+template<>
+inline StatusCode ApiReplayer::ReadVariable(TrackState &t)
+{
+    CartesianVector position(0.f, 0.f, 0.f), momentum(0.f, 0.f, 0.f);
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->ReadVariable(position));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->ReadVariable(momentum));
+    t = TrackState(position, momentum);
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template<typename T>
+inline StatusCode ApiReplayer::ReadInput(PandoraInputType<T> &input)
+{
+    bool isInitialized(false);
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->ReadVariable(isInitialized));
+
+    if (!isInitialized)
+    {
+        input.Reset();
+        return STATUS_CODE_SUCCESS;
+    }
+
+    T t;
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->ReadVariable(t));
+    input = t;
+
+    return STATUS_CODE_SUCCESS;
+}
+
+template<>
+inline StatusCode ApiReplayer::ReadInput(InputCartesianVector &input)
+{
+    bool isInitialized(false);
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->ReadVariable(isInitialized));
+
+    if (!isInitialized)
+    {
+        input.Reset();
+        return STATUS_CODE_SUCCESS;
+    }
+
+    CartesianVector t(0.f, 0.f, 0.f);
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->ReadVariable(t));
+    input = t;
+
+    return STATUS_CODE_SUCCESS;
+}
+
+template<>
+inline StatusCode ApiReplayer::ReadInput(InputTrackState &input)
+{
+    bool isInitialized(false);
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->ReadVariable(isInitialized));
+
+    if (!isInitialized)
+    {
+        input.Reset();
+        return STATUS_CODE_SUCCESS;
+    }
+
+    TrackState t(0.f, 0.f, 0.f, 0.f, 0.f, 0.f);
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->ReadVariable(t));
+    input = t;
+
+    return STATUS_CODE_SUCCESS;
+}
+
+} // namespace pandora
+
+#endif // #ifndef PANDORA_API_REPLAYER_H
@@ -13,8 +13,10 @@
 #include "Objects/CartesianVector.h"
 #include "Objects/TrackState.h"
 
+#include "Persistency/BlockCodec.h"
 #include "Persistency/FileReader.h"
 
+#include <cstring>
 #include <fstream>
 
 namespace pandora
@@ -46,6 +48,27 @@ public:
     StatusCode ReadVariable(T &t);
 
 private:
+    /**
+     *  @brief  Read a block of bytes, from the decompressed block for a compressed container, else from the file
+     * 
+     *  @param  pBytes address of the first byte to receive the block
+     *  @param  nBytes the number of bytes to read
+     */
+    StatusCode ReadBytes(char *const pBytes, const std::size_t nBytes);
+
+    /**
+     *  @brief  Read the hash, id and size of the container at the current position in the file
+     * 
+     *  @param  containerCodec to receive the codec used to compress the container contents
+     */
+    StatusCode ReadContainerHeader(ContainerCodec &containerCodec);
+
+    /**
+     *  @brief  Read and decompress the contents of the current, compressed container, so that subsequent reads use the
+     *          decompressed block. The file position is left at the end of the container.
+     */
+    StatusCode ReadCompressedBlock();
+
     StatusCode ReadHeader();
     StatusCode GoToNextContainer();
     ContainerId GetNextContainerId();
@@ -110,21 +133,80 @@ private:
      */
     StatusCode ReadRelationship(bool checkComponentId = true);
 
+    /**
+     *  @brief  Read a calo hit cell dictionary entry from the current position in the file
+     * 
+     *  @param  checkComponentId whether to check the component id before deserializing
+     */
+    StatusCode ReadCaloHitCell(bool checkComponentId = true);
+
+    /**
+     *  @brief  Read a compact calo hit from the current position in the file, recreating the stored object
+     * 
+     *  @param  checkComponentId whether to check the component id before deserializing
+     */
+    StatusCode ReadCompactCaloHit(bool checkComponentId = true);
+
+    /**
+     *  @brief  Read a unit vector stored as two quantised octahedral coordinates
+     * 
+     *  @param  unitVector to receive the unit vector
+     */
+    StatusCode ReadQuantisedUnitVector(CartesianVector &unitVector);
+
+    /**
+     *  @brief  CaloHitCell class, holding the cell properties shared by the compact calo hits in an event
+     */
+    class CaloHitCell
+    {
+    public:
+        /**
+         *  @brief  Default constructor
+         */
+        CaloHitCell();
+
+        CellGeometry                m_cellGeometry;             ///< The cell geometry type, pointing or rectangular
+        HitType                     m_hitType;                  ///< The type of calorimeter hit
+        HitRegion                   m_hitRegion;                ///< Region of the detector in which the calo hit is located
+        bool                        m_isDigital;                ///< Whether cell should be treated as digital
+        bool                        m_isInOuterSamplingLayer;   ///< Whether cell is in one of the outermost detector sampling layers
+        unsigned int                m_layer;                    ///< The subdetector readout layer number
+        CartesianVector             m_cellNormalVector;         ///< Unit normal to sampling layer, pointing outwards from the origin
+        float                       m_cellThickness;            ///< Thickness of cell, units mm
+        float                       m_nCellRadiationLengths;    ///< Absorber material in front of cell, units radiation lengths
+        float                       m_nCellInteractionLengths;  ///< Absorber material in front of cell, units interaction lengths
+        float                       m_cellSize0;                ///< First cell dimension
+        float                       m_cellSize1;                ///< Second cell dimension
+    };
+
+    typedef std::vector<CaloHitCell> CaloHitCellVector;
+
     std::ifstream::pos_type         m_containerPosition;    ///< Position of start of the current event/geometry container object in file
     std::ifstream::pos_type         m_containerSize;        ///< Size of the current event/geometry container object in the file
     std::ifstream                   m_fileStream;           ///< The stream class to read from the file
+    bool                            m_isReadingBlock;       ///< Whether variables are read from the decompressed block, rather than the file
+    std::size_t                     m_blockPosition;        ///< The current read position in the decompressed block
+    BlockCodec::ByteVector          m_blockBuffer;          ///< The decompressed contents of the current compressed container
+    BlockCodec::ByteVector          m_compressedBuffer;     ///< The compressed contents of the current compressed container
+    CaloHitCellVector               m_caloHitCellVector;    ///< The calo hit cell dictionary for the current event
 };
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-template<typename T>
-inline StatusCode BinaryFileReader::ReadVariable(T &t)
+inline StatusCode BinaryFileReader::ReadBytes(char *const pBytes, const std::size_t nBytes)
 {
-    char *const pMemBlock = new char[sizeof(T)];
-    m_fileStream.read(pMemBlock, sizeof(T));
+    if (m_isReadingBlock)
+    {
+        if (nBytes > m_blockBuffer.size() - m_blockPosition)
+            return STATUS_CODE_FAILURE;
+
+        std::memcpy(pBytes, &m_blockBuffer[m_blockPosition], nBytes);
+        m_blockPosition += nBytes;
 
-    t = *(reinterpret_cast<T*>(pMemBlock));
-    delete[] pMemBlock;
+        return STATUS_CODE_SUCCESS;
+    }
+
+    m_fileStream.read(pBytes, nBytes);
 
     if (!m_fileStream.good())
         return STATUS_CODE_FAILURE;
@@ -132,22 +214,26 @@ inline StatusCode BinaryFileReader::ReadVariable(T &t)
     return STATUS_CODE_SUCCESS;
 }
 
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template<typename T>
+inline StatusCode BinaryFileReader::ReadVariable(T &t)
+{
+    return this->ReadBytes(reinterpret_cast<char*>(&t), sizeof(T));
+}
+
 template<>
 inline StatusCode BinaryFileReader::ReadVariable(std::string &t)
 {
     unsigned int stringSize;
     PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->ReadVariable(stringSize));
 
-    char *const pMemBlock = new char[stringSize];
-    m_fileStream.read(pMemBlock, stringSize);
+    t.resize(stringSize);
 
-    t = std::string(pMemBlock, stringSize);
-    delete[] pMemBlock;
+    if (0 == stringSize)
+        return STATUS_CODE_SUCCESS;
 
-    if (!m_fileStream.good())
-        return STATUS_CODE_FAILURE;
-
-    return STATUS_CODE_SUCCESS;
+    return this->ReadBytes(&t[0], stringSize);
 }
 
 template<>
@@ -16,6 +16,8 @@
 #include "Persistency/FileWriter.h"
 
 #include <fstream>
+#include <map>
+#include <vector>
 
 namespace pandora
 {
@@ -41,12 +43,40 @@ public:
     ~BinaryFileWriter();
 
     /**
-     *  @brief  Write a variable to the file
+     *  @brief  Hand completed containers to a background thread for writing to file, rather than writing them synchronously.
+     *          All buffered containers are written, and the file flushed, when the file writer is destroyed.
+     * 
+     *  @param  maxBufferedBytes the maximum number of bytes awaiting writing, above which serialization of further containers waits
+     */
+    StatusCode EnableBackgroundWriting(const unsigned int maxBufferedBytes);
+
+    /**
+     *  @brief  Set the codec used to compress each subsequent event/geometry container, which is then stored as a single block.
+     *          Containers remain individually addressable, so files can mix compressed and uncompressed containers.
+     * 
+     *  @param  containerCodec the container codec
+     */
+    StatusCode SetContainerCodec(const ContainerCodec containerCodec);
+
+    /**
+     *  @brief  Write subsequent calo hits in a compact form. Cell properties shared between hits (geometry, normal, dimensions,
+     *          material, hit type, region and layer) are written once per event, in a dictionary entry, and are referenced by index.
+     *          Expected directions are stored as quantised unit vectors, whilst positions, times and energies are stored exactly.
+     * 
+     *  @param  directionPrecisionBits the number of bits, at most 16, retained for each of the two quantised direction coordinates
+     */
+    StatusCode EnableCompactCaloHits(const unsigned int directionPrecisionBits);
+
+    /**
+     *  @brief  Write a variable to the current container buffer
      */
     template<typename T>
     StatusCode WriteVariable(const T &t);
 
 private:
+    class BackgroundWriter;
+    typedef std::vector<char> ContainerBuffer;
+
     StatusCode WriteHeader(const ContainerId containerId);
     StatusCode WriteFooter();
     StatusCode WriteSubDetector(const SubDetector *const pSubDetector);
@@ -56,19 +86,66 @@ private:
     StatusCode WriteMCParticle(const MCParticle *const pMCParticle);
     StatusCode WriteRelationship(const RelationshipId relationshipId, const void *address1, const void *address2, const float weight);
 
-    std::ofstream::pos_type     m_containerPosition;    ///< Position of start of the current event/geometry container object in file
+    /**
+     *  @brief  Write a calo hit in compact form, preceded by a dictionary entry for its cell properties if these are new to the event
+     * 
+     *  @param  pCaloHit address of the calo hit
+     */
+    StatusCode WriteCompactCaloHit(const CaloHit *const pCaloHit);
+
+    /**
+     *  @brief  Write a unit vector as two quantised octahedral coordinates
+     * 
+     *  @param  unitVector the unit vector
+     */
+    StatusCode WriteQuantisedUnitVector(const CartesianVector &unitVector);
+
+    /**
+     *  @brief  Append a block of bytes to the current container buffer
+     * 
+     *  @param  pBytes address of the first byte
+     *  @param  nBytes the number of bytes
+     */
+    void WriteBytes(const char *const pBytes, const std::size_t nBytes);
+
+    /**
+     *  @brief  Write the completed container buffer to file, or hand it to the background writer
+     */
+    StatusCode FlushContainer();
+
+    /**
+     *  @brief  Replace the completed container buffer with a compressed container, holding the original contents as a single block
+     */
+    StatusCode CompressContainer();
+
+    std::size_t                 m_containerPosition;    ///< Position of the container size within the current container buffer
+    ContainerBuffer             m_containerBuffer;      ///< The current event/geometry container, serialized as a contiguous block
+    ContainerCodec              m_containerCodec;       ///< The codec used to compress each container
+    ContainerBuffer             m_compressedBuffer;     ///< Scratch buffer receiving the compressed container contents
+
+    typedef std::map<std::string, unsigned int> CaloHitCellMap;
+
+    bool                        m_shouldWriteCompactCaloHits;   ///< Whether to write calo hits in compact form
+    unsigned int                m_directionPrecisionBits;       ///< The number of bits retained for each quantised direction coordinate
+    CaloHitCellMap              m_caloHitCellMap;               ///< Map from serialized cell properties to dictionary index, for current event
+    std::string                 m_caloHitCell;                  ///< Scratch string holding the serialized cell properties of the current hit
     std::ofstream               m_fileStream;           ///< The stream class to write to the file
+    BackgroundWriter           *m_pBackgroundWriter;    ///< Address of the background writer, NULL if containers are written synchronously
 };
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+inline void BinaryFileWriter::WriteBytes(const char *const pBytes, const std::size_t nBytes)
+{
+    m_containerBuffer.insert(m_containerBuffer.end(), pBytes, pBytes + nBytes);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 template<typename T>
 inline StatusCode BinaryFileWriter::WriteVariable(const T &t)
 {
-    m_fileStream.write(reinterpret_cast<const char*>(&t), sizeof(T));
-
-    if (!m_fileStream.good())
-        return STATUS_CODE_FAILURE;
+    this->WriteBytes(reinterpret_cast<const char*>(&t), sizeof(T));
 
     return STATUS_CODE_SUCCESS;
 }
@@ -78,10 +155,7 @@ inline StatusCode BinaryFileWriter::WriteVariable(const std::string &t)
 {
     const unsigned int stringSize(t.size());
     PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->WriteVariable(stringSize));
-    m_fileStream.write(reinterpret_cast<const char*>(t.c_str()), stringSize);
-
-    if (!m_fileStream.good())
-        return STATUS_CODE_FAILURE;
+    this->WriteBytes(t.c_str(), stringSize);
 
     return STATUS_CODE_SUCCESS;
 }
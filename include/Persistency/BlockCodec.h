@@ -0,0 +1,99 @@
+/**
+ *  @file   PandoraSDK/include/Persistency/BlockCodec.h
+ *
+ *  @brief  Header file for the block codec class.
+ *
+ *  $Log: $
+ */
+#ifndef PANDORA_BLOCK_CODEC_H
+#define PANDORA_BLOCK_CODEC_H 1
+
+#include "Pandora/PandoraInternal.h"
+#include "Pandora/StatusCodes.h"
+
+#include <cstddef>
+
+namespace pandora
+{
+
+/**
+ *  @brief  BlockCodec class, providing a small, dependency-free lz77 style compression of complete memory blocks. The encoded
+ *          block is a series of sequences, each holding a run of literal bytes followed by a back-reference of up to 64kB
+ *          into the bytes already decoded. The final sequence holds literal bytes only.
+ */
+class BlockCodec
+{
+public:
+    typedef std::vector<char> ByteVector;
+
+    /**
+     *  @brief  Compress a block of bytes
+     *
+     *  @param  pInput address of the first input byte
+     *  @param  inputSize the number of input bytes
+     *  @param  output to receive the compressed block, replacing any existing contents
+     */
+    static void Compress(const char *const pInput, const std::size_t inputSize, ByteVector &output);
+
+    /**
+     *  @brief  Decompress a block of bytes
+     *
+     *  @param  pInput address of the first byte of the compressed block
+     *  @param  inputSize the number of bytes in the compressed block
+     *  @param  outputSize the number of bytes in the original, uncompressed block
+     *  @param  output to receive the uncompressed block, replacing any existing contents
+     *
+     *  @return STATUS_CODE_FAILURE if the compressed block is corrupt or does not decode to the expected size
+     */
+    static StatusCode Decompress(const char *const pInput, const std::size_t inputSize, const std::size_t outputSize, ByteVector &output);
+
+private:
+    /**
+     *  @brief  Get the hash table index for the four bytes starting at a specified address
+     *
+     *  @param  pBytes address of the first byte
+     *
+     *  @return the hash table index
+     */
+    static unsigned int GetHashIndex(const char *const pBytes);
+
+    /**
+     *  @brief  Append a sequence, comprising a run of literal bytes and an optional back-reference, to a compressed block
+     *
+     *  @param  pLiterals address of the first literal byte
+     *  @param  nLiterals the number of literal bytes
+     *  @param  matchOffset the back-reference offset, zero for the final, literal-only, sequence
+     *  @param  matchLength the back-reference length
+     *  @param  output the compressed block
+     */
+    static void WriteSequence(const char *const pLiterals, const std::size_t nLiterals, const std::size_t matchOffset,
+        const std::size_t matchLength, ByteVector &output);
+
+    /**
+     *  @brief  Append the extension bytes for a length that does not fit in its four bit token field
+     *
+     *  @param  length the remaining length, after subtraction of the maximum token field value
+     *  @param  output the compressed block
+     */
+    static void WriteLengthExtension(std::size_t length, ByteVector &output);
+
+    /**
+     *  @brief  Read the extension bytes for a length that does not fit in its four bit token field
+     *
+     *  @param  pInput address of the first byte of the compressed block
+     *  @param  inputSize the number of bytes in the compressed block
+     *  @param  position the current position in the compressed block, advanced past the extension bytes
+     *  @param  length the length, to be incremented by the extension
+     */
+    static StatusCode ReadLengthExtension(const unsigned char *const pInput, const std::size_t inputSize, std::size_t &position,
+        std::size_t &length);
+
+    static const unsigned int   HASH_BITS;              ///< The number of bits in the hash table index
+    static const std::size_t    MIN_MATCH_LENGTH;       ///< The minimum back-reference length
+    static const std::size_t    MAX_MATCH_OFFSET;       ///< The maximum back-reference offset
+    static const std::size_t    MAX_TOKEN_LENGTH;       ///< The largest length stored directly in a four bit token field
+};
+
+} // namespace pandora
+
+#endif // #ifndef PANDORA_BLOCK_CODEC_H
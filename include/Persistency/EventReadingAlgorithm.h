@@ -12,7 +12,7 @@
 
 #include "Persistency/PandoraIO.h"
 
-namespace pandora {class FileReader;}
+namespace pandora {class FileReader; class StagedEvent;}
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
@@ -42,6 +42,8 @@ public:
     ~EventReadingAlgorithm();
 
 private:
+    class ReadAheadQueue;
+
     pandora::StatusCode Initialize();
     pandora::StatusCode Run();
     pandora::StatusCode ReadSettings(const pandora::TiXmlHandle xmlHandle);
@@ -56,6 +58,9 @@ private:
     std::string             m_eventFileName;                ///< Name of the file containing event information
     unsigned int            m_skipToEvent;                  ///< Index of first event to consider in input file
     pandora::FileReader    *m_pEventFileReader;             ///< Address of the event file reader
+
+    unsigned int            m_readAheadDepth;               ///< Number of events to decode ahead in a background thread (zero to read synchronously)
+    ReadAheadQueue         *m_pReadAheadQueue;              ///< Address of the read-ahead queue, if events are decoded ahead
 };
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -61,6 +61,12 @@ private:
     bool                    m_shouldOverwriteEventFile;     ///< Whether to overwrite existing event file with specified name, or append
     bool                    m_shouldOverwriteGeometryFile;  ///< Whether to overwrite existing geometry file with specified name, or append
 
+    bool                    m_shouldWriteInBackground;      ///< Whether to write serialized binary events to file in a background thread
+    unsigned int            m_maxBufferedBytes;             ///< The maximum number of serialized bytes awaiting background writing
+    bool                    m_shouldCompressContainers;     ///< Whether to compress each binary event/geometry container as a single block
+    bool                    m_shouldWriteCompactCaloHits;   ///< Whether to write binary calo hits in compact form, with per-event cell dictionary
+    unsigned int            m_directionPrecisionBits;       ///< The number of bits retained for each quantised calo hit direction coordinate
+
     pandora::FileWriter    *m_pEventFileWriter;             ///< Address of the event file writer
 };
 
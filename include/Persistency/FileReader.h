@@ -14,6 +14,7 @@
 #include "Persistency/Persistency.h"
 
 #include <string>
+#include <vector>
 
 namespace pandora
 {
@@ -22,6 +23,72 @@ class Pandora;
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+/**
+ *  @brief  StagedEvent class, holding the decoded contents of an event until the stored objects are recreated
+ */
+class StagedEvent
+{
+public:
+    /**
+     *  @brief  Default constructor
+     */
+    StagedEvent();
+
+    /**
+     *  @brief  Destructor
+     */
+    ~StagedEvent();
+
+    /**
+     *  @brief  Whether the staged event is empty
+     *
+     *  @return boolean
+     */
+    bool IsEmpty() const;
+
+    /**
+     *  @brief  Delete all staged parameters and relationships
+     */
+    void Clear();
+
+private:
+    /**
+     *  @brief  Relationship class, holding a decoded relationship
+     */
+    class Relationship
+    {
+    public:
+        RelationshipId              m_relationshipId;       ///< The relationship identification
+        const void                 *m_address1;             ///< Address of the first object in the user framework
+        const void                 *m_address2;             ///< Address of the second object in the user framework
+        float                       m_weight;               ///< The relationship weight
+    };
+
+    typedef std::vector<PandoraApi::CaloHit::Parameters*> CaloHitParametersVector;
+    typedef std::vector<PandoraApi::Track::Parameters*> TrackParametersVector;
+    typedef std::vector<PandoraApi::MCParticle::Parameters*> MCParticleParametersVector;
+    typedef std::vector<Relationship> RelationshipVector;
+
+    /**
+     *  @brief  Copy constructor, private and unimplemented: staged events own their parameters
+     */
+    StagedEvent(const StagedEvent &);
+
+    /**
+     *  @brief  Assignment operator, private and unimplemented: staged events own their parameters
+     */
+    StagedEvent &operator=(const StagedEvent &);
+
+    CaloHitParametersVector         m_caloHitParameters;    ///< The staged calo hit parameters
+    TrackParametersVector           m_trackParameters;      ///< The staged track parameters
+    MCParticleParametersVector      m_mcParticleParameters; ///< The staged mc particle parameters
+    RelationshipVector              m_relationships;        ///< The staged relationships
+
+    friend class FileReader;
+};
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 /**
  *  @brief  FileReader class
  */
@@ -51,6 +118,21 @@ public:
      */
     StatusCode ReadEvent();
 
+    /**
+     *  @brief  Read an entire pandora event from the file, decoding the stored objects into a staged event without
+     *          creating them. The file reader does not otherwise interact with the pandora instance during this call.
+     * 
+     *  @param  stagedEvent to receive the decoded event contents
+     */
+    StatusCode ReadEvent(StagedEvent &stagedEvent);
+
+    /**
+     *  @brief  Recreate the objects held in a staged event, which is cleared on completion
+     * 
+     *  @param  stagedEvent the staged event
+     */
+    StatusCode CreateEvent(StagedEvent &stagedEvent) const;
+
     /**
      *  @brief  Skip to next geometry container in the file
      */
@@ -102,8 +184,58 @@ protected:
      *  @brief  Read the next pandora event component from the current position in the file, recreating the stored component
      */
     virtual StatusCode ReadNextEventComponent() = 0;
+
+    /**
+     *  @brief  Create a calo hit or, if an event is being staged, add the parameters to the staged event
+     * 
+     *  @param  pParameters address of the calo hit parameters, ownership of which is taken by this function
+     */
+    StatusCode CreateCaloHit(PandoraApi::CaloHit::Parameters *const pParameters);
+
+    /**
+     *  @brief  Create a track or, if an event is being staged, add the parameters to the staged event
+     * 
+     *  @param  pParameters address of the track parameters, ownership of which is taken by this function
+     */
+    StatusCode CreateTrack(PandoraApi::Track::Parameters *const pParameters);
+
+    /**
+     *  @brief  Create a mc particle or, if an event is being staged, add the parameters to the staged event
+     * 
+     *  @param  pParameters address of the mc particle parameters, ownership of which is taken by this function
+     */
+    StatusCode CreateMCParticle(PandoraApi::MCParticle::Parameters *const pParameters);
+
+    /**
+     *  @brief  Create a relationship or, if an event is being staged, add the relationship to the staged event
+     * 
+     *  @param  relationshipId the relationship identification
+     *  @param  address1 address of the first object in the user framework
+     *  @param  address2 address of the second object in the user framework
+     *  @param  weight the relationship weight
+     */
+    StatusCode CreateRelationship(const RelationshipId relationshipId, const void *const address1, const void *const address2, const float weight);
+
+    /**
+     *  @brief  Create a relationship via the pandora api
+     * 
+     *  @param  relationshipId the relationship identification
+     *  @param  address1 address of the first object in the user framework
+     *  @param  address2 address of the second object in the user framework
+     *  @param  weight the relationship weight
+     */
+    StatusCode SetRelationship(const RelationshipId relationshipId, const void *const address1, const void *const address2, const float weight) const;
+
+    StagedEvent                    *m_pStagedEvent;         ///< Address of the event being staged, NULL if objects are to be created directly
 };
 
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline bool StagedEvent::IsEmpty() const
+{
+    return (m_caloHitParameters.empty() && m_trackParameters.empty() && m_mcParticleParameters.empty() && m_relationships.empty());
+}
+
 } // namespace pandora
 
 #endif // #ifndef PANDORA_FILE_READER_H
@@ -12,6 +12,9 @@ namespace pandora
 {
 
 const std::string PANDORA_FILE_HASH("pandora"); ///< Look for hash each event to check integrity
+const std::string PANDORA_COMPRESSED_FILE_HASH("pandoraBlock"); ///< Hash marking an event/geometry container stored as a compressed block
+const std::string PANDORA_TRACE_HASH("pandoraTrace"); ///< Look for hash at start of api trace to check integrity
+const unsigned int PANDORA_TRACE_VERSION(2); ///< The api trace format version
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
@@ -27,6 +30,18 @@ enum ContainerId
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+/**
+ *  @brief  The container codec enum, identifying the compression applied to a binary event/geometry container
+ */
+enum ContainerCodec
+{
+    NO_COMPRESSION,
+    BLOCK_COMPRESSION,
+    UNKNOWN_CODEC
+};
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 /**
  *  @brief  The component identification enum
  */
@@ -42,6 +57,8 @@ enum ComponentId
     BOX_GAP,
     CONCENTRIC_GAP,
     GEOMETRY_END,
+    CALO_HIT_CELL,
+    COMPACT_CALO_HIT,
     UNKNOWN_COMPONENT
 };
 
@@ -84,6 +101,29 @@ enum FileMode
     UNKNOWN_MODE
 };
 
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+/**
+ *  @brief  The api record identification enum, labelling each recorded PandoraApi call in an api trace
+ */
+enum ApiRecordId
+{
+    RECORD_CALO_HIT,
+    RECORD_TRACK,
+    RECORD_MC_PARTICLE,
+    RECORD_RELATIONSHIP,
+    RECORD_SUB_DETECTOR,
+    RECORD_LINE_GAP,
+    RECORD_BOX_GAP,
+    RECORD_CONCENTRIC_GAP,
+    RECORD_SETTINGS,
+    RECORD_HIT_TYPE_GRANULARITY,
+    RECORD_PROCESS_EVENT,
+    RECORD_RESET,
+    RECORD_ADVANCE_SLIDING_WINDOW,
+    UNKNOWN_RECORD
+};
+
 } // namespace pandora
 
 #endif // #ifndef PANDORA_IO_H
@@ -33,6 +33,14 @@ public:
      */
     virtual StatusCode MakeEnergyCorrections(const Cluster *const pCluster, float &correctedEnergy) const = 0;
 
+    /**
+     *  @brief  Make energy corrections to a vector of clusters. The default implementation corrects each cluster in turn.
+     * 
+     *  @param  clusterVector the vector of clusters
+     *  @param  correctedEnergyVector the energies to correct, in cluster vector order, to receive the corrected energies
+     */
+    virtual StatusCode MakeEnergyCorrections(const ClusterVector &clusterVector, FloatVector &correctedEnergyVector) const;
+
 protected:
     friend class EnergyCorrections;
 };
@@ -54,6 +62,16 @@ public:
      */
     StatusCode MakeEnergyCorrections(const Cluster *const pCluster, float &correctedElectromagneticEnergy, float &correctedHadronicEnergy) const;
 
+    /**
+     *  @brief  Make an ordered list of energy corrections to a vector of clusters, using the batch interface of each plugin
+     * 
+     *  @param  clusterVector the vector of clusters
+     *  @param  correctedElectromagneticEnergyVector to receive the corrected electromagnetic energies, in cluster vector order
+     *  @param  correctedHadronicEnergyVector to receive the corrected hadronic energies, in cluster vector order
+     */
+    StatusCode MakeEnergyCorrections(const ClusterVector &clusterVector, FloatVector &correctedElectromagneticEnergyVector,
+        FloatVector &correctedHadronicEnergyVector) const;
+
 private:
     /**
      *  @brief  Default constructor
@@ -29,6 +29,15 @@ public:
      */
     virtual bool IsMatch(const Cluster *const pCluster) const = 0;
 
+    /**
+     *  @brief  Whether each cluster in a vector matches the specific particle hypothesis. The default implementation considers
+     *          each cluster in turn.
+     * 
+     *  @param  clusterVector the vector of clusters
+     *  @param  isMatchVector to receive the results, in cluster vector order
+     */
+    virtual void IsMatch(const ClusterVector &clusterVector, BoolVector &isMatchVector) const;
+
 protected:
     friend class ParticleId;
 };
@@ -59,6 +68,22 @@ public:
      */
     bool IsPhoton(const Cluster *const pCluster) const;
 
+    /**
+     *  @brief  Provide identification of whether each cluster in a vector is an electromagnetic shower
+     * 
+     *  @param  clusterVector the vector of clusters
+     *  @param  isEmShowerVector to receive the results, in cluster vector order
+     */
+    void IsEmShower(const ClusterVector &clusterVector, BoolVector &isEmShowerVector) const;
+
+    /**
+     *  @brief  Provide identification of whether each cluster in a vector is a photon
+     * 
+     *  @param  clusterVector the vector of clusters
+     *  @param  isPhotonVector to receive the results, in cluster vector order
+     */
+    void IsPhoton(const ClusterVector &clusterVector, BoolVector &isPhotonVector) const;
+
     /**
      *  @brief  Provide identification of whether a cluster is an electron
      * 
@@ -0,0 +1,48 @@
+/**
+ *  @file   PandoraSDK/include/Plugins/RegionPartitionPlugin.h
+ *
+ *  @brief  Header file for the region partition plugin interface class.
+ *
+ *  $Log: $
+ */
+#ifndef PANDORA_REGION_PARTITION_PLUGIN_H
+#define PANDORA_REGION_PARTITION_PLUGIN_H 1
+
+#include "Api/PandoraApi.h"
+
+#include "Pandora/PandoraInternal.h"
+#include "Pandora/Process.h"
+
+namespace pandora
+{
+
+/**
+ *  @brief  RegionPartitionPlugin class, assigning input calo hits and tracks to the largely independent regions of an event, each of
+ *          which is reconstructed by its own region pandora instance
+ */
+class RegionPartitionPlugin : public Process
+{
+public:
+    /**
+     *  @brief  Get the region to which a calo hit should be assigned
+     *
+     *  @param  parameters the calo hit parameters
+     *  @param  region to receive the region index, in the order in which the region instances were added
+     */
+    virtual StatusCode GetRegion(const PandoraApi::CaloHit::Parameters &parameters, unsigned int &region) const = 0;
+
+    /**
+     *  @brief  Get the region to which a track should be assigned
+     *
+     *  @param  parameters the track parameters
+     *  @param  region to receive the region index, in the order in which the region instances were added
+     */
+    virtual StatusCode GetRegion(const PandoraApi::Track::Parameters &parameters, unsigned int &region) const = 0;
+
+protected:
+    friend class PluginManager;
+};
+
+} // namespace pandora
+
+#endif // #ifndef PANDORA_REGION_PARTITION_PLUGIN_H
@@ -91,6 +91,25 @@ public:
      */
     virtual void CalculateLongitudinalProfile(const Cluster *const pCluster, float &profileStart, float &profileDiscrepancy) const = 0;
 
+    /**
+     *  @brief  Get the shower start layer for each cluster in a vector. The default implementation considers each cluster in turn.
+     * 
+     *  @param  clusterVector the vector of clusters
+     *  @param  showerStartLayerVector to receive the shower start layers, in cluster vector order
+     */
+    virtual void CalculateShowerStartLayer(const ClusterVector &clusterVector, UIntVector &showerStartLayerVector) const;
+
+    /**
+     *  @brief  Calculate longitudinal shower profile for each cluster in a vector. The default implementation considers each
+     *          cluster in turn.
+     * 
+     *  @param  clusterVector the vector of clusters
+     *  @param  profileStartVector to receive the profile starts, in radiation lengths, in cluster vector order
+     *  @param  profileDiscrepancyVector to receive the profile discrepancies, in cluster vector order
+     */
+    virtual void CalculateLongitudinalProfile(const ClusterVector &clusterVector, FloatVector &profileStartVector,
+        FloatVector &profileDiscrepancyVector) const;
+
     /**
      *  @brief  Calculate transverse shower profile for a cluster and get the list of peaks identified in the profile
      * 
@@ -104,6 +104,24 @@ pandora::StatusCode PandoraApi::GetPfoList(const pandora::Pandora &pandora, cons
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+pandora::StatusCode PandoraApi::ExportCurrentPfoList(const pandora::Pandora &pandora, pandora::PfoExportBuffer &pfoExportBuffer)
+{
+    return pandora.GetPandoraApiImpl()->ExportPfoList(std::string(), pfoExportBuffer);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+pandora::StatusCode PandoraApi::ExportPfoList(const pandora::Pandora &pandora, const std::string &pfoListName,
+    pandora::PfoExportBuffer &pfoExportBuffer)
+{
+    if (pfoListName.empty())
+        return pandora::STATUS_CODE_INVALID_PARAMETER;
+
+    return pandora.GetPandoraApiImpl()->ExportPfoList(pfoListName, pfoExportBuffer);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 pandora::StatusCode PandoraApi::SetHitTypeGranularity(const pandora::Pandora &pandora, const pandora::HitType hitType,
     const pandora::Granularity granularity)
 {
@@ -133,6 +151,20 @@ pandora::StatusCode PandoraApi::SetShowerProfilePlugin(const pandora::Pandora &p
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+pandora::StatusCode PandoraApi::SetRegionPartitionPlugin(const pandora::Pandora &pandora, pandora::RegionPartitionPlugin *const pRegionPartitionPlugin)
+{
+    return pandora.GetPandoraApiImpl()->SetRegionPartitionPlugin(pRegionPartitionPlugin);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+pandora::StatusCode PandoraApi::AddRegionInstance(const pandora::Pandora &pandora, const pandora::Pandora &regionPandora)
+{
+    return pandora.GetPandoraApiImpl()->AddRegionInstance(&regionPandora);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 pandora::StatusCode PandoraApi::RegisterEnergyCorrectionPlugin(const pandora::Pandora &pandora, const std::string &name,
     const pandora::EnergyCorrectionType energyCorrectionType, pandora::EnergyCorrectionPlugin *const pEnergyCorrectionPlugin)
 {
@@ -154,6 +186,49 @@ pandora::StatusCode PandoraApi::Reset(const pandora::Pandora &pandora)
     return pandora.GetPandoraApiImpl()->ResetEvent();
 }
 
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+pandora::StatusCode PandoraApi::AdvanceSlidingWindow(const pandora::Pandora &pandora, const float windowStartTime)
+{
+    return pandora.GetPandoraApiImpl()->AdvanceSlidingWindow(windowStartTime);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+pandora::StatusCode PandoraApi::SetEventSizeHint(const pandora::Pandora &pandora, const unsigned int nCaloHits, const unsigned int nTracks,
+    const unsigned int nMCParticles)
+{
+    return pandora.GetPandoraApiImpl()->SetEventSizeHint(nCaloHits, nTracks, nMCParticles);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+pandora::StatusCode PandoraApi::GetEventResourceReport(const pandora::Pandora &pandora, pandora::EventResourceReport &eventResourceReport)
+{
+    return pandora.GetPandoraApiImpl()->GetEventResourceReport(eventResourceReport);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+pandora::StatusCode PandoraApi::StartRecording(const pandora::Pandora &pandora, const std::string &traceFileName)
+{
+    return pandora.GetPandoraApiImpl()->StartRecording(traceFileName);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+pandora::StatusCode PandoraApi::StopRecording(const pandora::Pandora &pandora)
+{
+    return pandora.GetPandoraApiImpl()->StopRecording();
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+pandora::StatusCode PandoraApi::ReplayTrace(const pandora::Pandora &pandora, const std::string &traceFileName)
+{
+    return pandora.GetPandoraApiImpl()->ReplayTrace(traceFileName);
+}
+
 //------------------------------------------------------------------------------------------------------------------------------------------
 //------------------------------------------------------------------------------------------------------------------------------------------
 
@@ -19,8 +19,12 @@
 #include "Managers/TrackManager.h"
 #include "Managers/VertexManager.h"
 
+#include "Pandora/PandoraImpl.h"
 #include "Pandora/PandoraSettings.h"
 
+#include "Persistency/ApiRecorder.h"
+#include "Persistency/ApiReplayer.h"
+
 #include "Plugins/EnergyCorrectionsPlugin.h"
 #include "Plugins/ParticleIdPlugin.h"
 
@@ -31,43 +35,99 @@ template <>
 StatusCode PandoraApiImpl::Create(const PandoraApi::MCParticle::Parameters &parameters,
     const ObjectFactory<PandoraApi::MCParticle::Parameters, MCParticle> &factory) const
 {
+    // Mc particles are needed by every region instance, to match the calo hits and tracks passed to it
+    for (PandoraImpl::PandoraVector::const_iterator iter = m_pPandora->m_pPandoraImpl->m_regionPandoraVector.begin(),
+        iterEnd = m_pPandora->m_pPandoraImpl->m_regionPandoraVector.end(); iter != iterEnd; ++iter)
+    {
+        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, (*iter)->GetPandoraApiImpl()->Create(parameters, factory));
+    }
+
+    // Only successful calls are recorded, so that replay does not fail where the original input was rejected
     const MCParticle *pMCParticle(NULL);
-    return m_pPandora->m_pMCManager->Create(parameters, pMCParticle, factory);
+    const StatusCode statusCode(m_pPandora->m_pMCManager->Create(parameters, pMCParticle, factory));
+
+    if ((STATUS_CODE_SUCCESS == statusCode) && (NULL != m_pPandora->m_pApiRecorder))
+        return m_pPandora->m_pApiRecorder->Record(parameters, factory);
+
+    return statusCode;
 }
 
 template <>
 StatusCode PandoraApiImpl::Create(const PandoraApi::Track::Parameters &parameters,
     const ObjectFactory<PandoraApi::Track::Parameters, Track> &factory) const
 {
+    const Pandora *pRegionPandora(NULL);
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, m_pPandora->m_pPandoraImpl->GetRegionInstance(parameters, pRegionPandora));
+
     const Track *pTrack(NULL);
-    return m_pPandora->m_pTrackManager->Create(parameters, pTrack, factory);
+    const StatusCode statusCode((NULL != pRegionPandora) ? pRegionPandora->GetPandoraApiImpl()->Create(parameters, factory) :
+        m_pPandora->m_pTrackManager->Create(parameters, pTrack, factory));
+
+    if (STATUS_CODE_SUCCESS != statusCode)
+        return statusCode;
+
+    if (NULL != pRegionPandora)
+        m_pPandora->m_pPandoraImpl->m_trackRegionMap[parameters.m_pParentAddress.Get()] = pRegionPandora;
+
+    if (NULL != m_pPandora->m_pApiRecorder)
+        return m_pPandora->m_pApiRecorder->Record(parameters, factory);
+
+    return STATUS_CODE_SUCCESS;
 }
 
 template <>
 StatusCode PandoraApiImpl::Create(const PandoraApi::CaloHit::Parameters &parameters,
     const ObjectFactory<PandoraApi::CaloHit::Parameters, CaloHit> &factory) const
 {
+    const Pandora *pRegionPandora(NULL);
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, m_pPandora->m_pPandoraImpl->GetRegionInstance(parameters, pRegionPandora));
+
     const CaloHit *pCaloHit(NULL);
-    return m_pPandora->m_pCaloHitManager->Create(parameters, pCaloHit, factory);
+    const StatusCode statusCode((NULL != pRegionPandora) ? pRegionPandora->GetPandoraApiImpl()->Create(parameters, factory) :
+        m_pPandora->m_pCaloHitManager->Create(parameters, pCaloHit, factory));
+
+    if (STATUS_CODE_SUCCESS != statusCode)
+        return statusCode;
+
+    if (NULL != pRegionPandora)
+        m_pPandora->m_pPandoraImpl->m_caloHitRegionMap[parameters.m_pParentAddress.Get()] = pRegionPandora;
+
+    if (NULL != m_pPandora->m_pApiRecorder)
+        return m_pPandora->m_pApiRecorder->Record(parameters, factory);
+
+    return STATUS_CODE_SUCCESS;
 }
 
 template <>
 StatusCode PandoraApiImpl::Create(const PandoraApi::Geometry::SubDetector::Parameters &parameters,
     const ObjectFactory<PandoraApi::Geometry::SubDetector::Parameters, SubDetector> &factory) const
 {
-    return m_pPandora->m_pGeometryManager->CreateSubDetector(parameters, factory);
+    const StatusCode statusCode(m_pPandora->m_pGeometryManager->CreateSubDetector(parameters, factory));
+
+    if ((STATUS_CODE_SUCCESS == statusCode) && (NULL != m_pPandora->m_pApiRecorder))
+        return m_pPandora->m_pApiRecorder->Record(parameters, factory);
+
+    return statusCode;
 }
 
 template <typename PARAMETERS, typename OBJECT>
 StatusCode PandoraApiImpl::Create(const PARAMETERS &parameters, const ObjectFactory<PARAMETERS, OBJECT> &factory) const
 {
-    return m_pPandora->m_pGeometryManager->CreateGap(parameters, factory);
+    const StatusCode statusCode(m_pPandora->m_pGeometryManager->CreateGap(parameters, factory));
+
+    if ((STATUS_CODE_SUCCESS == statusCode) && (NULL != m_pPandora->m_pApiRecorder))
+        return m_pPandora->m_pApiRecorder->Record(parameters, factory);
+
+    return statusCode;
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 StatusCode PandoraApiImpl::ProcessEvent() const
 {
+    if (NULL != m_pPandora->m_pApiRecorder)
+        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, m_pPandora->m_pApiRecorder->RecordProcessEvent());
+
     return m_pPandora->ProcessEvent();
 }
 
@@ -75,11 +135,21 @@ StatusCode PandoraApiImpl::ProcessEvent() const
 
 StatusCode PandoraApiImpl::ReadSettings(const std::string &xmlFileName) const
 {
+    if (NULL != m_pPandora->m_pApiRecorder)
+        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, m_pPandora->m_pApiRecorder->RecordSettings(xmlFileName));
+
     return m_pPandora->ReadSettings(xmlFileName);
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+StatusCode PandoraApiImpl::ReadSettings(TiXmlDocument &xmlDocument) const
+{
+    return m_pPandora->ReadSettings(xmlDocument);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 StatusCode PandoraApiImpl::RegisterAlgorithmFactory(const std::string &algorithmType, AlgorithmFactory *const pAlgorithmFactory) const
 {
     return m_pPandora->m_pAlgorithmManager->RegisterAlgorithmFactory(algorithmType, pAlgorithmFactory);
@@ -96,21 +166,58 @@ StatusCode PandoraApiImpl::RegisterAlgorithmToolFactory(const std::string &algor
 
 StatusCode PandoraApiImpl::SetMCParentDaughterRelationship(const void *const pParentAddress, const void *const pDaughterAddress) const
 {
-    return m_pPandora->m_pMCManager->SetMCParentDaughterRelationship(pParentAddress, pDaughterAddress);
+    for (PandoraImpl::PandoraVector::const_iterator iter = m_pPandora->m_pPandoraImpl->m_regionPandoraVector.begin(),
+        iterEnd = m_pPandora->m_pPandoraImpl->m_regionPandoraVector.end(); iter != iterEnd; ++iter)
+    {
+        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, (*iter)->GetPandoraApiImpl()->SetMCParentDaughterRelationship(pParentAddress,
+            pDaughterAddress));
+    }
+
+    const StatusCode statusCode(m_pPandora->m_pMCManager->SetMCParentDaughterRelationship(pParentAddress, pDaughterAddress));
+
+    if ((STATUS_CODE_SUCCESS == statusCode) && (NULL != m_pPandora->m_pApiRecorder))
+        return m_pPandora->m_pApiRecorder->RecordRelationship(MC_PARENT_DAUGHTER, pParentAddress, pDaughterAddress, 1.f);
+
+    return statusCode;
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 StatusCode PandoraApiImpl::SetTrackParentDaughterRelationship(const void *const pParentAddress, const void *const pDaughterAddress) const
 {
-    return m_pPandora->m_pTrackManager->SetTrackParentDaughterRelationship(pParentAddress, pDaughterAddress);
+    // Related tracks must have been passed to the same region instance, or neither passed to a region instance
+    const Pandora *const pRegionPandora(m_pPandora->m_pPandoraImpl->GetTrackRegionInstance(pParentAddress));
+
+    if (pRegionPandora != m_pPandora->m_pPandoraImpl->GetTrackRegionInstance(pDaughterAddress))
+        return STATUS_CODE_NOT_ALLOWED;
+
+    const StatusCode statusCode((NULL != pRegionPandora) ?
+        pRegionPandora->GetPandoraApiImpl()->SetTrackParentDaughterRelationship(pParentAddress, pDaughterAddress) :
+        m_pPandora->m_pTrackManager->SetTrackParentDaughterRelationship(pParentAddress, pDaughterAddress));
+
+    if ((STATUS_CODE_SUCCESS == statusCode) && (NULL != m_pPandora->m_pApiRecorder))
+        return m_pPandora->m_pApiRecorder->RecordRelationship(TRACK_PARENT_DAUGHTER, pParentAddress, pDaughterAddress, 1.f);
+
+    return statusCode;
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 StatusCode PandoraApiImpl::SetTrackSiblingRelationship(const void *const pFirstSiblingAddress, const void *const pSecondSiblingAddress) const
 {
-    return m_pPandora->m_pTrackManager->SetTrackSiblingRelationship(pFirstSiblingAddress, pSecondSiblingAddress);
+    const Pandora *const pRegionPandora(m_pPandora->m_pPandoraImpl->GetTrackRegionInstance(pFirstSiblingAddress));
+
+    if (pRegionPandora != m_pPandora->m_pPandoraImpl->GetTrackRegionInstance(pSecondSiblingAddress))
+        return STATUS_CODE_NOT_ALLOWED;
+
+    const StatusCode statusCode((NULL != pRegionPandora) ?
+        pRegionPandora->GetPandoraApiImpl()->SetTrackSiblingRelationship(pFirstSiblingAddress, pSecondSiblingAddress) :
+        m_pPandora->m_pTrackManager->SetTrackSiblingRelationship(pFirstSiblingAddress, pSecondSiblingAddress));
+
+    if ((STATUS_CODE_SUCCESS == statusCode) && (NULL != m_pPandora->m_pApiRecorder))
+        return m_pPandora->m_pApiRecorder->RecordRelationship(TRACK_SIBLING, pFirstSiblingAddress, pSecondSiblingAddress, 1.f);
+
+    return statusCode;
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -118,7 +225,16 @@ StatusCode PandoraApiImpl::SetTrackSiblingRelationship(const void *const pFirstS
 StatusCode PandoraApiImpl::SetCaloHitToMCParticleRelationship(const void *const pCaloHitParentAddress, const void *const pMCParticleParentAddress,
     const float mcParticleWeight) const
 {
-    return m_pPandora->m_pMCManager->SetCaloHitToMCParticleRelationship(pCaloHitParentAddress, pMCParticleParentAddress, mcParticleWeight);
+    const Pandora *const pRegionPandora(m_pPandora->m_pPandoraImpl->GetCaloHitRegionInstance(pCaloHitParentAddress));
+
+    const StatusCode statusCode((NULL != pRegionPandora) ?
+        pRegionPandora->GetPandoraApiImpl()->SetCaloHitToMCParticleRelationship(pCaloHitParentAddress, pMCParticleParentAddress, mcParticleWeight) :
+        m_pPandora->m_pMCManager->SetCaloHitToMCParticleRelationship(pCaloHitParentAddress, pMCParticleParentAddress, mcParticleWeight));
+
+    if ((STATUS_CODE_SUCCESS == statusCode) && (NULL != m_pPandora->m_pApiRecorder))
+        return m_pPandora->m_pApiRecorder->RecordRelationship(CALO_HIT_TO_MC, pCaloHitParentAddress, pMCParticleParentAddress, mcParticleWeight);
+
+    return statusCode;
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -126,7 +242,16 @@ StatusCode PandoraApiImpl::SetCaloHitToMCParticleRelationship(const void *const
 StatusCode PandoraApiImpl::SetTrackToMCParticleRelationship(const void *const pTrackParentAddress, const void *const pMCParticleParentAddress,
     const float mcParticleWeight) const
 {
-    return m_pPandora->m_pMCManager->SetTrackToMCParticleRelationship(pTrackParentAddress, pMCParticleParentAddress, mcParticleWeight);
+    const Pandora *const pRegionPandora(m_pPandora->m_pPandoraImpl->GetTrackRegionInstance(pTrackParentAddress));
+
+    const StatusCode statusCode((NULL != pRegionPandora) ?
+        pRegionPandora->GetPandoraApiImpl()->SetTrackToMCParticleRelationship(pTrackParentAddress, pMCParticleParentAddress, mcParticleWeight) :
+        m_pPandora->m_pMCManager->SetTrackToMCParticleRelationship(pTrackParentAddress, pMCParticleParentAddress, mcParticleWeight));
+
+    if ((STATUS_CODE_SUCCESS == statusCode) && (NULL != m_pPandora->m_pApiRecorder))
+        return m_pPandora->m_pApiRecorder->RecordRelationship(TRACK_TO_MC, pTrackParentAddress, pMCParticleParentAddress, mcParticleWeight);
+
+    return statusCode;
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -145,8 +270,32 @@ StatusCode PandoraApiImpl::GetPfoList(const std::string &pfoListName, const PfoL
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+StatusCode PandoraApiImpl::ExportPfoList(const std::string &pfoListName, PfoExportBuffer &pfoExportBuffer) const
+{
+    const PfoList *pPfoList(NULL);
+
+    if (pfoListName.empty())
+    {
+        std::string currentListName;
+        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, m_pPandora->m_pPfoManager->GetCurrentList(pPfoList, currentListName));
+    }
+    else
+    {
+        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, m_pPandora->m_pPfoManager->GetList(pfoListName, pPfoList));
+    }
+
+    pfoExportBuffer.Fill(*pPfoList);
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 StatusCode PandoraApiImpl::SetHitTypeGranularity(const HitType hitType, const Granularity granularity) const
 {
+    if (NULL != m_pPandora->m_pApiRecorder)
+        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, m_pPandora->m_pApiRecorder->RecordHitTypeGranularity(hitType, granularity));
+
     return m_pPandora->m_pGeometryManager->SetHitTypeGranularity(hitType, granularity);
 }
 
@@ -173,6 +322,20 @@ StatusCode PandoraApiImpl::SetShowerProfilePlugin(ShowerProfilePlugin *const pSh
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+StatusCode PandoraApiImpl::SetRegionPartitionPlugin(RegionPartitionPlugin *const pRegionPartitionPlugin) const
+{
+    return m_pPandora->m_pPluginManager->SetRegionPartitionPlugin(pRegionPartitionPlugin);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode PandoraApiImpl::AddRegionInstance(const Pandora *const pRegionPandora) const
+{
+    return m_pPandora->m_pPandoraImpl->AddRegionInstance(pRegionPandora);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 StatusCode PandoraApiImpl::RegisterEnergyCorrectionPlugin(const std::string &name, const EnergyCorrectionType energyCorrectionType,
     EnergyCorrectionPlugin *const pEnergyCorrectionPlugin) const
 {
@@ -190,11 +353,111 @@ StatusCode PandoraApiImpl::RegisterParticleIdPlugin(const std::string &name, Par
 
 StatusCode PandoraApiImpl::ResetEvent() const
 {
+    // A region instance holds objects referred to by the pfos of its primary instance, so is reset only with the primary instance
+    if (NULL != m_pPandora->m_pPandoraImpl->m_pPrimaryPandora)
+        return STATUS_CODE_NOT_ALLOWED;
+
+    if (NULL != m_pPandora->m_pApiRecorder)
+        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, m_pPandora->m_pApiRecorder->RecordReset());
+
     return m_pPandora->ResetEvent();
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+StatusCode PandoraApiImpl::AdvanceSlidingWindow(const float windowStartTime) const
+{
+    // As for the event reset, a region instance is advanced only with its primary instance
+    if (NULL != m_pPandora->m_pPandoraImpl->m_pPrimaryPandora)
+        return STATUS_CODE_NOT_ALLOWED;
+
+    if (NULL != m_pPandora->m_pApiRecorder)
+        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, m_pPandora->m_pApiRecorder->RecordAdvanceSlidingWindow(windowStartTime));
+
+    return m_pPandora->m_pPandoraImpl->AdvanceSlidingWindow(windowStartTime);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode PandoraApiImpl::SetEventSizeHint(const unsigned int nCaloHits, const unsigned int nTracks, const unsigned int nMCParticles) const
+{
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, m_pPandora->m_pCaloHitManager->SetEventSizeHint(nCaloHits));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, m_pPandora->m_pTrackManager->SetEventSizeHint(nTracks));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, m_pPandora->m_pMCManager->SetEventSizeHint(nMCParticles));
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode PandoraApiImpl::GetEventResourceReport(EventResourceReport &eventResourceReport) const
+{
+    return m_pPandora->m_pPandoraImpl->GetEventResourceReport(eventResourceReport);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode PandoraApiImpl::StartRecording(const std::string &traceFileName) const
+{
+    if (NULL != m_pPandora->m_pApiRecorder)
+        return STATUS_CODE_ALREADY_INITIALIZED;
+
+    try
+    {
+        m_pPandora->m_pApiRecorder = new ApiRecorder(traceFileName);
+    }
+    catch (StatusCodeException &statusCodeException)
+    {
+        std::cout << "PandoraApiImpl::StartRecording - unable to open trace file " << traceFileName << std::endl;
+        return statusCodeException.GetStatusCode();
+    }
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode PandoraApiImpl::StopRecording() const
+{
+    if (NULL == m_pPandora->m_pApiRecorder)
+        return STATUS_CODE_NOT_INITIALIZED;
+
+    delete m_pPandora->m_pApiRecorder;
+    m_pPandora->m_pApiRecorder = NULL;
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode PandoraApiImpl::ReplayTrace(const std::string &traceFileName) const
+{
+    try
+    {
+        ApiReplayer apiReplayer(*m_pPandora, traceFileName);
+        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, apiReplayer.ReplayAll());
+    }
+    catch (StatusCodeException &statusCodeException)
+    {
+        std::cout << "PandoraApiImpl::ReplayTrace - unable to read trace file " << traceFileName << std::endl;
+        return statusCodeException.GetStatusCode();
+    }
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+ApiRecorder *PandoraApiImpl::SetApiRecorder(ApiRecorder *const pApiRecorder)
+{
+    ApiRecorder *const pPreviousApiRecorder(m_pPandora->m_pApiRecorder);
+    m_pPandora->m_pApiRecorder = pApiRecorder;
+
+    return pPreviousApiRecorder;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 PandoraApiImpl::PandoraApiImpl(Pandora *const pPandora) :
     m_pPandora(pPandora)
 {
@@ -60,6 +60,13 @@ pandora::StatusCode PandoraContentApi::RepeatEventPreparation(const pandora::Alg
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+pandora::StatusCode PandoraContentApi::CompleteEventPreparation(const pandora::Algorithm &algorithm)
+{
+    return algorithm.GetPandora().GetPandoraContentApiImpl()->CompleteEventPreparation();
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 pandora::StatusCode PandoraContentApi::CreateAlgorithmTool(const pandora::Algorithm &algorithm, pandora::TiXmlElement *const pXmlElement,
     pandora::AlgorithmTool *&pAlgorithmTool)
 {
@@ -91,6 +98,14 @@ pandora::StatusCode PandoraContentApi::RunClusteringAlgorithm(const pandora::Alg
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+pandora::StatusCode PandoraContentApi::RunReadOnlyTasks(const pandora::Algorithm &algorithm, const unsigned int nIndices,
+    const pandora::ThreadPool::Task &task)
+{
+    return algorithm.GetPandora().GetPandoraContentApiImpl()->RunReadOnlyTasks(nIndices, task);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 template <typename T>
 pandora::StatusCode PandoraContentApi::GetCurrentList(const pandora::Algorithm &algorithm, const T *&pT)
 {
@@ -116,6 +131,22 @@ pandora::StatusCode PandoraContentApi::GetCurrentListName(const pandora::Algorit
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+template <typename T>
+pandora::StatusCode PandoraContentApi::GetCurrentListHandle(const pandora::Algorithm &algorithm, pandora::ListHandle &listHandle)
+{
+    return algorithm.GetPandora().GetPandoraContentApiImpl()->GetCurrentListHandle<T>(listHandle);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename T>
+pandora::StatusCode PandoraContentApi::GetListHandle(const pandora::Algorithm &algorithm, const std::string &listName, pandora::ListHandle &listHandle)
+{
+    return algorithm.GetPandora().GetPandoraContentApiImpl()->GetListHandle<T>(listName, listHandle);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 template <typename T>
 pandora::StatusCode PandoraContentApi::ReplaceCurrentList(const pandora::Algorithm &algorithm, const std::string &newListName)
 {
@@ -124,6 +155,14 @@ pandora::StatusCode PandoraContentApi::ReplaceCurrentList(const pandora::Algorit
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+template <typename T>
+pandora::StatusCode PandoraContentApi::ReplaceCurrentList(const pandora::Algorithm &algorithm, const pandora::ListHandle newListHandle)
+{
+    return algorithm.GetPandora().GetPandoraContentApiImpl()->ReplaceCurrentList<T>(algorithm, newListHandle);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 template <typename T>
 pandora::StatusCode PandoraContentApi::DropCurrentList(const pandora::Algorithm &algorithm)
 {
@@ -140,6 +179,14 @@ pandora::StatusCode PandoraContentApi::GetList(const pandora::Algorithm &algorit
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+template <typename T>
+pandora::StatusCode PandoraContentApi::GetList(const pandora::Algorithm &algorithm, const pandora::ListHandle listHandle, const T *&pT)
+{
+    return algorithm.GetPandora().GetPandoraContentApiImpl()->GetList(listHandle, pT);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 template <typename T>
 pandora::StatusCode PandoraContentApi::SaveList(const pandora::Algorithm &algorithm, const T &t, const std::string &newListName)
 {
@@ -190,6 +237,14 @@ pandora::StatusCode PandoraContentApi::TemporarilyReplaceCurrentList(const pando
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+template <typename T>
+pandora::StatusCode PandoraContentApi::TemporarilyReplaceCurrentList(const pandora::Algorithm &algorithm, const pandora::ListHandle newListHandle)
+{
+    return algorithm.GetPandora().GetPandoraContentApiImpl()->TemporarilyReplaceCurrentList<T>(newListHandle);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 template <typename T>
 pandora::StatusCode PandoraContentApi::CreateTemporaryListAndSetCurrent(const pandora::Algorithm &algorithm, const T *&pT,
     std::string &temporaryListName)
@@ -264,6 +319,15 @@ pandora::StatusCode PandoraContentApi::Fragment(const pandora::Algorithm &algori
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+pandora::StatusCode PandoraContentApi::Fragment(const pandora::Algorithm &algorithm, const pandora::CaloHitVector &originalCaloHits,
+    const pandora::FloatVector &fractions, pandora::CaloHitVector &daughterCaloHits,
+    const pandora::ObjectFactory<CaloHitFragment::Parameters, pandora::CaloHit> &factory)
+{
+    return algorithm.GetPandora().GetPandoraContentApiImpl()->Fragment(originalCaloHits, fractions, daughterCaloHits, factory);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 pandora::StatusCode PandoraContentApi::MergeFragments(const pandora::Algorithm &algorithm, const pandora::CaloHit *const pFragmentCaloHit1,
     const pandora::CaloHit *const pFragmentCaloHit2, const pandora::CaloHit *&pMergedCaloHit,
     const pandora::ObjectFactory<CaloHitFragment::Parameters, pandora::CaloHit> &factory)
@@ -326,6 +390,14 @@ pandora::StatusCode PandoraContentApi::MergeAndDeleteClusters(const pandora::Alg
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+pandora::StatusCode PandoraContentApi::PrepareClusterProperties(const pandora::Algorithm &algorithm, const pandora::ClusterList &clusterList,
+    const unsigned int clusterProperties, const bool useThreadPool)
+{
+    return algorithm.GetPandora().GetPandoraContentApiImpl()->PrepareClusterProperties(clusterList, clusterProperties, useThreadPool);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 template <typename T>
 pandora::StatusCode PandoraContentApi::AddToPfo(const pandora::Algorithm &algorithm, const pandora::ParticleFlowObject *const pPfo, const T *const pT)
 {
@@ -424,6 +496,20 @@ template pandora::StatusCode PandoraContentApi::GetCurrentListName<pandora::Clus
 template pandora::StatusCode PandoraContentApi::GetCurrentListName<pandora::ParticleFlowObject>(const pandora::Algorithm &, std::string &);
 template pandora::StatusCode PandoraContentApi::GetCurrentListName<pandora::Vertex>(const pandora::Algorithm &, std::string &);
 
+template pandora::StatusCode PandoraContentApi::GetCurrentListHandle<pandora::CaloHit>(const pandora::Algorithm &, pandora::ListHandle &);
+template pandora::StatusCode PandoraContentApi::GetCurrentListHandle<pandora::Track>(const pandora::Algorithm &, pandora::ListHandle &);
+template pandora::StatusCode PandoraContentApi::GetCurrentListHandle<pandora::MCParticle>(const pandora::Algorithm &, pandora::ListHandle &);
+template pandora::StatusCode PandoraContentApi::GetCurrentListHandle<pandora::Cluster>(const pandora::Algorithm &, pandora::ListHandle &);
+template pandora::StatusCode PandoraContentApi::GetCurrentListHandle<pandora::ParticleFlowObject>(const pandora::Algorithm &, pandora::ListHandle &);
+template pandora::StatusCode PandoraContentApi::GetCurrentListHandle<pandora::Vertex>(const pandora::Algorithm &, pandora::ListHandle &);
+
+template pandora::StatusCode PandoraContentApi::GetListHandle<pandora::CaloHit>(const pandora::Algorithm &, const std::string &, pandora::ListHandle &);
+template pandora::StatusCode PandoraContentApi::GetListHandle<pandora::Track>(const pandora::Algorithm &, const std::string &, pandora::ListHandle &);
+template pandora::StatusCode PandoraContentApi::GetListHandle<pandora::MCParticle>(const pandora::Algorithm &, const std::string &, pandora::ListHandle &);
+template pandora::StatusCode PandoraContentApi::GetListHandle<pandora::Cluster>(const pandora::Algorithm &, const std::string &, pandora::ListHandle &);
+template pandora::StatusCode PandoraContentApi::GetListHandle<pandora::ParticleFlowObject>(const pandora::Algorithm &, const std::string &, pandora::ListHandle &);
+template pandora::StatusCode PandoraContentApi::GetListHandle<pandora::Vertex>(const pandora::Algorithm &, const std::string &, pandora::ListHandle &);
+
 template pandora::StatusCode PandoraContentApi::ReplaceCurrentList<pandora::CaloHit>(const pandora::Algorithm &, const std::string &);
 template pandora::StatusCode PandoraContentApi::ReplaceCurrentList<pandora::Track>(const pandora::Algorithm &, const std::string &);
 template pandora::StatusCode PandoraContentApi::ReplaceCurrentList<pandora::MCParticle>(const pandora::Algorithm &, const std::string &);
@@ -431,6 +517,13 @@ template pandora::StatusCode PandoraContentApi::ReplaceCurrentList<pandora::Clus
 template pandora::StatusCode PandoraContentApi::ReplaceCurrentList<pandora::ParticleFlowObject>(const pandora::Algorithm &, const std::string &);
 template pandora::StatusCode PandoraContentApi::ReplaceCurrentList<pandora::Vertex>(const pandora::Algorithm &, const std::string &);
 
+template pandora::StatusCode PandoraContentApi::ReplaceCurrentList<pandora::CaloHit>(const pandora::Algorithm &, const pandora::ListHandle);
+template pandora::StatusCode PandoraContentApi::ReplaceCurrentList<pandora::Track>(const pandora::Algorithm &, const pandora::ListHandle);
+template pandora::StatusCode PandoraContentApi::ReplaceCurrentList<pandora::MCParticle>(const pandora::Algorithm &, const pandora::ListHandle);
+template pandora::StatusCode PandoraContentApi::ReplaceCurrentList<pandora::Cluster>(const pandora::Algorithm &, const pandora::ListHandle);
+template pandora::StatusCode PandoraContentApi::ReplaceCurrentList<pandora::ParticleFlowObject>(const pandora::Algorithm &, const pandora::ListHandle);
+template pandora::StatusCode PandoraContentApi::ReplaceCurrentList<pandora::Vertex>(const pandora::Algorithm &, const pandora::ListHandle);
+
 template pandora::StatusCode PandoraContentApi::DropCurrentList<pandora::CaloHit>(const pandora::Algorithm &);
 template pandora::StatusCode PandoraContentApi::DropCurrentList<pandora::Track>(const pandora::Algorithm &);
 template pandora::StatusCode PandoraContentApi::DropCurrentList<pandora::MCParticle>(const pandora::Algorithm &);
@@ -445,6 +538,13 @@ template pandora::StatusCode PandoraContentApi::GetList<pandora::ClusterList>(co
 template pandora::StatusCode PandoraContentApi::GetList<pandora::PfoList>(const pandora::Algorithm &, const std::string &, const pandora::PfoList *&);
 template pandora::StatusCode PandoraContentApi::GetList<pandora::VertexList>(const pandora::Algorithm &, const std::string &, const pandora::VertexList *&);
 
+template pandora::StatusCode PandoraContentApi::GetList<pandora::CaloHitList>(const pandora::Algorithm &, const pandora::ListHandle, const pandora::CaloHitList *&);
+template pandora::StatusCode PandoraContentApi::GetList<pandora::TrackList>(const pandora::Algorithm &, const pandora::ListHandle, const pandora::TrackList *&);
+template pandora::StatusCode PandoraContentApi::GetList<pandora::MCParticleList>(const pandora::Algorithm &, const pandora::ListHandle, const pandora::MCParticleList *&);
+template pandora::StatusCode PandoraContentApi::GetList<pandora::ClusterList>(const pandora::Algorithm &, const pandora::ListHandle, const pandora::ClusterList *&);
+template pandora::StatusCode PandoraContentApi::GetList<pandora::PfoList>(const pandora::Algorithm &, const pandora::ListHandle, const pandora::PfoList *&);
+template pandora::StatusCode PandoraContentApi::GetList<pandora::VertexList>(const pandora::Algorithm &, const pandora::ListHandle, const pandora::VertexList *&);
+
 template pandora::StatusCode PandoraContentApi::SaveList<pandora::CaloHitList>(const pandora::Algorithm &, const pandora::CaloHitList &, const std::string &);
 template pandora::StatusCode PandoraContentApi::SaveList<pandora::TrackList>(const pandora::Algorithm &, const pandora::TrackList &, const std::string &);
 template pandora::StatusCode PandoraContentApi::SaveList<pandora::MCParticleList>(const pandora::Algorithm &, const pandora::MCParticleList &, const std::string &);
@@ -469,6 +569,10 @@ template pandora::StatusCode PandoraContentApi::TemporarilyReplaceCurrentList<pa
 template pandora::StatusCode PandoraContentApi::TemporarilyReplaceCurrentList<pandora::ParticleFlowObject>(const pandora::Algorithm &, const std::string &);
 template pandora::StatusCode PandoraContentApi::TemporarilyReplaceCurrentList<pandora::Vertex>(const pandora::Algorithm &, const std::string &);
 
+template pandora::StatusCode PandoraContentApi::TemporarilyReplaceCurrentList<pandora::Cluster>(const pandora::Algorithm &, const pandora::ListHandle);
+template pandora::StatusCode PandoraContentApi::TemporarilyReplaceCurrentList<pandora::ParticleFlowObject>(const pandora::Algorithm &, const pandora::ListHandle);
+template pandora::StatusCode PandoraContentApi::TemporarilyReplaceCurrentList<pandora::Vertex>(const pandora::Algorithm &, const pandora::ListHandle);
+
 template pandora::StatusCode PandoraContentApi::CreateTemporaryListAndSetCurrent<pandora::ClusterList>(const pandora::Algorithm &, const pandora::ClusterList *&, std::string &);
 template pandora::StatusCode PandoraContentApi::CreateTemporaryListAndSetCurrent<pandora::PfoList>(const pandora::Algorithm &, const pandora::PfoList *&, std::string &);
 template pandora::StatusCode PandoraContentApi::CreateTemporaryListAndSetCurrent<pandora::VertexList>(const pandora::Algorithm &, const pandora::VertexList *&, std::string &);
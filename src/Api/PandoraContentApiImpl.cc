@@ -25,6 +25,7 @@
 #include "Pandora/Algorithm.h"
 #include "Pandora/AlgorithmTool.h"
 #include "Pandora/Pandora.h"
+#include "Pandora/PandoraImpl.h"
 #include "Pandora/PandoraSettings.h"
 #include "Pandora/ObjectFactory.h"
 
@@ -139,6 +140,16 @@ StatusCode PandoraContentApiImpl::RepeatEventPreparation() const
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+StatusCode PandoraContentApiImpl::CompleteEventPreparation() const
+{
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, m_pPandora->m_pPandoraImpl->PrepareMCParticlesIfPending());
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, m_pPandora->m_pPandoraImpl->AssociateTracksIfPending());
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 StatusCode PandoraContentApiImpl::CreateAlgorithmTool(TiXmlElement *const pXmlElement, AlgorithmTool *&pAlgorithmTool) const
 {
     return m_pPandora->m_pAlgorithmManager->CreateAlgorithmTool(pXmlElement, pAlgorithmTool);
@@ -162,6 +173,15 @@ StatusCode PandoraContentApiImpl::RunAlgorithm(const std::string &algorithmName)
 
     PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->PreRunAlgorithm(iter->second));
 
+#if __cplusplus > 199711L
+    // Exceptions are counted for this pandora instance alone, including those thrown by tasks the thread pool runs for the algorithm
+    std::atomic<unsigned int> &nExceptionsThrown(m_pPandora->m_pAlgorithmManager->m_nExceptionsThrown);
+    std::atomic<unsigned int> *const pParentExceptionCounter(StatusCodeException::SetThreadExceptionCounter(&nExceptionsThrown));
+    const unsigned int nExceptionsBefore(nExceptionsThrown);
+#else
+    const unsigned int nExceptionsBefore(StatusCodeException::GetNExceptionsThrown());
+#endif
+
     try
     {
         const bool shouldDisplayAlgorithmInfo(m_pPandora->GetSettings()->ShouldDisplayAlgorithmInfo());
@@ -184,6 +204,17 @@ StatusCode PandoraContentApiImpl::RunAlgorithm(const std::string &algorithmName)
         std::cout << "Failure in algorithm " << iter->first << ", " << iter->second->GetType() << ", unrecognized exception" << std::endl;
     }
 
+#if __cplusplus > 199711L
+    const unsigned int nExceptions(nExceptionsThrown - nExceptionsBefore);
+    StatusCodeException::SetThreadExceptionCounter(pParentExceptionCounter);
+#else
+    // Without c++11, the process-wide count also includes exceptions thrown concurrently by any other pandora instances
+    const unsigned int nExceptions(StatusCodeException::GetNExceptionsThrown() - nExceptionsBefore);
+#endif
+
+    if (nExceptions > 0)
+        m_pPandora->m_pAlgorithmManager->m_exceptionCountMap[iter->first] += nExceptions;
+
     PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->PostRunAlgorithm(iter->second));
 
     return STATUS_CODE_SUCCESS;
@@ -204,6 +235,18 @@ StatusCode PandoraContentApiImpl::RunClusteringAlgorithm(const Algorithm &algori
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+StatusCode PandoraContentApiImpl::RunReadOnlyTasks(const unsigned int nIndices, const ThreadPool::Task &task) const
+{
+    // Flag is written before the pool threads are started and after they have all finished, so needs no further synchronisation
+    m_pPandora->m_isContentApiLocked = true;
+    const StatusCode statusCode(m_pPandora->m_pThreadPool->ParallelFor(nIndices, task));
+    m_pPandora->m_isContentApiLocked = false;
+
+    return statusCode;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 template <typename T>
 StatusCode PandoraContentApiImpl::GetCurrentList(const T *&pT, std::string &listName) const
 {
@@ -220,6 +263,22 @@ StatusCode PandoraContentApiImpl::GetCurrentListName(std::string &listName) cons
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+template <typename T>
+StatusCode PandoraContentApiImpl::GetCurrentListHandle(ListHandle &listHandle) const
+{
+    return this->GetManager<T>()->GetCurrentListHandle(listHandle);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename T>
+StatusCode PandoraContentApiImpl::GetListHandle(const std::string &listName, ListHandle &listHandle) const
+{
+    return this->GetManager<T>()->FindListHandle(listName, listHandle);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 template <typename T>
 StatusCode PandoraContentApiImpl::ReplaceCurrentList(const Algorithm &algorithm, const std::string &newListName) const
 {
@@ -228,6 +287,14 @@ StatusCode PandoraContentApiImpl::ReplaceCurrentList(const Algorithm &algorithm,
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+template <typename T>
+StatusCode PandoraContentApiImpl::ReplaceCurrentList(const Algorithm &algorithm, const ListHandle newListHandle) const
+{
+    return this->GetManager<T>()->ReplaceCurrentAndAlgorithmInputLists(&algorithm, newListHandle);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 template <typename T>
 StatusCode PandoraContentApiImpl::DropCurrentList(const Algorithm &algorithm) const
 {
@@ -244,6 +311,14 @@ StatusCode PandoraContentApiImpl::GetList(const std::string &listName, const T *
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+template <typename T>
+StatusCode PandoraContentApiImpl::GetList(const ListHandle listHandle, const T *&pT) const
+{
+    return this->GetManager<T>()->GetList(listHandle, pT);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 template <typename T>
 StatusCode PandoraContentApiImpl::SaveList(const T &t, const std::string &newListName) const
 {
@@ -296,6 +371,14 @@ StatusCode PandoraContentApiImpl::TemporarilyReplaceCurrentList(const std::strin
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+template <typename T>
+StatusCode PandoraContentApiImpl::TemporarilyReplaceCurrentList(const ListHandle newListHandle) const
+{
+    return this->GetManager<T>()->TemporarilyReplaceCurrentList(newListHandle);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 template <typename T>
 StatusCode PandoraContentApiImpl::CreateTemporaryListAndSetCurrent(const Algorithm &algorithm, const T *&pT, std::string &temporaryListName) const
 {
@@ -403,6 +486,14 @@ StatusCode PandoraContentApiImpl::Fragment(const CaloHit *const pOriginalCaloHit
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+StatusCode PandoraContentApiImpl::Fragment(const CaloHitVector &originalCaloHits, const FloatVector &fractions, CaloHitVector &daughterCaloHits,
+    const ObjectFactory<PandoraContentApi::CaloHitFragment::Parameters, CaloHit> &factory) const
+{
+    return m_pPandora->m_pCaloHitManager->FragmentCaloHits(originalCaloHits, fractions, daughterCaloHits, factory);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 StatusCode PandoraContentApiImpl::MergeFragments(const CaloHit *const pFragmentCaloHit1, const CaloHit *const pFragmentCaloHit2,
     const CaloHit *&pMergedCaloHit, const ObjectFactory<PandoraContentApi::CaloHitFragment::Parameters, CaloHit> &factory) const
 {
@@ -495,6 +586,15 @@ StatusCode PandoraContentApiImpl::MergeAndDeleteClusters(const Cluster *const pC
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+StatusCode PandoraContentApiImpl::PrepareClusterProperties(const ClusterList &clusterList, const unsigned int clusterProperties,
+    const bool useThreadPool) const
+{
+    const ClusterVector clusterVector(clusterList.begin(), clusterList.end());
+    return Cluster::PrepareProperties(*m_pPandora, clusterVector, clusterProperties, useThreadPool);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 template <typename T>
 StatusCode PandoraContentApiImpl::AddToPfo(const ParticleFlowObject *const pPfo, const T *const pT) const
 {
@@ -828,6 +928,20 @@ template StatusCode PandoraContentApiImpl::GetCurrentListName<Cluster>(std::stri
 template StatusCode PandoraContentApiImpl::GetCurrentListName<ParticleFlowObject>(std::string &) const;
 template StatusCode PandoraContentApiImpl::GetCurrentListName<Vertex>(std::string &) const;
 
+template StatusCode PandoraContentApiImpl::GetCurrentListHandle<CaloHit>(ListHandle &) const;
+template StatusCode PandoraContentApiImpl::GetCurrentListHandle<Track>(ListHandle &) const;
+template StatusCode PandoraContentApiImpl::GetCurrentListHandle<MCParticle>(ListHandle &) const;
+template StatusCode PandoraContentApiImpl::GetCurrentListHandle<Cluster>(ListHandle &) const;
+template StatusCode PandoraContentApiImpl::GetCurrentListHandle<ParticleFlowObject>(ListHandle &) const;
+template StatusCode PandoraContentApiImpl::GetCurrentListHandle<Vertex>(ListHandle &) const;
+
+template StatusCode PandoraContentApiImpl::GetListHandle<CaloHit>(const std::string &, ListHandle &) const;
+template StatusCode PandoraContentApiImpl::GetListHandle<Track>(const std::string &, ListHandle &) const;
+template StatusCode PandoraContentApiImpl::GetListHandle<MCParticle>(const std::string &, ListHandle &) const;
+template StatusCode PandoraContentApiImpl::GetListHandle<Cluster>(const std::string &, ListHandle &) const;
+template StatusCode PandoraContentApiImpl::GetListHandle<ParticleFlowObject>(const std::string &, ListHandle &) const;
+template StatusCode PandoraContentApiImpl::GetListHandle<Vertex>(const std::string &, ListHandle &) const;
+
 template StatusCode PandoraContentApiImpl::ReplaceCurrentList<CaloHit>(const Algorithm &, const std::string &) const;
 template StatusCode PandoraContentApiImpl::ReplaceCurrentList<Track>(const Algorithm &, const std::string &) const;
 template StatusCode PandoraContentApiImpl::ReplaceCurrentList<MCParticle>(const Algorithm &, const std::string &) const;
@@ -835,6 +949,13 @@ template StatusCode PandoraContentApiImpl::ReplaceCurrentList<Cluster>(const Alg
 template StatusCode PandoraContentApiImpl::ReplaceCurrentList<ParticleFlowObject>(const Algorithm &, const std::string &) const;
 template StatusCode PandoraContentApiImpl::ReplaceCurrentList<Vertex>(const Algorithm &, const std::string &) const;
 
+template StatusCode PandoraContentApiImpl::ReplaceCurrentList<CaloHit>(const Algorithm &, const ListHandle) const;
+template StatusCode PandoraContentApiImpl::ReplaceCurrentList<Track>(const Algorithm &, const ListHandle) const;
+template StatusCode PandoraContentApiImpl::ReplaceCurrentList<MCParticle>(const Algorithm &, const ListHandle) const;
+template StatusCode PandoraContentApiImpl::ReplaceCurrentList<Cluster>(const Algorithm &, const ListHandle) const;
+template StatusCode PandoraContentApiImpl::ReplaceCurrentList<ParticleFlowObject>(const Algorithm &, const ListHandle) const;
+template StatusCode PandoraContentApiImpl::ReplaceCurrentList<Vertex>(const Algorithm &, const ListHandle) const;
+
 template StatusCode PandoraContentApiImpl::DropCurrentList<CaloHit>(const Algorithm &) const;
 template StatusCode PandoraContentApiImpl::DropCurrentList<Track>(const Algorithm &) const;
 template StatusCode PandoraContentApiImpl::DropCurrentList<MCParticle>(const Algorithm &) const;
@@ -849,6 +970,13 @@ template StatusCode PandoraContentApiImpl::GetList<ClusterList>(const std::strin
 template StatusCode PandoraContentApiImpl::GetList<PfoList>(const std::string &, const PfoList *&) const;
 template StatusCode PandoraContentApiImpl::GetList<VertexList>(const std::string &, const VertexList *&) const;
 
+template StatusCode PandoraContentApiImpl::GetList<CaloHitList>(const ListHandle, const CaloHitList *&) const;
+template StatusCode PandoraContentApiImpl::GetList<TrackList>(const ListHandle, const TrackList *&) const;
+template StatusCode PandoraContentApiImpl::GetList<MCParticleList>(const ListHandle, const MCParticleList *&) const;
+template StatusCode PandoraContentApiImpl::GetList<ClusterList>(const ListHandle, const ClusterList *&) const;
+template StatusCode PandoraContentApiImpl::GetList<PfoList>(const ListHandle, const PfoList *&) const;
+template StatusCode PandoraContentApiImpl::GetList<VertexList>(const ListHandle, const VertexList *&) const;
+
 template StatusCode PandoraContentApiImpl::SaveList<CaloHitList>(const CaloHitList &, const std::string &) const;
 template StatusCode PandoraContentApiImpl::SaveList<TrackList>(const TrackList &, const std::string &) const;
 template StatusCode PandoraContentApiImpl::SaveList<MCParticleList>(const MCParticleList &, const std::string &) const;
@@ -873,6 +1001,10 @@ template StatusCode PandoraContentApiImpl::TemporarilyReplaceCurrentList<Cluster
 template StatusCode PandoraContentApiImpl::TemporarilyReplaceCurrentList<ParticleFlowObject>(const std::string &) const;
 template StatusCode PandoraContentApiImpl::TemporarilyReplaceCurrentList<Vertex>(const std::string &) const;
 
+template StatusCode PandoraContentApiImpl::TemporarilyReplaceCurrentList<Cluster>(const ListHandle) const;
+template StatusCode PandoraContentApiImpl::TemporarilyReplaceCurrentList<ParticleFlowObject>(const ListHandle) const;
+template StatusCode PandoraContentApiImpl::TemporarilyReplaceCurrentList<Vertex>(const ListHandle) const;
+
 template StatusCode PandoraContentApiImpl::CreateTemporaryListAndSetCurrent<ClusterList>(const Algorithm &, const ClusterList *&, std::string &) const;
 template StatusCode PandoraContentApiImpl::CreateTemporaryListAndSetCurrent<PfoList>(const Algorithm &, const PfoList *&, std::string &) const;
 template StatusCode PandoraContentApiImpl::CreateTemporaryListAndSetCurrent<VertexList>(const Algorithm &, const VertexList *&, std::string &) const;
@@ -8,9 +8,11 @@
 
 #include "Helpers/MCParticleHelper.h"
 
+#include "Objects/CaloHit.h"
 #include "Objects/Cluster.h"
 #include "Objects/MCParticle.h"
-#include "Objects/OrderedCaloHitList.h"
+#include "Objects/ParticleFlowObject.h"
+#include "Objects/Track.h"
 
 namespace pandora
 {
@@ -18,21 +20,26 @@ namespace pandora
 template <>
 const MCParticle *MCParticleHelper::GetMainMCParticle(const CaloHit *const pCaloHit)
 {
-    float bestWeight(0.f);
-    const MCParticle *pBestMCParticle = NULL;
-    const MCParticleWeightMap &hitMCParticleWeightMap(pCaloHit->GetMCParticleWeightMap());
+    return pCaloHit->GetMainMCParticle();
+}
 
-    for (MCParticleWeightMap::const_iterator iter = hitMCParticleWeightMap.begin(), iterEnd = hitMCParticleWeightMap.end(); iter != iterEnd; ++iter)
-    {
-        if (iter->second > bestWeight)
-        {
-            bestWeight = iter->second;
-            pBestMCParticle = iter->first;
-        }
-    }
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <>
+const MCParticle *MCParticleHelper::GetMainMCParticle(const Track *const pTrack)
+{
+    return pTrack->GetMainMCParticle();
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <>
+const MCParticle *MCParticleHelper::GetMainMCParticle(const Cluster *const pCluster)
+{
+    const MCParticle *const pBestMCParticle(MCParticleHelper::GetMainMCParticle(pCluster->GetMCParticleWeightMap()));
 
     if (NULL == pBestMCParticle)
-        throw StatusCodeException(STATUS_CODE_NOT_INITIALIZED);
+        throw StatusCodeException(STATUS_CODE_NOT_FOUND);
 
     return pBestMCParticle;
 }
@@ -40,45 +47,63 @@ const MCParticle *MCParticleHelper::GetMainMCParticle(const CaloHit *const pCalo
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 template <>
-const MCParticle *MCParticleHelper::GetMainMCParticle(const Cluster *const pCluster)
+const MCParticle *MCParticleHelper::GetMainMCParticle(const ParticleFlowObject *const pPfo)
 {
+    // Use the summed cluster mc particle weights, falling back to the track mc particle weights for pfos without clusters
     MCParticleWeightMap mcParticleWeightMap;
-    const OrderedCaloHitList &orderedCaloHitList(pCluster->GetOrderedCaloHitList());
+    const ClusterList &clusterList(pPfo->GetClusterList());
+
+    for (ClusterList::const_iterator iter = clusterList.begin(), iterEnd = clusterList.end(); iter != iterEnd; ++iter)
+    {
+        const MCParticleWeightMap &clusterMCParticleWeightMap((*iter)->GetMCParticleWeightMap());
+
+        for (MCParticleWeightMap::const_iterator weightIter = clusterMCParticleWeightMap.begin(), weightIterEnd = clusterMCParticleWeightMap.end();
+            weightIter != weightIterEnd; ++weightIter)
+        {
+            mcParticleWeightMap[weightIter->first] += weightIter->second;
+        }
+    }
 
-    for (OrderedCaloHitList::const_iterator iter = orderedCaloHitList.begin(), iterEnd = orderedCaloHitList.end(); iter != iterEnd; ++iter)
+    if (clusterList.empty())
     {
-        for (CaloHitList::const_iterator hitIter = iter->second->begin(), hitIterEnd = iter->second->end(); hitIter != hitIterEnd; ++hitIter)
+        const TrackList &trackList(pPfo->GetTrackList());
+
+        for (TrackList::const_iterator iter = trackList.begin(), iterEnd = trackList.end(); iter != iterEnd; ++iter)
         {
-            const CaloHit *const pCaloHit = *hitIter;
-            const MCParticleWeightMap &hitMCParticleWeightMap(pCaloHit->GetMCParticleWeightMap());
+            const MCParticleWeightMap &trackMCParticleWeightMap((*iter)->GetMCParticleWeightMap());
 
-            for (MCParticleWeightMap::const_iterator weightIter = hitMCParticleWeightMap.begin(), weightIterEnd = hitMCParticleWeightMap.end();
+            for (MCParticleWeightMap::const_iterator weightIter = trackMCParticleWeightMap.begin(), weightIterEnd = trackMCParticleWeightMap.end();
                 weightIter != weightIterEnd; ++weightIter)
             {
-                const float weight(weightIter->second);
-                mcParticleWeightMap[weightIter->first] += weight;
+                mcParticleWeightMap[weightIter->first] += weightIter->second;
             }
         }
     }
 
+    const MCParticle *const pBestMCParticle(MCParticleHelper::GetMainMCParticle(mcParticleWeightMap));
+
+    if (NULL == pBestMCParticle)
+        throw StatusCodeException(STATUS_CODE_NOT_FOUND);
+
+    return pBestMCParticle;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+const MCParticle *MCParticleHelper::GetMainMCParticle(const MCParticleWeightMap &mcParticleWeightMap)
+{
     float bestWeight(0.f);
     const MCParticle *pBestMCParticle(NULL);
 
     for (MCParticleWeightMap::const_iterator iter = mcParticleWeightMap.begin(), iterEnd = mcParticleWeightMap.end(); iter != iterEnd; ++iter)
     {
-        const MCParticle *const pCurrentMCParticle = iter->first;
-        const float currentWeight = iter->second;
-
-        if (currentWeight > bestWeight)
+        if (iter->second > bestWeight)
         {
-            pBestMCParticle = pCurrentMCParticle;
-            bestWeight = currentWeight;
+            bestWeight = iter->second;
+            pBestMCParticle = iter->first;
         }
     }
 
-    if (NULL == pBestMCParticle)
-        throw StatusCodeException(STATUS_CODE_NOT_FOUND);
-
     return pBestMCParticle;
 }
 
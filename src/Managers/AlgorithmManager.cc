@@ -20,6 +20,9 @@ namespace pandora
 {
 
 AlgorithmManager::AlgorithmManager(const Pandora *const pPandora) :
+#if __cplusplus > 199711L
+    m_nExceptionsThrown(0),
+#endif
     m_pPandora(pPandora)
 {
     PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, RegisterAlgorithmFactory("EventReading", new EventReadingAlgorithm::Factory));
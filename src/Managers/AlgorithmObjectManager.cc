@@ -58,11 +58,10 @@ StatusCode AlgorithmObjectManager<T>::MoveObjectsToTemporaryListAndSetCurrent(co
 template<typename T>
 StatusCode AlgorithmObjectManager<T>::SaveObjects(const std::string &targetListName, const std::string &sourceListName)
 {
-    typename Manager<T>::NameToListMap::iterator targetObjectListIter = Manager<T>::m_nameToListMap.find(targetListName);
-
-    if (Manager<T>::m_nameToListMap.end() == targetObjectListIter)
+    if (Manager<T>::m_nameToListMap.end() == Manager<T>::m_nameToListMap.find(targetListName))
     {
-        Manager<T>::m_nameToListMap[targetListName] = new ObjectList;
+        ObjectList *pObjectList(NULL);
+        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, Manager<T>::CreateList(targetListName, pObjectList));
         Manager<T>::m_savedLists.insert(targetListName);
     }
 
@@ -77,11 +76,10 @@ StatusCode AlgorithmObjectManager<T>::SaveObjects(const std::string &targetListN
     if (objectsToSave.empty())
         return STATUS_CODE_NOT_INITIALIZED;
 
-    typename Manager<T>::NameToListMap::iterator targetObjectListIter = Manager<T>::m_nameToListMap.find(targetListName);
-
-    if (Manager<T>::m_nameToListMap.end() == targetObjectListIter)
+    if (Manager<T>::m_nameToListMap.end() == Manager<T>::m_nameToListMap.find(targetListName))
     {
-        Manager<T>::m_nameToListMap[targetListName] = new ObjectList;
+        ObjectList *pObjectList(NULL);
+        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, Manager<T>::CreateList(targetListName, pObjectList));
         Manager<T>::m_savedLists.insert(targetListName);
     }
 
@@ -110,7 +108,12 @@ StatusCode AlgorithmObjectManager<T>::MoveObjectsBetweenLists(const std::string
     if (Manager<T>::m_nameToListMap.end() == targetListIter)
         return STATUS_CODE_FAILURE;
 
-    if (NULL == pObjectSubset)
+    if ((NULL == pObjectSubset) && targetListIter->second->empty())
+    {
+        // Hand the entire contents of the source list to the empty target list, without moving the objects one by one
+        targetListIter->second->swap(*(sourceListIter->second));
+    }
+    else if (NULL == pObjectSubset)
     {
         for (typename ObjectList::iterator iter = sourceListIter->second->begin(), iterEnd = sourceListIter->second->end();
             iter != iterEnd; ++iter)
@@ -153,12 +156,25 @@ StatusCode AlgorithmObjectManager<T>::TemporarilyReplaceCurrentList(const std::s
         return STATUS_CODE_NOT_FOUND;
 
     m_canMakeNewObjects = false;
-    Manager<T>::m_currentListName = listName;
+    Manager<T>::SetCurrentListName(listName);
     return STATUS_CODE_SUCCESS;
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+template<typename T>
+StatusCode AlgorithmObjectManager<T>::TemporarilyReplaceCurrentList(const ListHandle listHandle)
+{
+    std::string listName;
+
+    if (STATUS_CODE_SUCCESS != Manager<T>::GetListName(listHandle, listName))
+        return STATUS_CODE_NOT_FOUND;
+
+    return this->TemporarilyReplaceCurrentList(listName);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 template<typename T>
 StatusCode AlgorithmObjectManager<T>::DeleteObject(const T *const pT, const std::string &listName)
 {
@@ -174,6 +190,7 @@ StatusCode AlgorithmObjectManager<T>::DeleteObject(const T *const pT, const std:
 
     delete pT;
     listIter->second->erase(deletionIter);
+    this->RecordObjectDeletions(1);
 
     return STATUS_CODE_SUCCESS;
 }
@@ -200,6 +217,7 @@ StatusCode AlgorithmObjectManager<T>::DeleteObjects(const ObjectList &objectList
 
         delete *objectIter;
         listIter->second->erase(deletionIter);
+        this->RecordObjectDeletions(1);
     }
 
     return STATUS_CODE_SUCCESS;
@@ -229,6 +247,7 @@ StatusCode AlgorithmObjectManager<T>::DeleteTemporaryObjects(const Algorithm *co
     for (typename ObjectList::iterator iter = listIter->second->begin(), iterEnd = listIter->second->end(); iter != iterEnd; ++iter)
         delete *iter;
 
+    this->RecordObjectDeletions(listIter->second->size());
     listIter->second->clear();
     return STATUS_CODE_SUCCESS;
 }
@@ -295,6 +314,7 @@ StatusCode AlgorithmObjectManager<T>::ResetAlgorithmInfo(const Algorithm *const
     for (typename ObjectList::const_iterator iter = objectList.begin(), iterEnd = objectList.end(); iter != iterEnd; ++iter)
         delete *iter;
 
+    this->RecordObjectDeletions(objectList.size());
     m_canMakeNewObjects = false;
     return Manager<T>::ResetAlgorithmInfo(pAlgorithm, isAlgorithmFinished);
 }
@@ -14,18 +14,83 @@
 
 #include "Pandora/Pandora.h"
 #include "Pandora/ObjectFactory.h"
+#include "Pandora/ThreadPool.h"
 
 #include "Plugins/PseudoLayerPlugin.h"
 
+#include <algorithm>
 #include <cmath>
 
 namespace pandora
 {
 
+const float CaloHitManager::FRAGMENT_FRACTION_TOLERANCE = 1.e-4f;
+const unsigned int CaloHitManager::N_HITS_PER_MATCHING_TASK = 5000;
+const std::string CaloHitManager::NEW_INPUT_LIST_NAME = "NewInput";
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+/**
+ *  @brief  MCPfoTargetMatchingTask class, matching the calo hits in one of a number of equal chunks of a calo hit vector to their mc pfo targets
+ */
+class CaloHitManager::MCPfoTargetMatchingTask : public ThreadPool::Task
+{
+public:
+    /**
+     *  @brief  Constructor
+     * 
+     *  @param  caloHitManager the calo hit manager
+     *  @param  caloHitToPfoTargetsMap the calo hit uid to mc pfo target map
+     *  @param  caloHitVector the vector of calo hits
+     *  @param  nChunks the number of chunks into which to divide the calo hit vector
+     */
+    MCPfoTargetMatchingTask(const CaloHitManager &caloHitManager, const UidToMCParticleWeightMap &caloHitToPfoTargetsMap,
+        const CaloHitVector &caloHitVector, const unsigned int nChunks);
+
+    StatusCode Run(const unsigned int index) const;
+
+private:
+    const CaloHitManager               &m_caloHitManager;           ///< The calo hit manager
+    const UidToMCParticleWeightMap     &m_caloHitToPfoTargetsMap;   ///< The calo hit uid to mc pfo target map
+    const CaloHitVector                &m_caloHitVector;            ///< The vector of calo hits
+    const unsigned int                  m_nChunks;                  ///< The number of chunks into which to divide the calo hit vector
+};
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+CaloHitManager::MCPfoTargetMatchingTask::MCPfoTargetMatchingTask(const CaloHitManager &caloHitManager,
+        const UidToMCParticleWeightMap &caloHitToPfoTargetsMap, const CaloHitVector &caloHitVector, const unsigned int nChunks) :
+    m_caloHitManager(caloHitManager),
+    m_caloHitToPfoTargetsMap(caloHitToPfoTargetsMap),
+    m_caloHitVector(caloHitVector),
+    m_nChunks(nChunks)
+{
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode CaloHitManager::MCPfoTargetMatchingTask::Run(const unsigned int index) const
+{
+    const unsigned int nCaloHits(m_caloHitVector.size());
+    const unsigned int beginIndex((nCaloHits * index) / m_nChunks), endIndex((nCaloHits * (index + 1)) / m_nChunks);
+
+    m_caloHitManager.MatchCaloHitRangeToMCPfoTargets(m_caloHitToPfoTargetsMap, m_caloHitVector, beginIndex, endIndex);
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 CaloHitManager::CaloHitManager(const Pandora *const pPandora) :
     InputObjectManager<CaloHit>(pPandora),
+    m_nCaloHitIndices(0),
     m_nReclusteringProcesses(0),
-    m_pCurrentReclusterMetadata(NULL)
+    m_maxNReclusteringProcesses(0),
+    m_nFragmentedCaloHits(0),
+    m_nMergedCaloHitFragments(0),
+    m_pCurrentReclusterMetadata(NULL),
+    m_isSlidingWindowActive(false)
 {
     PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->CreateInitialLists());
 }
@@ -53,12 +118,27 @@ StatusCode CaloHitManager::Create(const PandoraApi::CaloHit::Parameters &paramet
 
         const unsigned int pseudoLayer(m_pPandora->GetPlugins()->GetPseudoLayerPlugin()->GetPseudoLayer(pCaloHit->GetPositionVector()));
         PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->Modifiable(pCaloHit)->SetPseudoLayer(pseudoLayer));
+        this->AssignCaloHitIndex(pCaloHit);
 
-        NameToListMap::iterator inputIter = m_nameToListMap.find(INPUT_LIST_NAME);
+        CaloHitList *pInputList(NULL);
 
-        if ((m_nameToListMap.end() == inputIter) || !inputIter->second->insert(pCaloHit).second)
+        if ((STATUS_CODE_SUCCESS != this->GetModifiableList(INPUT_LIST_NAME, pInputList)) || !pInputList->insert(pCaloHit).second)
             throw StatusCodeException(STATUS_CODE_FAILURE);
 
+        this->RecordListMembership(pCaloHit, this->InternListHandle(INPUT_LIST_NAME));
+
+        if (m_isSlidingWindowActive)
+        {
+            CaloHitList *pNewInputList(NULL);
+
+            if ((STATUS_CODE_SUCCESS != this->GetModifiableList(NEW_INPUT_LIST_NAME, pNewInputList)) || !pNewInputList->insert(pCaloHit).second)
+                throw StatusCodeException(STATUS_CODE_FAILURE);
+
+            this->RecordListMembership(pCaloHit, this->InternListHandle(NEW_INPUT_LIST_NAME));
+        }
+
+        this->RecordObjectCreation();
+
         return STATUS_CODE_SUCCESS;
     }
     catch (StatusCodeException &statusCodeException)
@@ -140,16 +220,75 @@ StatusCode CaloHitManager::CreateTemporaryListAndSetCurrent(const Algorithm *con
     if (clusterList.empty())
         return STATUS_CODE_NOT_INITIALIZED;
 
-    CaloHitList caloHitList;
+    // Collect the hits directly into the new temporary list, sized in advance, rather than copying from an intermediate list
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, Manager<CaloHit>::CreateTemporaryListAndSetCurrent(pAlgorithm, temporaryListName));
+
+    CaloHitList *pCaloHitList(NULL);
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->GetModifiableList(temporaryListName, pCaloHitList));
+
+#if __cplusplus > 199711L
+    unsigned int nCaloHits(0);
+
+    for (ClusterList::const_iterator iter = clusterList.begin(), iterEnd = clusterList.end(); iter != iterEnd; ++iter)
+        nCaloHits += (*iter)->GetNCaloHits() + (*iter)->GetNIsolatedCaloHits();
+
+    pCaloHitList->reserve(nCaloHits);
+#endif
 
     for (ClusterList::const_iterator iter = clusterList.begin(), iterEnd = clusterList.end(); iter != iterEnd; ++iter)
     {
         const Cluster *const pCluster = *iter;
-        pCluster->GetOrderedCaloHitList().GetCaloHitList(caloHitList);
-        caloHitList.insert(pCluster->GetIsolatedCaloHitList().begin(), pCluster->GetIsolatedCaloHitList().end());
+        pCluster->GetOrderedCaloHitList().GetCaloHitList(*pCaloHitList);
+        pCaloHitList->insert(pCluster->GetIsolatedCaloHitList().begin(), pCluster->GetIsolatedCaloHitList().end());
+    }
+
+    this->RecordListMembership(*pCaloHitList, temporaryListName);
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode CaloHitManager::CreateTemporaryListAndSetCurrent(const Algorithm *const pAlgorithm, const CaloHitList &caloHitList,
+    std::string &temporaryListName)
+{
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, InputObjectManager<CaloHit>::CreateTemporaryListAndSetCurrent(pAlgorithm, caloHitList,
+        temporaryListName));
+    this->UnshareListIfReclustering(temporaryListName);
+
+    if (!this->RecordSharedListMembership(caloHitList, temporaryListName))
+        this->RecordListMembership(caloHitList, temporaryListName);
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode CaloHitManager::SaveList(const std::string &listName, const CaloHitList &caloHitList)
+{
+    const StatusCode statusCode(InputObjectManager<CaloHit>::SaveList(listName, caloHitList));
+
+    if (m_nameToListMap.end() != m_nameToListMap.find(listName))
+    {
+        this->UnshareListIfReclustering(listName);
+
+        if (!this->RecordSharedListMembership(caloHitList, listName))
+            this->RecordListMembership(caloHitList, listName);
     }
 
-    return InputObjectManager<CaloHit>::CreateTemporaryListAndSetCurrent(pAlgorithm, caloHitList, temporaryListName);
+    return statusCode;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode CaloHitManager::AddObjectsToList(const std::string &listName, const CaloHitList &caloHitList)
+{
+    const StatusCode statusCode(InputObjectManager<CaloHit>::AddObjectsToList(listName, caloHitList));
+
+    if (m_nameToListMap.end() != m_nameToListMap.find(listName))
+        this->RecordListMembership(caloHitList, listName);
+
+    return statusCode;
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -159,7 +298,13 @@ StatusCode CaloHitManager::EraseAllContent()
     for (ReclusterMetadataList::iterator iter = m_reclusterMetadataList.begin(), iterEnd = m_reclusterMetadataList.end(); iter != iterEnd; ++iter)
         delete *iter;
 
+    m_nCaloHitIndices = 0;
+    m_caloHitListHandles.clear();
+    m_sharingListHandles.clear();
     m_nReclusteringProcesses = 0;
+    m_maxNReclusteringProcesses = 0;
+    m_nFragmentedCaloHits = 0;
+    m_nMergedCaloHitFragments = 0;
     m_pCurrentReclusterMetadata = NULL;
     m_reclusterMetadataList.clear();
 
@@ -168,6 +313,70 @@ StatusCode CaloHitManager::EraseAllContent()
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+StatusCode CaloHitManager::ResetForNextEvent()
+{
+    m_isSlidingWindowActive = false;
+    return InputObjectManager<CaloHit>::ResetForNextEvent();
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode CaloHitManager::ResetForNextWindow(const float windowStartTime)
+{
+    CaloHitList *pInputList(NULL);
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->GetModifiableList(INPUT_LIST_NAME, pInputList));
+
+    // Calo hits within the window are removed from the input list, so that they survive the reset, then restored to the new input list
+    CaloHitList retainedCaloHitList;
+
+    for (CaloHitList::iterator iter = pInputList->begin(); iter != pInputList->end();)
+    {
+        if ((*iter)->GetTime() < windowStartTime)
+        {
+            ++iter;
+            continue;
+        }
+
+        retainedCaloHitList.insert(*iter);
+        pInputList->erase(iter++);
+    }
+
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, InputObjectManager<CaloHit>::ResetForNextEvent());
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->GetModifiableList(INPUT_LIST_NAME, pInputList));
+    const ListHandle inputListHandle(this->InternListHandle(INPUT_LIST_NAME));
+
+    for (CaloHitList::const_iterator iter = retainedCaloHitList.begin(), iterEnd = retainedCaloHitList.end(); iter != iterEnd; ++iter)
+    {
+        CaloHit *const pCaloHit(this->Modifiable(*iter));
+        pCaloHit->RemoveMCParticles();
+        pCaloHit->SetAvailability(true);
+        this->AssignCaloHitIndex(pCaloHit);
+
+        if (!pInputList->insert(pCaloHit).second)
+            return STATUS_CODE_FAILURE;
+
+        this->RecordListMembership(pCaloHit, inputListHandle);
+        this->RecordObjectCreation();
+    }
+
+    CaloHitList *pNewInputList(NULL);
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->CreateList(NEW_INPUT_LIST_NAME, pNewInputList));
+    m_savedLists.insert(NEW_INPUT_LIST_NAME);
+    m_isSlidingWindowActive = true;
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void CaloHitManager::ReserveEventCapacity(const unsigned int nObjects)
+{
+    InputObjectManager<CaloHit>::ReserveEventCapacity(nObjects);
+    m_caloHitListHandles.reserve(nObjects);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 StatusCode CaloHitManager::MatchCaloHitsToMCPfoTargets(const UidToMCParticleWeightMap &caloHitToPfoTargetsMap)
 {
     if (caloHitToPfoTargetsMap.empty())
@@ -178,17 +387,32 @@ StatusCode CaloHitManager::MatchCaloHitsToMCPfoTargets(const UidToMCParticleWeig
     if (m_nameToListMap.end() == inputIter)
         return STATUS_CODE_FAILURE;
 
-    for (CaloHitList::iterator iter = inputIter->second->begin(), iterEnd = inputIter->second->end(); iter != iterEnd; ++iter)
+    // ATTN: Each calo hit is modified by exactly one task and the target map is only read, so large events can be split over the thread pool
+    const CaloHitVector caloHitVector(inputIter->second->begin(), inputIter->second->end());
+    const unsigned int nCaloHits(caloHitVector.size());
+
+    const ThreadPool *const pThreadPool(m_pPandora->GetThreadPool());
+    const unsigned int nChunks(std::max(1U, std::min(pThreadPool->GetNThreads(), nCaloHits / N_HITS_PER_MATCHING_TASK)));
+
+    const MCPfoTargetMatchingTask task(*this, caloHitToPfoTargetsMap, caloHitVector, nChunks);
+    return pThreadPool->ParallelFor(nChunks, task);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void CaloHitManager::MatchCaloHitRangeToMCPfoTargets(const UidToMCParticleWeightMap &caloHitToPfoTargetsMap, const CaloHitVector &caloHitVector,
+    const unsigned int beginIndex, const unsigned int endIndex) const
+{
+    for (unsigned int index = beginIndex; index < endIndex; ++index)
     {
-        UidToMCParticleWeightMap::const_iterator pfoTargetIter = caloHitToPfoTargetsMap.find((*iter)->GetParentCaloHitAddress());
+        const CaloHit *const pCaloHit(caloHitVector[index]);
+        UidToMCParticleWeightMap::const_iterator pfoTargetIter = caloHitToPfoTargetsMap.find(pCaloHit->GetParentCaloHitAddress());
 
         if (caloHitToPfoTargetsMap.end() == pfoTargetIter)
             continue;
 
-        this->Modifiable(*iter)->SetMCParticleWeightMap(pfoTargetIter->second);
+        this->Modifiable(pCaloHit)->SetMCParticleWeightMap(pfoTargetIter->second);
     }
-
-    return STATUS_CODE_SUCCESS;
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -229,20 +453,17 @@ StatusCode CaloHitManager::FragmentCaloHit(const CaloHit *const pOriginalCaloHit
     if ((NULL == pDaughterCaloHit1) || (NULL == pDaughterCaloHit2))
         return STATUS_CODE_FAILURE;
 
+    this->AssignCaloHitIndex(pDaughterCaloHit1);
+    this->AssignCaloHitIndex(pDaughterCaloHit2);
+    this->RecordObjectCreation();
+    this->RecordObjectCreation();
+    ++m_nFragmentedCaloHits;
+
     CaloHitReplacement caloHitReplacement;
     caloHitReplacement.m_oldCaloHits.insert(pOriginalCaloHit);
     caloHitReplacement.m_newCaloHits.insert(pDaughterCaloHit1); caloHitReplacement.m_newCaloHits.insert(pDaughterCaloHit2);
 
-    if (m_nReclusteringProcesses > 0)
-    {
-        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, m_pCurrentReclusterMetadata->GetCurrentCaloHitMetadata()->Update(caloHitReplacement));
-    }
-    else
-    {
-        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->Update(caloHitReplacement));
-    }
-
-    return STATUS_CODE_SUCCESS;
+    return this->ApplyReplacement(caloHitReplacement);
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -265,17 +486,78 @@ StatusCode CaloHitManager::MergeCaloHitFragments(const CaloHit *const pFragmentC
     if (NULL == pMergedCaloHit)
         return STATUS_CODE_FAILURE;
 
+    this->AssignCaloHitIndex(pMergedCaloHit);
+    this->RecordObjectCreation();
+    ++m_nMergedCaloHitFragments;
+
     CaloHitReplacement caloHitReplacement;
     caloHitReplacement.m_newCaloHits.insert(pMergedCaloHit);
     caloHitReplacement.m_oldCaloHits.insert(pFragmentCaloHit1); caloHitReplacement.m_oldCaloHits.insert(pFragmentCaloHit2);
 
-    if (m_nReclusteringProcesses > 0)
+    return this->ApplyReplacement(caloHitReplacement);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode CaloHitManager::FragmentCaloHits(const CaloHitVector &originalCaloHits, const FloatVector &fractions, CaloHitVector &daughterCaloHits,
+    const ObjectFactory<PandoraContentApi::CaloHitFragment::Parameters, CaloHit> &factory)
+{
+    daughterCaloHits.clear();
+
+    if (originalCaloHits.empty() || (fractions.size() < 2))
+        return STATUS_CODE_INVALID_PARAMETER;
+
+    // All original calo hits and fractions are validated before any fragments are created or any replacements applied
+    CaloHitList uniqueCaloHits;
+
+    for (CaloHitVector::const_iterator iter = originalCaloHits.begin(), iterEnd = originalCaloHits.end(); iter != iterEnd; ++iter)
     {
-        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, m_pCurrentReclusterMetadata->GetCurrentCaloHitMetadata()->Update(caloHitReplacement));
+        if (!uniqueCaloHits.insert(*iter).second || !this->CanFragmentCaloHit(*iter, fractions))
+            return STATUS_CODE_NOT_ALLOWED;
     }
-    else
+
+    daughterCaloHits.reserve(originalCaloHits.size() * fractions.size());
+
+    for (CaloHitVector::const_iterator iter = originalCaloHits.begin(), iterEnd = originalCaloHits.end(); iter != iterEnd; ++iter)
+    {
+        for (FloatVector::const_iterator fIter = fractions.begin(), fIterEnd = fractions.end(); fIter != fIterEnd; ++fIter)
+        {
+            PandoraContentApi::CaloHitFragment::Parameters parameters;
+            parameters.m_pOriginalCaloHit = *iter;
+            parameters.m_weight = *fIter;
+
+            const CaloHit *pDaughterCaloHit = NULL;
+            const StatusCode statusCode(factory.Create(parameters, pDaughterCaloHit));
+
+            if ((STATUS_CODE_SUCCESS != statusCode) || (NULL == pDaughterCaloHit))
+            {
+                for (CaloHitVector::const_iterator dIter = daughterCaloHits.begin(), dIterEnd = daughterCaloHits.end(); dIter != dIterEnd; ++dIter)
+                    delete *dIter;
+
+                this->RecordObjectDeletions(daughterCaloHits.size());
+                daughterCaloHits.clear();
+                return ((STATUS_CODE_SUCCESS != statusCode) ? statusCode : STATUS_CODE_FAILURE);
+            }
+
+            this->AssignCaloHitIndex(pDaughterCaloHit);
+            this->RecordObjectCreation();
+            daughterCaloHits.push_back(pDaughterCaloHit);
+        }
+    }
+
+    m_nFragmentedCaloHits += originalCaloHits.size();
+
+    CaloHitVector::const_iterator daughterIter = daughterCaloHits.begin();
+
+    for (CaloHitVector::const_iterator iter = originalCaloHits.begin(), iterEnd = originalCaloHits.end(); iter != iterEnd; ++iter)
     {
-        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->Update(caloHitReplacement));
+        CaloHitReplacement caloHitReplacement;
+        caloHitReplacement.m_oldCaloHits.insert(*iter);
+
+        for (unsigned int iFragment = 0; iFragment < fractions.size(); ++iFragment)
+            caloHitReplacement.m_newCaloHits.insert(*(daughterIter++));
+
+        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->ApplyReplacement(caloHitReplacement));
     }
 
     return STATUS_CODE_SUCCESS;
@@ -285,18 +567,39 @@ StatusCode CaloHitManager::MergeCaloHitFragments(const CaloHit *const pFragmentC
 
 bool CaloHitManager::CanFragmentCaloHit(const CaloHit *const pOriginalCaloHit, const float fraction1) const
 {
-    if ((fraction1 < std::numeric_limits<float>::epsilon()) || (fraction1 > 1.f))
+    FloatVector fractions;
+    fractions.push_back(fraction1);
+    fractions.push_back(1.f - fraction1);
+
+    return this->CanFragmentCaloHit(pOriginalCaloHit, fractions);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+bool CaloHitManager::CanFragmentCaloHit(const CaloHit *const pOriginalCaloHit, const FloatVector &fractions) const
+{
+    float fractionSum(0.f);
+
+    for (FloatVector::const_iterator iter = fractions.begin(), iterEnd = fractions.end(); iter != iterEnd; ++iter)
+    {
+        if ((*iter < std::numeric_limits<float>::epsilon()) || (*iter > 1.f))
+            return false;
+
+        fractionSum += *iter;
+    }
+
+    if (std::fabs(fractionSum - 1.f) > FRAGMENT_FRACTION_TOLERANCE)
         return false;
 
     if (!this->IsAvailable(pOriginalCaloHit))
         return false;
 
-    NameToListMap::const_iterator iter = m_nameToListMap.find(m_currentListName);
+    const CaloHitList *const pCurrentList(m_handleToListVector[m_currentListHandle]);
 
-    if (m_nameToListMap.end() == iter)
+    if (NULL == pCurrentList)
         throw StatusCodeException(STATUS_CODE_FAILURE);
 
-    if (iter->second->end() == iter->second->find(pOriginalCaloHit))
+    if (pCurrentList->end() == pCurrentList->find(pOriginalCaloHit))
         return false;
 
     return true;
@@ -315,12 +618,12 @@ bool CaloHitManager::CanMergeCaloHitFragments(const CaloHit *const pFragmentCalo
     if (!this->IsAvailable(pFragmentCaloHit1) || !this->IsAvailable(pFragmentCaloHit2))
         return false;
 
-    NameToListMap::const_iterator iter = m_nameToListMap.find(m_currentListName);
+    const CaloHitList *const pCurrentList(m_handleToListVector[m_currentListHandle]);
 
-    if (m_nameToListMap.end() == iter)
+    if (NULL == pCurrentList)
         throw StatusCodeException(STATUS_CODE_FAILURE);
 
-    if ((iter->second->end() == iter->second->find(pFragmentCaloHit1)) || (iter->second->end() == iter->second->find(pFragmentCaloHit2)))
+    if ((pCurrentList->end() == pCurrentList->find(pFragmentCaloHit1)) || (pCurrentList->end() == pCurrentList->find(pFragmentCaloHit2)))
         return false;
 
     return true;
@@ -333,7 +636,9 @@ StatusCode CaloHitManager::InitializeReclustering(const Algorithm *const pAlgori
 {
     std::string caloHitListName;
     PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->CreateTemporaryListAndSetCurrent(pAlgorithm, clusterList, caloHitListName));
-    CaloHitList *const pCaloHitList = m_nameToListMap[caloHitListName];
+
+    CaloHitList *pCaloHitList(NULL);
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->GetModifiableList(caloHitListName, pCaloHitList));
 
     m_pCurrentReclusterMetadata = new ReclusterMetadata(pCaloHitList);
     m_reclusterMetadataList.push_back(m_pCurrentReclusterMetadata);
@@ -342,6 +647,7 @@ StatusCode CaloHitManager::InitializeReclustering(const Algorithm *const pAlgori
         originalReclusterListName, false));
 
     ++m_nReclusteringProcesses;
+    m_maxNReclusteringProcesses = std::max(m_maxNReclusteringProcesses, m_nReclusteringProcesses);
 
     return STATUS_CODE_SUCCESS;
 }
@@ -356,9 +662,10 @@ StatusCode CaloHitManager::PrepareForClustering(const Algorithm *const pAlgorith
     const CaloHitList &caloHitList(m_pCurrentReclusterMetadata->GetCaloHitList());
 
     std::string caloHitListName;
-    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, InputObjectManager<CaloHit>::CreateTemporaryListAndSetCurrent(pAlgorithm, caloHitList,
-        caloHitListName));
-    CaloHitList *const pCaloHitList = m_nameToListMap[caloHitListName];
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->CreateTemporaryListAndSetCurrent(pAlgorithm, caloHitList, caloHitListName));
+
+    CaloHitList *pCaloHitList(NULL);
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->GetModifiableList(caloHitListName, pCaloHitList));
 
     PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, m_pCurrentReclusterMetadata->CreateCaloHitMetadata(pCaloHitList, caloHitListName,
         newReclusterListName, true));
@@ -377,43 +684,52 @@ StatusCode CaloHitManager::EndReclustering(const Algorithm *const /*const pAlgor
     PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, m_pCurrentReclusterMetadata->ExtractCaloHitMetadata(selectedReclusterListName,
         pSelectedCaloHitMetaData));
 
+    ReclusterMetadata *const pSelectedReclusterMetadata = m_pCurrentReclusterMetadata;
     m_reclusterMetadataList.pop_back();
-    delete m_pCurrentReclusterMetadata;
+
+    StatusCode statusCode(STATUS_CODE_SUCCESS);
 
     if (--m_nReclusteringProcesses > 0)
     {
         m_pCurrentReclusterMetadata = m_reclusterMetadataList.back();
         CaloHitMetadata *const pCurrentCaloHitMetaData = m_pCurrentReclusterMetadata->GetCurrentCaloHitMetadata();
-        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, pCurrentCaloHitMetaData->Update(*pSelectedCaloHitMetaData));
+        statusCode = pCurrentCaloHitMetaData->Update(*pSelectedCaloHitMetaData);
     }
     else
     {
         m_pCurrentReclusterMetadata = NULL;
-        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->Update(*pSelectedCaloHitMetaData));
+        statusCode = this->Update(*pSelectedCaloHitMetaData, pSelectedReclusterMetadata->GetCaloHitList());
     }
 
+    // Selected metadata shares its initial calo hit sets with the recluster metadata, so delete only once the update is complete
     pSelectedCaloHitMetaData->Clear();
     delete pSelectedCaloHitMetaData;
 
-    return STATUS_CODE_SUCCESS;
+    this->RecordObjectDeletions(pSelectedReclusterMetadata->GetNReplacementCaloHits());
+    delete pSelectedReclusterMetadata;
+
+    return statusCode;
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-StatusCode CaloHitManager::Update(const CaloHitMetadata &caloHitMetadata)
+StatusCode CaloHitManager::Update(const CaloHitMetadata &caloHitMetadata, const CaloHitList &initialCaloHitList)
 {
+    // Transfer availability before applying replacements, whilst all hits that may feature in the metadata remain valid
     const CaloHitReplacementList &caloHitReplacementList(caloHitMetadata.GetCaloHitReplacementList());
 
+    for (CaloHitList::const_iterator iter = initialCaloHitList.begin(), iterEnd = initialCaloHitList.end(); iter != iterEnd; ++iter)
+        this->Modifiable(*iter)->SetAvailability(caloHitMetadata.IsAvailable(*iter));
+
     for (CaloHitReplacementList::const_iterator iter = caloHitReplacementList.begin(), iterEnd = caloHitReplacementList.end(); iter != iterEnd; ++iter)
     {
-        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->Update(*(*iter)));
+        for (CaloHitList::const_iterator hitIter = (*iter)->m_newCaloHits.begin(), hitIterEnd = (*iter)->m_newCaloHits.end(); hitIter != hitIterEnd; ++hitIter)
+            this->Modifiable(*hitIter)->SetAvailability(caloHitMetadata.IsAvailable(*hitIter));
     }
 
-    const CaloHitUsageMap &caloHitUsageMap(caloHitMetadata.GetCaloHitUsageMap());
-
-    for (CaloHitUsageMap::const_iterator iter = caloHitUsageMap.begin(), iterEnd = caloHitUsageMap.end(); iter != iterEnd; ++iter)
+    for (CaloHitReplacementList::const_iterator iter = caloHitReplacementList.begin(), iterEnd = caloHitReplacementList.end(); iter != iterEnd; ++iter)
     {
-        this->Modifiable(iter->first)->SetAvailability(iter->second);
+        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->Update(*(*iter)));
     }
 
     return STATUS_CODE_SUCCESS;
@@ -423,10 +739,61 @@ StatusCode CaloHitManager::Update(const CaloHitMetadata &caloHitMetadata)
 
 StatusCode CaloHitManager::Update(const CaloHitReplacement &caloHitReplacement)
 {
-    for (NameToListMap::const_iterator listIter = m_nameToListMap.begin(), listIterEnd = m_nameToListMap.end();
-        listIter != listIterEnd; ++listIter)
+    // Only lists recorded as containing one of the old calo hits can be affected; stale entries are tolerated and checked here
+    ListHandleVector listHandles;
+
+    for (CaloHitList::const_iterator hitIter = caloHitReplacement.m_oldCaloHits.begin(), hitIterEnd = caloHitReplacement.m_oldCaloHits.end();
+        hitIter != hitIterEnd; ++hitIter)
+    {
+        const unsigned int caloHitIndex((*hitIter)->GetCaloHitIndex());
+
+        if (caloHitIndex >= m_caloHitListHandles.size())
+            continue;
+
+        const ListHandleVector &hitListHandles(m_caloHitListHandles[caloHitIndex]);
+
+        for (ListHandleVector::const_iterator handleIter = hitListHandles.begin(), handleIterEnd = hitListHandles.end();
+            handleIter != handleIterEnd; ++handleIter)
+        {
+            if (listHandles.end() == std::find(listHandles.begin(), listHandles.end(), *handleIter))
+                listHandles.push_back(*handleIter);
+        }
+    }
+
+    // Lists created sharing the contents of another list inherit its membership records, so include them, and any lists sharing theirs
+    for (unsigned int i = 0; i < listHandles.size(); ++i)
     {
-        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->Update(listIter->second, caloHitReplacement));
+        if (listHandles[i] >= m_sharingListHandles.size())
+            continue;
+
+        const ListHandleVector &sharingListHandles(m_sharingListHandles[listHandles[i]]);
+
+        for (ListHandleVector::const_iterator handleIter = sharingListHandles.begin(), handleIterEnd = sharingListHandles.end();
+            handleIter != handleIterEnd; ++handleIter)
+        {
+            if (listHandles.end() == std::find(listHandles.begin(), listHandles.end(), *handleIter))
+                listHandles.push_back(*handleIter);
+        }
+    }
+
+    for (ListHandleVector::const_iterator handleIter = listHandles.begin(), handleIterEnd = listHandles.end(); handleIter != handleIterEnd; ++handleIter)
+    {
+        // Membership is checked before the list is requested for modification, so stale entries do not force shared contents to be copied
+        const CaloHitList *const pCurrentCaloHitList(m_handleToListVector[*handleIter]);
+
+        if ((NULL == pCurrentCaloHitList) || !this->ContainsAnyCaloHit(*pCurrentCaloHitList, caloHitReplacement.m_oldCaloHits))
+            continue;
+
+        CaloHitList *pCaloHitList(NULL);
+        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->GetModifiableList(m_handleToNameVector[*handleIter], pCaloHitList));
+        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->Update(pCaloHitList, caloHitReplacement));
+
+        for (CaloHitList::const_iterator hitIter = caloHitReplacement.m_newCaloHits.begin(), hitIterEnd = caloHitReplacement.m_newCaloHits.end();
+            hitIter != hitIterEnd; ++hitIter)
+        {
+            if (pCaloHitList->end() != pCaloHitList->find(*hitIter))
+                this->RecordListMembership(*hitIter, *handleIter);
+        }
     }
 
     for (CaloHitList::const_iterator hitIter = caloHitReplacement.m_oldCaloHits.begin(), hitIterEnd = caloHitReplacement.m_oldCaloHits.end();
@@ -435,6 +802,8 @@ StatusCode CaloHitManager::Update(const CaloHitReplacement &caloHitReplacement)
         delete *hitIter;
     }
 
+    this->RecordObjectDeletions(caloHitReplacement.m_oldCaloHits.size());
+
     return STATUS_CODE_SUCCESS;
 }
 
@@ -478,4 +847,98 @@ StatusCode CaloHitManager::Update(CaloHitList *const pCaloHitList, const CaloHit
     return STATUS_CODE_SUCCESS;
 }
 
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode CaloHitManager::ApplyReplacement(const CaloHitReplacement &caloHitReplacement)
+{
+    if (m_nReclusteringProcesses > 0)
+        return m_pCurrentReclusterMetadata->GetCurrentCaloHitMetadata()->Update(caloHitReplacement);
+
+    return this->Update(caloHitReplacement);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void CaloHitManager::UnshareListIfReclustering(const std::string &listName)
+{
+    if (0 == m_nReclusteringProcesses)
+        return;
+
+    CaloHitList *pCaloHitList(NULL);
+    PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->GetModifiableList(listName, pCaloHitList));
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void CaloHitManager::RecordListMembership(const CaloHitList &caloHitList, const std::string &listName)
+{
+    const ListHandle listHandle(this->InternListHandle(listName));
+
+    for (CaloHitList::const_iterator iter = caloHitList.begin(), iterEnd = caloHitList.end(); iter != iterEnd; ++iter)
+        this->RecordListMembership(*iter, listHandle);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+bool CaloHitManager::RecordSharedListMembership(const CaloHitList &caloHitList, const std::string &listName)
+{
+    if (m_sharedListNames.end() == m_sharedListNames.find(listName))
+        return false;
+
+    for (NameToListMap::const_iterator iter = m_nameToListMap.begin(), iterEnd = m_nameToListMap.end(); iter != iterEnd; ++iter)
+    {
+        if ((&caloHitList != iter->second) || (listName == iter->first))
+            continue;
+
+        const ListHandle sourceListHandle(this->InternListHandle(iter->first)), listHandle(this->InternListHandle(listName));
+
+        if (sourceListHandle >= m_sharingListHandles.size())
+            m_sharingListHandles.resize(sourceListHandle + 1);
+
+        ListHandleVector &sharingListHandles(m_sharingListHandles[sourceListHandle]);
+
+        if (sharingListHandles.end() == std::find(sharingListHandles.begin(), sharingListHandles.end(), listHandle))
+            sharingListHandles.push_back(listHandle);
+
+        return true;
+    }
+
+    return false;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void CaloHitManager::RecordListMembership(const CaloHit *const pCaloHit, const ListHandle listHandle)
+{
+    const unsigned int caloHitIndex(pCaloHit->GetCaloHitIndex());
+
+    if (caloHitIndex >= m_caloHitListHandles.size())
+        m_caloHitListHandles.resize(caloHitIndex + 1);
+
+    ListHandleVector &hitListHandles(m_caloHitListHandles[caloHitIndex]);
+
+    if (hitListHandles.end() == std::find(hitListHandles.begin(), hitListHandles.end(), listHandle))
+        hitListHandles.push_back(listHandle);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+bool CaloHitManager::ContainsAnyCaloHit(const CaloHitList &caloHitList, const CaloHitList &candidateCaloHits) const
+{
+    for (CaloHitList::const_iterator iter = candidateCaloHits.begin(), iterEnd = candidateCaloHits.end(); iter != iterEnd; ++iter)
+    {
+        if (caloHitList.end() != caloHitList.find(*iter))
+            return true;
+    }
+
+    return false;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void CaloHitManager::AssignCaloHitIndex(const CaloHit *const pCaloHit)
+{
+    this->Modifiable(pCaloHit)->SetCaloHitIndex(m_nCaloHitIndices++);
+}
+
 } // namespace pandora
@@ -8,6 +8,7 @@
 
 #include "Managers/ClusterManager.h"
 
+#include "Objects/CaloHit.h"
 #include "Objects/Cluster.h"
 
 #include "Pandora/ObjectFactory.h"
@@ -40,9 +41,9 @@ StatusCode ClusterManager::Create(const PandoraContentApi::Cluster::Parameters &
         if (!m_canMakeNewObjects)
             throw StatusCodeException(STATUS_CODE_NOT_ALLOWED);
 
-        NameToListMap::iterator iter = m_nameToListMap.find(m_currentListName);
+        ClusterList *const pCurrentList(m_handleToListVector[m_currentListHandle]);
 
-        if (m_nameToListMap.end() == iter)
+        if (NULL == pCurrentList)
              throw StatusCodeException(STATUS_CODE_NOT_INITIALIZED);
 
         PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, factory.Create(parameters, pCluster));
@@ -50,9 +51,11 @@ StatusCode ClusterManager::Create(const PandoraContentApi::Cluster::Parameters &
         if (NULL == pCluster)
              throw StatusCodeException(STATUS_CODE_FAILURE);
 
-        if (!iter->second->insert(pCluster).second)
+        if (!pCurrentList->insert(pCluster).second)
              throw StatusCodeException(STATUS_CODE_FAILURE);
 
+        this->RecordObjectCreation();
+
         return STATUS_CODE_SUCCESS;
     }
     catch (StatusCodeException &statusCodeException)
@@ -157,6 +160,7 @@ StatusCode ClusterManager::MergeAndDeleteClusters(const Cluster *const pClusterT
 
     delete pClusterToDelete;
     deleteListIter->second->erase(clusterToDeleteIter);
+    this->RecordObjectDeletions(1);
 
     return STATUS_CODE_SUCCESS;
 }
@@ -225,4 +229,104 @@ StatusCode ClusterManager::RemoveTrackAssociations(const TrackToClusterMap &trac
     return STATUS_CODE_SUCCESS;
 }
 
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void ClusterManager::ResetMCParticleWeights() const
+{
+    for (NameToListMap::const_iterator iter = m_nameToListMap.begin(), iterEnd = m_nameToListMap.end(); iter != iterEnd; ++iter)
+    {
+        for (ClusterList::const_iterator cIter = iter->second->begin(), cIterEnd = iter->second->end(); cIter != cIterEnd; ++cIter)
+            this->Modifiable(*cIter)->ResetMCParticleWeights();
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode ClusterManager::SelectClustersForNextWindow(const float windowStartTime, NameToClusterListMap &windowClusterListMap)
+{
+    for (StringSet::const_iterator nameIter = m_savedLists.begin(), nameIterEnd = m_savedLists.end(); nameIter != nameIterEnd; ++nameIter)
+    {
+        if (NULL_LIST_NAME == *nameIter)
+            continue;
+
+        ClusterList *pClusterList(NULL);
+        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->GetModifiableList(*nameIter, pClusterList));
+
+        for (ClusterList::iterator iter = pClusterList->begin(); iter != pClusterList->end();)
+        {
+            const Cluster *const pCluster(*iter);
+
+            if (!this->IsWithinWindow(pCluster, windowStartTime))
+            {
+                ++iter;
+                continue;
+            }
+
+            const TrackList trackList(pCluster->GetAssociatedTrackList());
+
+            for (TrackList::const_iterator tIter = trackList.begin(), tIterEnd = trackList.end(); tIter != tIterEnd; ++tIter)
+                PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->RemoveTrackAssociation(pCluster, *tIter));
+
+            this->Modifiable(pCluster)->RemoveTrackSeed();
+            this->Modifiable(pCluster)->SetAvailability(true);
+            windowClusterListMap[*nameIter].insert(pCluster);
+            pClusterList->erase(iter++);
+        }
+    }
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode ClusterManager::ResetForNextWindow(const NameToClusterListMap &windowClusterListMap, ClusterList &retainedClusterList)
+{
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, AlgorithmObjectManager<Cluster>::ResetForNextEvent());
+
+    for (NameToClusterListMap::const_iterator mapIter = windowClusterListMap.begin(), mapIterEnd = windowClusterListMap.end();
+        mapIter != mapIterEnd; ++mapIter)
+    {
+        ClusterList *pClusterList(NULL);
+        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->CreateList(mapIter->first, pClusterList));
+        m_savedLists.insert(mapIter->first);
+
+        for (ClusterList::const_iterator iter = mapIter->second.begin(), iterEnd = mapIter->second.end(); iter != iterEnd; ++iter)
+        {
+            pClusterList->insert(*iter);
+
+            if (retainedClusterList.insert(*iter).second)
+                this->RecordObjectCreation();
+        }
+    }
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+bool ClusterManager::IsWithinWindow(const Cluster *const pCluster, const float windowStartTime) const
+{
+    const OrderedCaloHitList &orderedCaloHitList(pCluster->GetOrderedCaloHitList());
+
+    for (OrderedCaloHitList::const_iterator layerIter = orderedCaloHitList.begin(), layerIterEnd = orderedCaloHitList.end();
+        layerIter != layerIterEnd; ++layerIter)
+    {
+        for (CaloHitList::const_iterator hitIter = layerIter->second->begin(), hitIterEnd = layerIter->second->end(); hitIter != hitIterEnd; ++hitIter)
+        {
+            if ((*hitIter)->GetTime() < windowStartTime)
+                return false;
+        }
+    }
+
+    const CaloHitList &isolatedCaloHitList(pCluster->GetIsolatedCaloHitList());
+
+    for (CaloHitList::const_iterator hitIter = isolatedCaloHitList.begin(), hitIterEnd = isolatedCaloHitList.end(); hitIter != hitIterEnd; ++hitIter)
+    {
+        if ((*hitIter)->GetTime() < windowStartTime)
+            return false;
+    }
+
+    return true;
+}
+
 } // namespace pandora
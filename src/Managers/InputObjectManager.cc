@@ -12,6 +12,8 @@
 #include "Objects/MCParticle.h"
 #include "Objects/Track.h"
 
+#include <algorithm>
+
 namespace pandora
 {
 
@@ -22,7 +24,10 @@ const std::string InputObjectManager<T>::INPUT_LIST_NAME = "Input";
 
 template<typename T>
 InputObjectManager<T>::InputObjectManager(const Pandora *const pPandora) :
-    Manager<T>(pPandora)
+    Manager<T>(pPandora),
+    m_eventSizeHint(0),
+    m_eventSizeEstimate(0),
+    m_shouldRetainCapacity(false)
 {
 }
 
@@ -43,7 +48,7 @@ StatusCode InputObjectManager<T>::CreateInputList()
     if (Manager<T>::m_nameToListMap.end() == existingListIter)
         return STATUS_CODE_FAILURE;
 
-    Manager<T>::m_currentListName = INPUT_LIST_NAME;
+    Manager<T>::SetCurrentListName(INPUT_LIST_NAME);
     return STATUS_CODE_SUCCESS;
 }
 
@@ -53,8 +58,8 @@ template<typename T>
 StatusCode InputObjectManager<T>::CreateTemporaryListAndSetCurrent(const Algorithm *const pAlgorithm, const ObjectList &objectList,
     std::string &temporaryListName)
 {
-    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, Manager<T>::CreateTemporaryListAndSetCurrent(pAlgorithm, temporaryListName));
-    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->AddObjectsToList(temporaryListName, objectList));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, Manager<T>::CreateTemporaryList(pAlgorithm, objectList, temporaryListName));
+    Manager<T>::SetCurrentListName(temporaryListName);
 
     return STATUS_CODE_SUCCESS;
 }
@@ -67,10 +72,7 @@ StatusCode InputObjectManager<T>::SaveList(const std::string &listName, const Ob
     if (Manager<T>::m_nameToListMap.end() != Manager<T>::m_nameToListMap.find(listName))
         return this->AddObjectsToList(listName, objectList);
 
-    if (!Manager<T>::m_nameToListMap.insert(typename Manager<T>::NameToListMap::value_type(listName, new ObjectList)).second)
-        return STATUS_CODE_ALREADY_PRESENT;
-
-    *(Manager<T>::m_nameToListMap[listName]) = objectList;
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, Manager<T>::CreateList(listName, objectList));
     Manager<T>::m_savedLists.insert(listName);
 
     return STATUS_CODE_SUCCESS;
@@ -84,13 +86,11 @@ StatusCode InputObjectManager<T>::AddObjectsToList(const std::string &listName,
     if (Manager<T>::NULL_LIST_NAME == listName)
         return STATUS_CODE_NOT_ALLOWED;
 
-    typename Manager<T>::NameToListMap::iterator listIter = Manager<T>::m_nameToListMap.find(listName);
+    ObjectList *pSavedList(NULL);
 
-    if (Manager<T>::m_nameToListMap.end() == listIter)
+    if (STATUS_CODE_SUCCESS != Manager<T>::GetModifiableList(listName, pSavedList))
         return STATUS_CODE_NOT_FOUND;
 
-    ObjectList *const pSavedList = listIter->second;
-
     if (pSavedList == &objectList)
         return STATUS_CODE_INVALID_PARAMETER;
 
@@ -108,13 +108,11 @@ StatusCode InputObjectManager<T>::AddObjectsToList(const std::string &listName,
 template<typename T>
 StatusCode InputObjectManager<T>::RemoveObjectsFromList(const std::string &listName, const ObjectList &objectList)
 {
-    typename Manager<T>::NameToListMap::iterator listIter = Manager<T>::m_nameToListMap.find(listName);
+    ObjectList *pSavedList(NULL);
 
-    if (Manager<T>::m_nameToListMap.end() == listIter)
+    if (STATUS_CODE_SUCCESS != Manager<T>::GetModifiableList(listName, pSavedList))
         return STATUS_CODE_NOT_FOUND;
 
-    ObjectList *const pSavedList = listIter->second;
-
     if (pSavedList == &objectList)
         return STATUS_CODE_INVALID_PARAMETER;
 
@@ -144,6 +142,15 @@ StatusCode InputObjectManager<T>::EraseAllContent()
     {
         for (typename ObjectList::iterator iter = inputIter->second->begin(), iterEnd = inputIter->second->end(); iter != iterEnd; ++iter)
             delete *iter;
+
+        m_eventSizeEstimate = std::max(static_cast<unsigned int>(inputIter->second->size()), m_eventSizeEstimate / 2);
+
+        // Clearing retains the bucket array, which is then moved aside and restored to the next event's input list
+        if (m_shouldRetainCapacity)
+        {
+            inputIter->second->clear();
+            m_retainedInputList.swap(*inputIter->second);
+        }
     }
 
     return Manager<T>::EraseAllContent();
@@ -155,12 +162,65 @@ template<typename T>
 StatusCode InputObjectManager<T>::CreateInitialLists()
 {
     PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, Manager<T>::CreateInitialLists());
-    Manager<T>::m_nameToListMap[INPUT_LIST_NAME] = new ObjectList;
+    ObjectList *pObjectList(NULL);
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, Manager<T>::CreateList(INPUT_LIST_NAME, pObjectList));
     Manager<T>::m_savedLists.insert(INPUT_LIST_NAME);
 
+    if (m_shouldRetainCapacity)
+        pObjectList->swap(m_retainedInputList);
+
+    this->ReserveEventCapacity(this->GetExpectedEventSize());
+
     return STATUS_CODE_SUCCESS;
 }
 
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template<typename T>
+StatusCode InputObjectManager<T>::SetEventSizeHint(const unsigned int nObjects)
+{
+    m_eventSizeHint = nObjects;
+    this->ReserveEventCapacity(this->GetExpectedEventSize());
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template<typename T>
+void InputObjectManager<T>::SetShouldRetainCapacity(const bool shouldRetainCapacity)
+{
+    m_shouldRetainCapacity = shouldRetainCapacity;
+
+    if (!m_shouldRetainCapacity)
+        ObjectList().swap(m_retainedInputList);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template<typename T>
+unsigned int InputObjectManager<T>::GetExpectedEventSize() const
+{
+    return std::max(m_eventSizeHint, m_eventSizeEstimate);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template<typename T>
+void InputObjectManager<T>::ReserveEventCapacity(const unsigned int nObjects)
+{
+    if (0 == nObjects)
+        return;
+
+#if __cplusplus > 199711L
+    // Reserving for a smaller number of objects releases any excess retained capacity, e.g. after an unusually large event
+    typename Manager<T>::NameToListMap::const_iterator inputIter = Manager<T>::m_nameToListMap.find(INPUT_LIST_NAME);
+
+    if (Manager<T>::m_nameToListMap.end() != inputIter)
+        inputIter->second->reserve(std::max(nObjects, static_cast<unsigned int>(inputIter->second->size())));
+#endif
+}
+
 //------------------------------------------------------------------------------------------------------------------------------------------
 //------------------------------------------------------------------------------------------------------------------------------------------
 
@@ -46,16 +46,20 @@ StatusCode MCManager::Create(const PandoraApi::MCParticle::Parameters &parameter
     {
         PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, factory.Create(parameters, pMCParticle));
 
-        NameToListMap::iterator inputIter = m_nameToListMap.find(INPUT_LIST_NAME);
+        MCParticleList *pInputList(NULL);
 
-        if ((NULL == pMCParticle) || (m_nameToListMap.end() == inputIter) || (inputIter->second->end() != inputIter->second->find(pMCParticle)))
+        if ((NULL == pMCParticle) || (STATUS_CODE_SUCCESS != this->GetModifiableList(INPUT_LIST_NAME, pInputList)) ||
+            (pInputList->end() != pInputList->find(pMCParticle)))
+        {
             throw StatusCodeException(STATUS_CODE_FAILURE);
+        }
 
         if (m_uidToMCParticleMap.end() != m_uidToMCParticleMap.find(pMCParticle->GetUid()))
             throw StatusCodeException(STATUS_CODE_ALREADY_PRESENT);
 
-        (void) inputIter->second->insert(pMCParticle);
+        (void) pInputList->insert(pMCParticle);
         (void) m_uidToMCParticleMap.insert(UidToMCParticleMap::value_type(pMCParticle->GetUid(), pMCParticle));
+        this->RecordObjectCreation();
 
         return STATUS_CODE_SUCCESS;
     }
@@ -73,7 +77,7 @@ StatusCode MCManager::Create(const PandoraApi::MCParticle::Parameters &parameter
 StatusCode MCManager::EraseAllContent()
 {
     m_uidToMCParticleMap.clear();
-    m_parentDaughterRelationMap.clear();
+    m_parentDaughterRelationVector.clear();
     m_caloHitToMCParticleMap.clear();
     m_trackToMCParticleMap.clear();
 
@@ -82,9 +86,21 @@ StatusCode MCManager::EraseAllContent()
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+void MCManager::ReserveEventCapacity(const unsigned int nObjects)
+{
+    InputObjectManager<MCParticle>::ReserveEventCapacity(nObjects);
+
+#if __cplusplus > 199711L
+    if (nObjects > 0)
+        m_uidToMCParticleMap.reserve(nObjects);
+#endif
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 StatusCode MCManager::SetMCParentDaughterRelationship(const Uid parentUid, const Uid daughterUid)
 {
-    m_parentDaughterRelationMap.insert(MCParticleRelationMap::value_type(parentUid, daughterUid));
+    m_parentDaughterRelationVector.push_back(MCParticleRelationVector::value_type(parentUid, daughterUid));
 
     return STATUS_CODE_SUCCESS;
 }
@@ -119,10 +135,10 @@ StatusCode MCManager::SelectPfoTargets()
     if (m_nameToListMap.end() == inputIter)
         return STATUS_CODE_FAILURE;
 
-    NameToListMap::iterator selectedIter = m_nameToListMap.find(SELECTED_LIST_NAME);
-
-    if (m_nameToListMap.end() != selectedIter)
-        m_nameToListMap.erase(selectedIter);
+    if (m_nameToListMap.end() != m_nameToListMap.find(SELECTED_LIST_NAME))
+    {
+        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->EraseList(SELECTED_LIST_NAME));
+    }
 
     // Strip down mc particles and relationships to just those of pfo targets, if specified
     const bool shouldCollapseMCParticlesToPfoTarget(m_pPandora->GetSettings()->ShouldCollapseMCParticlesToPfoTarget());
@@ -147,7 +163,11 @@ StatusCode MCManager::SelectPfoTargets()
 
     // Save selected pfo target list
     PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->SaveList(SELECTED_LIST_NAME, selectedMCPfoList));
-    m_currentListName = SELECTED_LIST_NAME;
+    this->SetCurrentListName(SELECTED_LIST_NAME);
+
+    // ATTN: Preparation may be deferred until algorithms are already running, so the selected list must persist beyond their completion
+    for (AlgorithmInfoMap::iterator iter = m_algorithmInfoMap.begin(), iterEnd = m_algorithmInfoMap.end(); iter != iterEnd; ++iter)
+        iter->second.m_parentListName = SELECTED_LIST_NAME;
 
     return STATUS_CODE_SUCCESS;
 }
@@ -160,24 +180,35 @@ StatusCode MCManager::ApplyPfoSelectionRules(const MCParticle *const pMCParticle
     const float selectionMomentum(m_pPandora->GetSettings()->GetMCPfoSelectionMomentum());
     const float selectionEnergyCutOffProtonsNeutrons(m_pPandora->GetSettings()->GetMCPfoSelectionLowEnergyNeutronProtonCutOff());
 
-    const int particleId(pMCParticle->GetParticleId());
+    // ATTN: Depth-first traversal, using an explicit stack, visiting daughters in the same order as a recursive descent. Particles
+    // reached again via a second parent are not re-examined, as a second visit could not alter any pfo target assignment.
+    MCParticleList visitedList;
+    MCParticleVector mcParticleStack(1, pMCParticle);
 
-    // ATTN: Don't take particles from previously used decay chains; could happen because mc particles can have multiple parents.
-    if ((mcPfoList.find(pMCParticle) == mcPfoList.end()) &&
-        (pMCParticle->GetOuterRadius() > selectionRadius) &&
-        (pMCParticle->GetInnerRadius() <= selectionRadius) &&
-        (pMCParticle->GetMomentum().GetMagnitude() > selectionMomentum) &&
-        !((particleId == PROTON || particleId == NEUTRON) && (pMCParticle->GetEnergy() < selectionEnergyCutOffProtonsNeutrons)))
-    {
-        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->SetPfoTargetInTree(pMCParticle, pMCParticle, true));
-        mcPfoList.insert(pMCParticle);
-    }
-    else
+    while (!mcParticleStack.empty())
     {
-        for(MCParticleList::const_iterator iter = pMCParticle->m_daughterList.begin(), iterEnd = pMCParticle->m_daughterList.end();
-            iter != iterEnd; ++iter)
+        const MCParticle *const pCurrentMCParticle(mcParticleStack.back());
+        mcParticleStack.pop_back();
+
+        if (!visitedList.insert(pCurrentMCParticle).second)
+            continue;
+
+        const int particleId(pCurrentMCParticle->GetParticleId());
+
+        // ATTN: Don't take particles from previously used decay chains; could happen because mc particles can have multiple parents.
+        if ((mcPfoList.find(pCurrentMCParticle) == mcPfoList.end()) &&
+            (pCurrentMCParticle->GetOuterRadius() > selectionRadius) &&
+            (pCurrentMCParticle->GetInnerRadius() <= selectionRadius) &&
+            (pCurrentMCParticle->GetMomentum().GetMagnitude() > selectionMomentum) &&
+            !((particleId == PROTON || particleId == NEUTRON) && (pCurrentMCParticle->GetEnergy() < selectionEnergyCutOffProtonsNeutrons)))
         {
-            PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->ApplyPfoSelectionRules(*iter, mcPfoList));
+            PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->SetPfoTargetInTree(pCurrentMCParticle, pCurrentMCParticle, true));
+            mcPfoList.insert(pCurrentMCParticle);
+        }
+        else
+        {
+            const MCParticleVector daughterVector(pCurrentMCParticle->GetDaughterList().begin(), pCurrentMCParticle->GetDaughterList().end());
+            mcParticleStack.insert(mcParticleStack.end(), daughterVector.rbegin(), daughterVector.rend());
         }
     }
 
@@ -188,22 +219,27 @@ StatusCode MCManager::ApplyPfoSelectionRules(const MCParticle *const pMCParticle
 
 StatusCode MCManager::SetPfoTargetInTree(const MCParticle *const pMCParticle, const MCParticle *const pPfoTarget, bool onlyDaughters) const
 {
-    if (pMCParticle->IsPfoTargetSet())
-        return STATUS_CODE_SUCCESS;
+    // ATTN: Depth-first traversal, using an explicit stack, visiting daughters then (optionally, for all but the initial particle) parents
+    MCParticleVector mcParticleStack(1, pMCParticle);
 
-    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->Modifiable(pMCParticle)->SetPfoTarget(pPfoTarget));
-
-    for (MCParticleList::const_iterator iter = pMCParticle->GetDaughterList().begin(), iterEnd = pMCParticle->GetDaughterList().end(); iter != iterEnd; ++iter)
+    while (!mcParticleStack.empty())
     {
-       PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->SetPfoTargetInTree(*iter, pPfoTarget));
-    }
+        const MCParticle *const pCurrentMCParticle(mcParticleStack.back());
+        mcParticleStack.pop_back();
 
-    if (!onlyDaughters)
-    {
-        for (MCParticleList::const_iterator iter = pMCParticle->GetParentList().begin(), iterEnd = pMCParticle->GetParentList().end(); iter != iterEnd; ++iter)
+        if (pCurrentMCParticle->IsPfoTargetSet())
+            continue;
+
+        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->Modifiable(pCurrentMCParticle)->SetPfoTarget(pPfoTarget));
+
+        if (!onlyDaughters || (pCurrentMCParticle != pMCParticle))
         {
-            PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->SetPfoTargetInTree(*iter, pPfoTarget));
+            const MCParticleVector parentVector(pCurrentMCParticle->GetParentList().begin(), pCurrentMCParticle->GetParentList().end());
+            mcParticleStack.insert(mcParticleStack.end(), parentVector.rbegin(), parentVector.rend());
         }
+
+        const MCParticleVector daughterVector(pCurrentMCParticle->GetDaughterList().begin(), pCurrentMCParticle->GetDaughterList().end());
+        mcParticleStack.insert(mcParticleStack.end(), daughterVector.rbegin(), daughterVector.rend());
     }
 
     return STATUS_CODE_SUCCESS;
@@ -213,7 +249,7 @@ StatusCode MCManager::SetPfoTargetInTree(const MCParticle *const pMCParticle, co
 
 StatusCode MCManager::AddMCParticleRelationships() const
 {
-    for (MCParticleRelationMap::const_iterator uidIter = m_parentDaughterRelationMap.begin(), uidIterEnd = m_parentDaughterRelationMap.end();
+    for (MCParticleRelationVector::const_iterator uidIter = m_parentDaughterRelationVector.begin(), uidIterEnd = m_parentDaughterRelationVector.end();
         uidIter != uidIterEnd; ++uidIter)
     {
         UidToMCParticleMap::const_iterator parentIter = m_uidToMCParticleMap.find(uidIter->first);
@@ -248,7 +284,7 @@ StatusCode MCManager::RemoveAllMCParticleRelationships()
         this->RemoveMCParticleRelationships(*iter);
 
     m_uidToMCParticleMap.clear();
-    m_parentDaughterRelationMap.clear();
+    m_parentDaughterRelationVector.clear();
     m_caloHitToMCParticleMap.clear();
     m_trackToMCParticleMap.clear();
 
@@ -8,6 +8,15 @@
 
 #include "Managers/Manager.h"
 
+#include "Objects/CaloHit.h"
+#include "Objects/Cluster.h"
+#include "Objects/MCParticle.h"
+#include "Objects/ParticleFlowObject.h"
+#include "Objects/Track.h"
+#include "Objects/Vertex.h"
+
+#include "Pandora/EventResourceReport.h"
+
 namespace pandora
 {
 
@@ -18,9 +27,15 @@ const std::string Manager<T>::NULL_LIST_NAME = "NullList";
 
 template<typename T>
 Manager<T>::Manager(const Pandora *const pPandora) :
+    m_nTemporaryListsCreated(0),
     m_currentListName(NULL_LIST_NAME),
+    m_currentListHandle(0),
+    m_nObjectsCreated(0),
+    m_nObjectsDeleted(0),
+    m_peakNLiveObjects(0),
     m_pPandora(pPandora)
 {
+    m_currentListHandle = this->InternListHandle(NULL_LIST_NAME);
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -46,11 +61,61 @@ StatusCode Manager<T>::GetList(const std::string &listName, const ObjectList *&p
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+template<typename T>
+StatusCode Manager<T>::GetList(const ListHandle listHandle, const ObjectList *&pObjectList) const
+{
+    if ((listHandle >= m_handleToListVector.size()) || (NULL == m_handleToListVector[listHandle]))
+        return STATUS_CODE_NOT_INITIALIZED;
+
+    pObjectList = m_handleToListVector[listHandle];
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 template<typename T>
 StatusCode Manager<T>::GetCurrentList(const ObjectList *&pObjectList, std::string &listName) const
 {
     listName = m_currentListName;
-    return this->GetList(listName, pObjectList);
+    return this->GetList(m_currentListHandle, pObjectList);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template<typename T>
+StatusCode Manager<T>::FindListHandle(const std::string &listName, ListHandle &listHandle) const
+{
+    typename NameToHandleMap::const_iterator iter = m_nameToHandleMap.find(listName);
+
+    if (m_nameToHandleMap.end() == iter)
+        return STATUS_CODE_NOT_FOUND;
+
+    listHandle = iter->second;
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template<typename T>
+StatusCode Manager<T>::GetListName(const ListHandle listHandle, std::string &listName) const
+{
+    if (listHandle >= m_handleToNameVector.size())
+        return STATUS_CODE_NOT_FOUND;
+
+    listName = m_handleToNameVector[listHandle];
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template<typename T>
+StatusCode Manager<T>::GetCurrentListHandle(ListHandle &listHandle) const
+{
+    if (m_currentListName.empty())
+        return STATUS_CODE_NOT_INITIALIZED;
+
+    listHandle = m_currentListHandle;
+    return STATUS_CODE_SUCCESS;
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -103,7 +168,11 @@ inline StatusCode Manager<T>::GetAlgorithmInputListName(const Algorithm *const p
 template<typename T>
 StatusCode Manager<T>::ResetCurrentListToAlgorithmInputList(const Algorithm *const pAlgorithm)
 {
-    return this->GetAlgorithmInputListName(pAlgorithm, m_currentListName);
+    std::string listName;
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->GetAlgorithmInputListName(pAlgorithm, listName));
+    this->SetCurrentListName(listName);
+
+    return STATUS_CODE_SUCCESS;
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -120,7 +189,7 @@ StatusCode Manager<T>::ReplaceCurrentAndAlgorithmInputLists(const Algorithm *con
     if (m_algorithmInfoMap.end() == m_algorithmInfoMap.find(pAlgorithm))
         return STATUS_CODE_FAILURE;
 
-    m_currentListName = listName;
+    this->SetCurrentListName(listName);
 
     for (typename AlgorithmInfoMap::iterator iter = m_algorithmInfoMap.begin(), iterEnd = m_algorithmInfoMap.end(); iter != iterEnd; ++iter)
     {
@@ -132,6 +201,17 @@ StatusCode Manager<T>::ReplaceCurrentAndAlgorithmInputLists(const Algorithm *con
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+template<typename T>
+StatusCode Manager<T>::ReplaceCurrentAndAlgorithmInputLists(const Algorithm *const pAlgorithm, const ListHandle listHandle)
+{
+    if (listHandle >= m_handleToNameVector.size())
+        return STATUS_CODE_NOT_FOUND;
+
+    return this->ReplaceCurrentAndAlgorithmInputLists(pAlgorithm, m_handleToNameVector[listHandle]);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 template<typename T>
 StatusCode Manager<T>::DropCurrentList(const Algorithm *const pAlgorithm)
 {
@@ -142,21 +222,33 @@ StatusCode Manager<T>::DropCurrentList(const Algorithm *const pAlgorithm)
 
 template<typename T>
 StatusCode Manager<T>::CreateTemporaryListAndSetCurrent(const Algorithm *const pAlgorithm, std::string &temporaryListName)
+{
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->CreateTemporaryList(pAlgorithm, ObjectList(), temporaryListName));
+    this->SetCurrentListName(temporaryListName);
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template<typename T>
+StatusCode Manager<T>::CreateTemporaryList(const Algorithm *const pAlgorithm, const ObjectList &objectList, std::string &temporaryListName)
 {
     typename AlgorithmInfoMap::iterator iter = m_algorithmInfoMap.find(pAlgorithm);
 
     if (m_algorithmInfoMap.end() == iter)
         return STATUS_CODE_NOT_FOUND;
 
-    temporaryListName = TypeToString(pAlgorithm) + "_" + TypeToString(iter->second.m_numberOfListsCreated++);
+    // Temporary list names are unique within an event and are interned once, then reused in subsequent events
+    if (m_nTemporaryListsCreated >= m_temporaryListHandles.size())
+        m_temporaryListHandles.push_back(this->InternListHandle("TemporaryList_" + TypeToString(m_nTemporaryListsCreated)));
+
+    temporaryListName = m_handleToNameVector[m_temporaryListHandles[m_nTemporaryListsCreated++]];
 
     if (!iter->second.m_temporaryListNames.insert(temporaryListName).second)
         return STATUS_CODE_ALREADY_PRESENT;
 
-    m_nameToListMap[temporaryListName] = new ObjectList;
-    m_currentListName = temporaryListName;
-
-    return STATUS_CODE_SUCCESS;
+    return this->CreateList(temporaryListName, objectList);
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -169,7 +261,6 @@ StatusCode Manager<T>::RegisterAlgorithm(const Algorithm *const pAlgorithm)
 
     AlgorithmInfo algorithmInfo;
     algorithmInfo.m_parentListName = m_currentListName;
-    algorithmInfo.m_numberOfListsCreated = 0;
 
     if (!m_algorithmInfoMap.insert(typename AlgorithmInfoMap::value_type(pAlgorithm, algorithmInfo)).second)
         return STATUS_CODE_ALREADY_PRESENT;
@@ -190,17 +281,12 @@ StatusCode Manager<T>::ResetAlgorithmInfo(const Algorithm *const pAlgorithm, boo
     for (StringSet::const_iterator listNameIter = algorithmListIter->second.m_temporaryListNames.begin(),
         listNameIterEnd = algorithmListIter->second.m_temporaryListNames.end(); listNameIter != listNameIterEnd; ++listNameIter)
     {
-        typename NameToListMap::iterator iter = m_nameToListMap.find(*listNameIter);
-
-        if (m_nameToListMap.end() == iter)
+        if (STATUS_CODE_SUCCESS != this->EraseList(*listNameIter))
             return STATUS_CODE_FAILURE;
-
-        delete iter->second;
-        m_nameToListMap.erase(iter);
     }
 
     algorithmListIter->second.m_temporaryListNames.clear();
-    m_currentListName = algorithmListIter->second.m_parentListName;
+    this->SetCurrentListName(algorithmListIter->second.m_parentListName);
 
     if (isAlgorithmFinished)
         m_algorithmInfoMap.erase(algorithmListIter);
@@ -226,13 +312,28 @@ StatusCode Manager<T>::EraseAllContent()
 {
     for (typename NameToListMap::iterator iter = m_nameToListMap.begin(); iter != m_nameToListMap.end();)
     {
-        delete iter->second;
+        if (m_sharedListNames.end() == m_sharedListNames.find(iter->first))
+            delete iter->second;
+
         m_nameToListMap.erase(iter++);
     }
 
-    m_currentListName = NULL_LIST_NAME;
+    for (typename ObjectListVector::const_iterator iter = m_retiredLists.begin(), iterEnd = m_retiredLists.end(); iter != iterEnd; ++iter)
+        delete *iter;
+
+    m_handleToListVector.assign(m_handleToListVector.size(), NULL);
+    m_nTemporaryListsCreated = 0;
+
+    this->SetCurrentListName(NULL_LIST_NAME);
     m_nameToListMap.clear();
     m_savedLists.clear();
+    m_sharedListNames.clear();
+    m_managedLists.clear();
+    m_unsharedLists.clear();
+    m_retiredLists.clear();
+    m_nObjectsCreated = 0;
+    m_nObjectsDeleted = 0;
+    m_peakNLiveObjects = 0;
 
     return STATUS_CODE_SUCCESS;
 }
@@ -245,7 +346,8 @@ StatusCode Manager<T>::CreateInitialLists()
     if (!m_nameToListMap.empty() || !m_savedLists.empty())
         return STATUS_CODE_NOT_ALLOWED;
 
-    m_nameToListMap[NULL_LIST_NAME] = new ObjectList;
+    ObjectList *pObjectList(NULL);
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->CreateList(NULL_LIST_NAME, pObjectList));
     m_savedLists.insert(NULL_LIST_NAME);
 
     return STATUS_CODE_SUCCESS;
@@ -253,6 +355,224 @@ StatusCode Manager<T>::CreateInitialLists()
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+template<typename T>
+StatusCode Manager<T>::CreateList(const std::string &listName, ObjectList *&pObjectList)
+{
+    if (m_nameToListMap.end() != m_nameToListMap.find(listName))
+        return STATUS_CODE_ALREADY_PRESENT;
+
+    pObjectList = new ObjectList;
+    m_nameToListMap.insert(typename NameToListMap::value_type(listName, pObjectList));
+    m_managedLists.insert(pObjectList);
+    m_handleToListVector[this->InternListHandle(listName)] = pObjectList;
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template<typename T>
+StatusCode Manager<T>::CreateList(const std::string &listName, const ObjectList &objectList)
+{
+    if (m_nameToListMap.end() != m_nameToListMap.find(listName))
+        return STATUS_CODE_ALREADY_PRESENT;
+
+    const bool isManagedList(m_managedLists.end() != m_managedLists.find(&objectList));
+
+    ObjectList *const pObjectList(isManagedList ? const_cast<ObjectList*>(&objectList) : new ObjectList(objectList));
+    m_nameToListMap.insert(typename NameToListMap::value_type(listName, pObjectList));
+    m_handleToListVector[this->InternListHandle(listName)] = pObjectList;
+
+    if (isManagedList)
+    {
+        m_sharedListNames.insert(listName);
+    }
+    else
+    {
+        m_managedLists.insert(pObjectList);
+    }
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template<typename T>
+StatusCode Manager<T>::GetModifiableList(const std::string &listName, ObjectList *&pObjectList)
+{
+    typename NameToListMap::iterator iter = m_nameToListMap.find(listName);
+
+    if (m_nameToListMap.end() == iter)
+        return STATUS_CODE_NOT_FOUND;
+
+    if (!m_sharedListNames.empty())
+    {
+        if (m_sharedListNames.end() != m_sharedListNames.find(listName))
+        {
+            PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->UnshareList(listName));
+        }
+        else
+        {
+            // The list holds contents shared by other lists, which must each receive a copy before the contents change
+            for (StringSet::const_iterator nameIter = m_sharedListNames.begin(); nameIter != m_sharedListNames.end(); )
+            {
+                const std::string sharedListName(*(nameIter++));
+                typename NameToListMap::const_iterator sharedIter = m_nameToListMap.find(sharedListName);
+
+                if (m_nameToListMap.end() == sharedIter)
+                    return STATUS_CODE_NOT_FOUND;
+
+                if (sharedIter->second == iter->second)
+                    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->UnshareList(sharedListName));
+            }
+        }
+    }
+
+    pObjectList = iter->second;
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template<typename T>
+StatusCode Manager<T>::EraseList(const std::string &listName)
+{
+    typename NameToListMap::iterator iter = m_nameToListMap.find(listName);
+
+    if (m_nameToListMap.end() == iter)
+        return STATUS_CODE_NOT_FOUND;
+
+    const bool isSharingContents(1 == m_sharedListNames.erase(listName));
+    bool isContentsHandedOver(false);
+
+    // Contents still shared by another list are handed over to that list, without a copy, rather than deleted
+    for (StringSet::iterator nameIter = m_sharedListNames.begin(), nameIterEnd = m_sharedListNames.end();
+        !isSharingContents && (nameIter != nameIterEnd); ++nameIter)
+    {
+        typename NameToListMap::const_iterator sharedIter = m_nameToListMap.find(*nameIter);
+
+        if (m_nameToListMap.end() == sharedIter)
+            return STATUS_CODE_NOT_FOUND;
+
+        if (sharedIter->second == iter->second)
+        {
+            m_sharedListNames.erase(nameIter);
+            isContentsHandedOver = true;
+            break;
+        }
+    }
+
+    if (!isSharingContents && !isContentsHandedOver)
+    {
+        m_managedLists.erase(iter->second);
+
+        // Contents formerly shared may still be addressed via a list that has since been given its own copy, so are kept until the event ends
+        if (1 == m_unsharedLists.erase(iter->second))
+        {
+            m_retiredLists.push_back(iter->second);
+        }
+        else
+        {
+            delete iter->second;
+        }
+    }
+
+    m_nameToListMap.erase(iter);
+    m_handleToListVector[this->InternListHandle(listName)] = NULL;
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template<typename T>
+void Manager<T>::SetCurrentListName(const std::string &listName)
+{
+    m_currentListName = listName;
+    m_currentListHandle = this->InternListHandle(listName);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template<typename T>
+StatusCode Manager<T>::UnshareList(const std::string &listName)
+{
+    typename NameToListMap::iterator iter = m_nameToListMap.find(listName);
+
+    if (m_nameToListMap.end() == iter)
+        return STATUS_CODE_NOT_FOUND;
+
+    if (1 != m_sharedListNames.erase(listName))
+        return STATUS_CODE_FAILURE;
+
+    m_unsharedLists.insert(iter->second);
+    iter->second = new ObjectList(*(iter->second));
+    m_managedLists.insert(iter->second);
+    m_handleToListVector[this->InternListHandle(listName)] = iter->second;
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template<typename T>
+ListHandle Manager<T>::InternListHandle(const std::string &listName)
+{
+    typename NameToHandleMap::const_iterator iter = m_nameToHandleMap.find(listName);
+
+    if (m_nameToHandleMap.end() != iter)
+        return iter->second;
+
+    const ListHandle listHandle(m_handleToNameVector.size());
+    m_nameToHandleMap.insert(typename NameToHandleMap::value_type(listName, listHandle));
+    m_handleToNameVector.push_back(listName);
+
+    typename NameToListMap::const_iterator listIter = m_nameToListMap.find(listName);
+    m_handleToListVector.push_back((m_nameToListMap.end() != listIter) ? listIter->second : NULL);
+
+    return listHandle;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template<typename T>
+void Manager<T>::RecordObjectCreation()
+{
+    ++m_nObjectsCreated;
+
+    if (m_nObjectsCreated - m_nObjectsDeleted > m_peakNLiveObjects)
+        m_peakNLiveObjects = m_nObjectsCreated - m_nObjectsDeleted;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template<typename T>
+void Manager<T>::RecordObjectDeletions(const unsigned int nObjects)
+{
+    m_nObjectsDeleted += nObjects;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template<typename T>
+void Manager<T>::GetResourceReport(ObjectResourceReport &objectResourceReport) const
+{
+    objectResourceReport.m_nObjectsCreated = m_nObjectsCreated;
+    objectResourceReport.m_nObjectsDeleted = m_nObjectsDeleted;
+    objectResourceReport.m_peakNLiveObjects = m_peakNLiveObjects;
+    objectResourceReport.m_objectSize = sizeof(T);
+    objectResourceReport.m_nListEntries = 0;
+    objectResourceReport.m_listSizes.clear();
+
+    for (typename NameToListMap::const_iterator iter = m_nameToListMap.begin(), iterEnd = m_nameToListMap.end(); iter != iterEnd; ++iter)
+    {
+        objectResourceReport.m_listSizes[iter->first] = iter->second->size();
+        objectResourceReport.m_nListEntries += iter->second->size();
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 template<typename T>
 T *Manager<T>::Modifiable(const T *const pT) const
 {
@@ -8,18 +8,52 @@
 
 #include "Managers/Metadata.h"
 
+#include <algorithm>
+
 namespace pandora
 {
 
-CaloHitMetadata::CaloHitMetadata(CaloHitList *const pCaloHitList, const std::string &caloHitListName, const bool initialHitAvailability) :
-    m_pCaloHitList(pCaloHitList),
-    m_caloHitListName(caloHitListName)
+bool CaloHitBitSet::IsSubsetOf(const CaloHitBitSet &rhs) const
 {
-    for (CaloHitList::const_iterator hitIter = pCaloHitList->begin(), hitIterEnd = pCaloHitList->end(); hitIter != hitIterEnd; ++hitIter)
+    for (unsigned int wordIndex = 0, nWords = m_words.size(); wordIndex < nWords; ++wordIndex)
     {
-        if (!m_caloHitUsageMap.insert(CaloHitUsageMap::value_type(*hitIter, initialHitAvailability)).second)
-            throw StatusCodeException(STATUS_CODE_ALREADY_PRESENT);
+        const uint64_t rhsWord((wordIndex < rhs.m_words.size()) ? rhs.m_words[wordIndex] : 0);
+
+        if (0 != (m_words[wordIndex] & ~rhsWord))
+            return false;
     }
+
+    return true;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void CaloHitBitSet::Overwrite(const CaloHitBitSet &mask, const CaloHitBitSet &values)
+{
+    if (values.m_words.size() > m_words.size())
+        m_words.resize(values.m_words.size(), 0);
+
+    const unsigned int nMaskWords(std::min(mask.m_words.size(), m_words.size()));
+
+    for (unsigned int wordIndex = 0; wordIndex < nMaskWords; ++wordIndex)
+        m_words[wordIndex] &= ~mask.m_words[wordIndex];
+
+    for (unsigned int wordIndex = 0, nWords = values.m_words.size(); wordIndex < nWords; ++wordIndex)
+        m_words[wordIndex] |= values.m_words[wordIndex];
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+CaloHitMetadata::CaloHitMetadata(CaloHitList *const pCaloHitList, const std::string &caloHitListName, const CaloHitBitSet *const pInitialHitSet,
+    const bool initialHitAvailability) :
+    m_pCaloHitList(pCaloHitList),
+    m_caloHitListName(caloHitListName),
+    m_pSharedHitSet(pInitialHitSet),
+    m_pSharedAvailableHitSet(initialHitAvailability ? pInitialHitSet : NULL)
+{
+    if ((NULL == pCaloHitList) || (NULL == pInitialHitSet))
+        throw StatusCodeException(STATUS_CODE_INVALID_PARAMETER);
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -40,22 +74,17 @@ CaloHitMetadata::~CaloHitMetadata()
 template <>
 bool CaloHitMetadata::IsAvailable(const CaloHit *const pCaloHit) const
 {
-    CaloHitUsageMap::const_iterator usageMapIter = m_caloHitUsageMap.find(pCaloHit);
-
-    if ((m_caloHitUsageMap.end()) == usageMapIter || !usageMapIter->second)
-        return false;
-
-    return true;
+    return this->GetAvailableHitSet().Test(pCaloHit->GetCaloHitIndex());
 }
 
 template <>
 bool CaloHitMetadata::IsAvailable(const CaloHitList *const pCaloHitList) const
 {
+    const CaloHitBitSet &availableHitSet(this->GetAvailableHitSet());
+
     for (CaloHitList::const_iterator iter = pCaloHitList->begin(), iterEnd = pCaloHitList->end(); iter != iterEnd; ++iter)
     {
-        CaloHitUsageMap::const_iterator usageMapIter = m_caloHitUsageMap.find(*iter);
-
-        if ((m_caloHitUsageMap.end()) == usageMapIter || !usageMapIter->second)
+        if (!availableHitSet.Test((*iter)->GetCaloHitIndex()))
             return false;
     }
 
@@ -67,12 +96,13 @@ bool CaloHitMetadata::IsAvailable(const CaloHitList *const pCaloHitList) const
 template <>
 StatusCode CaloHitMetadata::SetAvailability(const CaloHit *const pCaloHit, bool isAvailable)
 {
-    CaloHitUsageMap::iterator usageMapIter = m_caloHitUsageMap.find(pCaloHit);
+    const unsigned int caloHitIndex(pCaloHit->GetCaloHitIndex());
 
-    if (m_caloHitUsageMap.end() == usageMapIter)
+    if (!this->GetHitSet().Test(caloHitIndex))
         return STATUS_CODE_NOT_FOUND;
 
-    usageMapIter->second = isAvailable;
+    if (this->GetAvailableHitSet().Test(caloHitIndex) != isAvailable)
+        this->GetModifiableAvailableHitSet().Set(caloHitIndex, isAvailable);
 
     return STATUS_CODE_SUCCESS;
 }
@@ -82,12 +112,7 @@ StatusCode CaloHitMetadata::SetAvailability(const CaloHitList *const pCaloHitLis
 {
     for (CaloHitList::const_iterator iter = pCaloHitList->begin(), iterEnd = pCaloHitList->end(); iter != iterEnd; ++iter)
     {
-        CaloHitUsageMap::iterator usageMapIter = m_caloHitUsageMap.find(*iter);
-
-        if (m_caloHitUsageMap.end() == usageMapIter)
-            return STATUS_CODE_NOT_FOUND;
-
-        usageMapIter->second = isAvailable;
+        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->SetAvailability(*iter, isAvailable));
     }
 
     return STATUS_CODE_SUCCESS;
@@ -104,17 +129,12 @@ StatusCode CaloHitMetadata::Update(const CaloHitMetadata &caloHitMetadata)
         PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->Update(*(*iter)));
     }
 
-    const CaloHitUsageMap &caloHitUsageMap(caloHitMetadata.GetCaloHitUsageMap());
+    const CaloHitBitSet &daughterHitSet(caloHitMetadata.GetHitSet());
 
-    for (CaloHitUsageMap::const_iterator iter = caloHitUsageMap.begin(), iterEnd = caloHitUsageMap.end(); iter != iterEnd; ++iter)
-    {
-        CaloHitUsageMap::iterator usageMapIter = m_caloHitUsageMap.find(iter->first);
-
-        if (m_caloHitUsageMap.end() == usageMapIter)
-            return STATUS_CODE_FAILURE;
+    if (!daughterHitSet.IsSubsetOf(this->GetHitSet()))
+        return STATUS_CODE_FAILURE;
 
-        usageMapIter->second = iter->second;
-    }
+    this->GetModifiableAvailableHitSet().Overwrite(daughterHitSet, caloHitMetadata.GetAvailableHitSet());
 
     return STATUS_CODE_SUCCESS;
 }
@@ -123,14 +143,17 @@ StatusCode CaloHitMetadata::Update(const CaloHitMetadata &caloHitMetadata)
 
 StatusCode CaloHitMetadata::Update(const CaloHitReplacement &caloHitReplacement)
 {
+    CaloHitBitSet &hitSet(this->GetModifiableHitSet());
+    CaloHitBitSet &availableHitSet(this->GetModifiableAvailableHitSet());
+
     for (CaloHitList::const_iterator iter = caloHitReplacement.m_newCaloHits.begin(), iterEnd = caloHitReplacement.m_newCaloHits.end();
         iter != iterEnd; ++iter)
     {
         if (!m_pCaloHitList->insert(*iter).second)
             return STATUS_CODE_ALREADY_PRESENT;
 
-        if (!m_caloHitUsageMap.insert(CaloHitUsageMap::value_type(*iter, true)).second)
-            return STATUS_CODE_ALREADY_PRESENT;
+        hitSet.Set((*iter)->GetCaloHitIndex(), true);
+        availableHitSet.Set((*iter)->GetCaloHitIndex(), true);
     }
 
     for (CaloHitList::const_iterator iter = caloHitReplacement.m_oldCaloHits.begin(), iterEnd = caloHitReplacement.m_oldCaloHits.end();
@@ -143,12 +166,8 @@ StatusCode CaloHitMetadata::Update(const CaloHitReplacement &caloHitReplacement)
 
         m_pCaloHitList->erase(listIter);
 
-        CaloHitUsageMap::iterator mapIter = m_caloHitUsageMap.find(*iter);
-
-        if (m_caloHitUsageMap.end() == mapIter)
-            return STATUS_CODE_FAILURE;
-
-        m_caloHitUsageMap.erase(mapIter);
+        hitSet.Set((*iter)->GetCaloHitIndex(), false);
+        availableHitSet.Set((*iter)->GetCaloHitIndex(), false);
     }
 
     m_caloHitReplacementList.push_back(new CaloHitReplacement(caloHitReplacement));
@@ -165,10 +184,39 @@ void CaloHitMetadata::Clear()
 
     m_pCaloHitList = NULL;
     m_caloHitListName.clear();
-    m_caloHitUsageMap.clear();
+    m_pSharedHitSet = NULL;
+    m_pSharedAvailableHitSet = NULL;
+    m_hitSet = CaloHitBitSet();
+    m_availableHitSet = CaloHitBitSet();
     m_caloHitReplacementList.clear();
 }
 
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+CaloHitBitSet &CaloHitMetadata::GetModifiableHitSet()
+{
+    if (NULL != m_pSharedHitSet)
+    {
+        m_hitSet = *m_pSharedHitSet;
+        m_pSharedHitSet = NULL;
+    }
+
+    return m_hitSet;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+CaloHitBitSet &CaloHitMetadata::GetModifiableAvailableHitSet()
+{
+    if (NULL != m_pSharedAvailableHitSet)
+    {
+        m_availableHitSet = *m_pSharedAvailableHitSet;
+        m_pSharedAvailableHitSet = NULL;
+    }
+
+    return m_availableHitSet;
+}
+
 //------------------------------------------------------------------------------------------------------------------------------------------
 //------------------------------------------------------------------------------------------------------------------------------------------
 
@@ -178,6 +226,14 @@ ReclusterMetadata::ReclusterMetadata(CaloHitList *const pCaloHitList) :
 {
     if (m_caloHitList.empty())
         throw StatusCodeException(STATUS_CODE_NOT_INITIALIZED);
+
+    for (CaloHitList::const_iterator iter = m_caloHitList.begin(), iterEnd = m_caloHitList.end(); iter != iterEnd; ++iter)
+    {
+        if (m_caloHitSet.Test((*iter)->GetCaloHitIndex()))
+            throw StatusCodeException(STATUS_CODE_ALREADY_PRESENT);
+
+        m_caloHitSet.Set((*iter)->GetCaloHitIndex(), true);
+    }
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -193,7 +249,10 @@ ReclusterMetadata::~ReclusterMetadata()
 StatusCode ReclusterMetadata::CreateCaloHitMetadata(CaloHitList *const pCaloHitList, const std::string &caloHitListName,
     const std::string &reclusterListName, const bool initialHitAvailability)
 {
-    m_pCurrentCaloHitMetadata = new CaloHitMetadata(pCaloHitList, caloHitListName, initialHitAvailability);
+    if (pCaloHitList->size() != m_caloHitList.size())
+        return STATUS_CODE_INVALID_PARAMETER;
+
+    m_pCurrentCaloHitMetadata = new CaloHitMetadata(pCaloHitList, caloHitListName, &m_caloHitSet, initialHitAvailability);
 
     if (!m_nameToMetadataMap.insert(NameToMetadataMap::value_type(reclusterListName, m_pCurrentCaloHitMetadata)).second)
     {
@@ -206,6 +265,23 @@ StatusCode ReclusterMetadata::CreateCaloHitMetadata(CaloHitList *const pCaloHitL
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+unsigned int ReclusterMetadata::GetNReplacementCaloHits() const
+{
+    unsigned int nReplacementCaloHits(0);
+
+    for (NameToMetadataMap::const_iterator iter = m_nameToMetadataMap.begin(), iterEnd = m_nameToMetadataMap.end(); iter != iterEnd; ++iter)
+    {
+        const CaloHitReplacementList &caloHitReplacementList(iter->second->GetCaloHitReplacementList());
+
+        for (CaloHitReplacementList::const_iterator rIter = caloHitReplacementList.begin(), rIterEnd = caloHitReplacementList.end(); rIter != rIterEnd; ++rIter)
+            nReplacementCaloHits += (*rIter)->m_newCaloHits.size();
+    }
+
+    return nReplacementCaloHits;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 StatusCode ReclusterMetadata::ExtractCaloHitMetadata(const std::string &reclusterListName, CaloHitMetadata *&pCaloHitMetaData)
 {
     NameToMetadataMap::iterator iter = m_nameToMetadataMap.find(reclusterListName);
@@ -40,9 +40,9 @@ StatusCode ParticleFlowObjectManager::Create(const PandoraContentApi::ParticleFl
         if (!m_canMakeNewObjects)
             throw StatusCodeException(STATUS_CODE_NOT_ALLOWED);
 
-        NameToListMap::iterator iter = m_nameToListMap.find(m_currentListName);
+        PfoList *const pCurrentList(m_handleToListVector[m_currentListHandle]);
 
-        if (m_nameToListMap.end() == iter)
+        if (NULL == pCurrentList)
              throw StatusCodeException(STATUS_CODE_NOT_INITIALIZED);
 
         PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, factory.Create(parameters, pPfo));
@@ -50,9 +50,11 @@ StatusCode ParticleFlowObjectManager::Create(const PandoraContentApi::ParticleFl
         if (NULL == pPfo)
              throw StatusCodeException(STATUS_CODE_FAILURE);
 
-        if (!iter->second->insert(pPfo).second)
+        if (!pCurrentList->insert(pPfo).second)
              throw StatusCodeException(STATUS_CODE_FAILURE);
 
+        this->RecordObjectCreation();
+
         return STATUS_CODE_SUCCESS;
     }
     catch (StatusCodeException &statusCodeException)
@@ -110,6 +112,67 @@ StatusCode ParticleFlowObjectManager::RemoveParentDaughterAssociation(const Part
     return STATUS_CODE_SUCCESS;
 }
 
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode ParticleFlowObjectManager::AdoptObjects(const std::string &listName, const PfoList &pfoList)
+{
+    PfoList *pTargetList(NULL);
+
+    if (m_nameToListMap.end() == m_nameToListMap.find(listName))
+    {
+        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->CreateList(listName, pTargetList));
+        m_savedLists.insert(listName);
+    }
+    else
+    {
+        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->GetModifiableList(listName, pTargetList));
+    }
+
+    for (PfoList::const_iterator iter = pfoList.begin(), iterEnd = pfoList.end(); iter != iterEnd; ++iter)
+    {
+        if (!pTargetList->insert(*iter).second)
+            return STATUS_CODE_ALREADY_PRESENT;
+
+        this->RecordObjectCreation();
+    }
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode ParticleFlowObjectManager::ReleaseObjects(const PfoList &pfoList)
+{
+    for (PfoList::const_iterator iter = pfoList.begin(), iterEnd = pfoList.end(); iter != iterEnd; ++iter)
+    {
+        const ParticleFlowObject *const pPfo(*iter);
+        const PfoList parentPfoList(pPfo->GetParentPfoList());
+        const PfoList daughterPfoList(pPfo->GetDaughterPfoList());
+
+        for (PfoList::const_iterator parentIter = parentPfoList.begin(), parentIterEnd = parentPfoList.end(); parentIter != parentIterEnd; ++parentIter)
+        {
+            if (pfoList.end() == pfoList.find(*parentIter))
+                PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->RemoveParentDaughterAssociation(*parentIter, pPfo));
+        }
+
+        for (PfoList::const_iterator daughterIter = daughterPfoList.begin(), daughterIterEnd = daughterPfoList.end(); daughterIter != daughterIterEnd; ++daughterIter)
+        {
+            if (pfoList.end() == pfoList.find(*daughterIter))
+                PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->RemoveParentDaughterAssociation(pPfo, *daughterIter));
+        }
+    }
+
+    // Lists sharing their contents appear more than once in the map, for which the repeated erase has no effect
+    for (NameToListMap::const_iterator listIter = m_nameToListMap.begin(), listIterEnd = m_nameToListMap.end(); listIter != listIterEnd; ++listIter)
+    {
+        for (PfoList::const_iterator iter = pfoList.begin(), iterEnd = pfoList.end(); iter != iterEnd; ++iter)
+            (void) listIter->second->erase(*iter);
+    }
+
+    this->RecordObjectDeletions(pfoList.size());
+    return STATUS_CODE_SUCCESS;
+}
+
 //------------------------------------------------------------------------------------------------------------------------------------------
 //------------------------------------------------------------------------------------------------------------------------------------------
 
@@ -14,6 +14,7 @@
 #include "Plugins/EnergyCorrectionsPlugin.h"
 #include "Plugins/ParticleIdPlugin.h"
 #include "Plugins/PseudoLayerPlugin.h"
+#include "Plugins/RegionPartitionPlugin.h"
 #include "Plugins/ShowerProfilePlugin.h"
 
 namespace pandora
@@ -23,6 +24,7 @@ PluginManager::PluginManager(const Pandora *const pPandora) :
     m_pBFieldPlugin(NULL),
     m_pPseudoLayerPlugin(NULL),
     m_pShowerProfilePlugin(NULL),
+    m_pRegionPartitionPlugin(NULL),
     m_pEnergyCorrections(NULL),
     m_pParticleId(NULL),
     m_pPandora(pPandora)
@@ -53,6 +55,7 @@ PluginManager::~PluginManager()
     delete m_pBFieldPlugin;
     delete m_pPseudoLayerPlugin;
     delete m_pShowerProfilePlugin;
+    delete m_pRegionPartitionPlugin;
 
     delete m_pEnergyCorrections;
     delete m_pParticleId;
@@ -90,6 +93,16 @@ const ShowerProfilePlugin *PluginManager::GetShowerProfilePlugin() const
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+const RegionPartitionPlugin *PluginManager::GetRegionPartitionPlugin() const
+{
+    if (NULL == m_pRegionPartitionPlugin)
+        throw StatusCodeException(STATUS_CODE_NOT_INITIALIZED);
+
+    return m_pRegionPartitionPlugin;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 const EnergyCorrections *PluginManager::GetEnergyCorrections() const
 {
     if (NULL == m_pEnergyCorrections)
@@ -143,6 +156,17 @@ StatusCode PluginManager::SetShowerProfilePlugin(ShowerProfilePlugin *const pSho
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+StatusCode PluginManager::SetRegionPartitionPlugin(RegionPartitionPlugin *const pRegionPartitionPlugin)
+{
+    if (NULL != m_pRegionPartitionPlugin)
+        return STATUS_CODE_ALREADY_INITIALIZED;
+
+    m_pRegionPartitionPlugin = pRegionPartitionPlugin;
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 StatusCode PluginManager::InitializePlugins(const TiXmlHandle *const pXmlHandle)
 {
     if (NULL != m_pBFieldPlugin)
@@ -178,6 +202,17 @@ StatusCode PluginManager::InitializePlugins(const TiXmlHandle *const pXmlHandle)
         PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, m_pShowerProfilePlugin->Initialize());
     }
 
+    if (NULL != m_pRegionPartitionPlugin)
+    {
+        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, m_pRegionPartitionPlugin->RegisterDetails(m_pPandora, "RegionPartitionPlugin"));
+        TiXmlElement *const pRegionPartitionXmlElement(pXmlHandle->FirstChild("RegionPartitionPlugin").Element());
+
+        if (NULL != pRegionPartitionXmlElement)
+            PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, m_pRegionPartitionPlugin->ReadSettings(TiXmlHandle(pRegionPartitionXmlElement)));
+
+        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, m_pRegionPartitionPlugin->Initialize());
+    }
+
     PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, m_pEnergyCorrections->InitializePlugins(pXmlHandle));
     PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, m_pParticleId->InitializePlugins(pXmlHandle));
 
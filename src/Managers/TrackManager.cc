@@ -39,16 +39,20 @@ StatusCode TrackManager::Create(const PandoraApi::Track::Parameters &parameters,
     {
         PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, factory.Create(parameters, pTrack));
 
-        NameToListMap::iterator inputIter = m_nameToListMap.find(INPUT_LIST_NAME);
+        TrackList *pInputList(NULL);
 
-        if ((NULL == pTrack) || (m_nameToListMap.end() == inputIter) || (inputIter->second->end() != inputIter->second->find(pTrack)))
+        if ((NULL == pTrack) || (STATUS_CODE_SUCCESS != this->GetModifiableList(INPUT_LIST_NAME, pInputList)) ||
+            (pInputList->end() != pInputList->find(pTrack)))
+        {
             throw StatusCodeException(STATUS_CODE_FAILURE);
+        }
 
         if (m_uidToTrackMap.end() != m_uidToTrackMap.find(pTrack->GetParentTrackAddress()))
             throw StatusCodeException(STATUS_CODE_ALREADY_PRESENT);
 
-        (void) inputIter->second->insert(pTrack);
+        (void) pInputList->insert(pTrack);
         (void) m_uidToTrackMap.insert(UidToTrackMap::value_type(pTrack->GetParentTrackAddress(), pTrack));
+        this->RecordObjectCreation();
 
         return STATUS_CODE_SUCCESS;
     }
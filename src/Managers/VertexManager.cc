@@ -40,9 +40,9 @@ StatusCode VertexManager::Create(const PandoraContentApi::Vertex::Parameters &pa
         if (!m_canMakeNewObjects)
             throw StatusCodeException(STATUS_CODE_NOT_ALLOWED);
 
-        NameToListMap::iterator iter = m_nameToListMap.find(m_currentListName);
+        VertexList *const pCurrentList(m_handleToListVector[m_currentListHandle]);
 
-        if (m_nameToListMap.end() == iter)
+        if (NULL == pCurrentList)
              throw StatusCodeException(STATUS_CODE_NOT_INITIALIZED);
 
         PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, factory.Create(parameters, pVertex));
@@ -50,9 +50,11 @@ StatusCode VertexManager::Create(const PandoraContentApi::Vertex::Parameters &pa
         if (NULL == pVertex)
              throw StatusCodeException(STATUS_CODE_FAILURE);
 
-        if (!iter->second->insert(pVertex).second)
+        if (!pCurrentList->insert(pVertex).second)
              throw StatusCodeException(STATUS_CODE_FAILURE);
 
+        this->RecordObjectCreation();
+
         return STATUS_CODE_SUCCESS;
     }
     catch (StatusCodeException &statusCodeException)
@@ -14,31 +14,40 @@
 namespace pandora
 {
 
+const MCParticleWeightMap CaloHit::m_emptyMCParticleWeightMap;
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 CaloHit::CaloHit(const PandoraApi::CaloHit::Parameters &parameters) :
     m_positionVector(parameters.m_positionVector.Get()),
+    m_inputEnergy(parameters.m_inputEnergy.Get()),
+    m_mipEquivalentEnergy(parameters.m_mipEquivalentEnergy.Get()),
+    m_electromagneticEnergy(parameters.m_electromagneticEnergy.Get()),
+    m_hadronicEnergy(parameters.m_hadronicEnergy.Get()),
+    m_weight(1.f),
+    m_pseudoLayer(0),
+    m_layer(parameters.m_layer.Get()),
+    m_hitType(parameters.m_hitType.Get()),
+    m_hitRegion(parameters.m_hitRegion.Get()),
+    m_caloHitIndex(0),
+    m_isAvailable(true),
+    m_isPossibleMip(false),
+    m_isIsolated(false),
+    m_isPseudoLayerSet(false),
+    m_pMainMCParticle(NULL),
     m_expectedDirection(parameters.m_expectedDirection.Get().GetUnitVector()),
     m_cellNormalVector(parameters.m_cellNormalVector.Get().GetUnitVector()),
     m_cellGeometry(parameters.m_cellGeometry.Get()),
     m_cellSize0(parameters.m_cellSize0.Get()),
     m_cellSize1(parameters.m_cellSize1.Get()),
     m_cellThickness(parameters.m_cellThickness.Get()),
+    m_cellLengthScale(0.f),
     m_nCellRadiationLengths(parameters.m_nCellRadiationLengths.Get()),
     m_nCellInteractionLengths(parameters.m_nCellInteractionLengths.Get()),
     m_time(parameters.m_time.Get()),
-    m_inputEnergy(parameters.m_inputEnergy.Get()),
-    m_mipEquivalentEnergy(parameters.m_mipEquivalentEnergy.Get()),
-    m_electromagneticEnergy(parameters.m_electromagneticEnergy.Get()),
-    m_hadronicEnergy(parameters.m_hadronicEnergy.Get()),
     m_isDigital(parameters.m_isDigital.Get()),
-    m_hitType(parameters.m_hitType.Get()),
-    m_hitRegion(parameters.m_hitRegion.Get()),
-    m_layer(parameters.m_layer.Get()),
     m_isInOuterSamplingLayer(parameters.m_isInOuterSamplingLayer.Get()),
-    m_cellLengthScale(0.f),
-    m_isPossibleMip(false),
-    m_isIsolated(false),
-    m_isAvailable(true),
-    m_weight(1.f),
+    m_pMCParticleWeightMap(NULL),
     m_pParentAddress(parameters.m_pParentAddress.Get())
 {
     m_cellLengthScale = this->CalculateCellLengthScale();
@@ -48,34 +57,42 @@ CaloHit::CaloHit(const PandoraApi::CaloHit::Parameters &parameters) :
 
 CaloHit::CaloHit(const PandoraContentApi::CaloHitFragment::Parameters &parameters) :
     m_positionVector(parameters.m_pOriginalCaloHit->m_positionVector),
+    m_inputEnergy(parameters.m_weight.Get() * parameters.m_pOriginalCaloHit->m_inputEnergy),
+    m_mipEquivalentEnergy(parameters.m_weight.Get() * parameters.m_pOriginalCaloHit->m_mipEquivalentEnergy),
+    m_electromagneticEnergy(parameters.m_weight.Get() * parameters.m_pOriginalCaloHit->m_electromagneticEnergy),
+    m_hadronicEnergy(parameters.m_weight.Get() * parameters.m_pOriginalCaloHit->m_hadronicEnergy),
+    m_weight(parameters.m_weight.Get() * parameters.m_pOriginalCaloHit->m_weight),
+    m_pseudoLayer(parameters.m_pOriginalCaloHit->m_pseudoLayer),
+    m_layer(parameters.m_pOriginalCaloHit->m_layer),
+    m_hitType(parameters.m_pOriginalCaloHit->m_hitType),
+    m_hitRegion(parameters.m_pOriginalCaloHit->m_hitRegion),
+    m_caloHitIndex(0),
+    m_isAvailable(parameters.m_pOriginalCaloHit->m_isAvailable),
+    m_isPossibleMip(parameters.m_pOriginalCaloHit->m_isPossibleMip),
+    m_isIsolated(parameters.m_pOriginalCaloHit->m_isIsolated),
+    m_isPseudoLayerSet(parameters.m_pOriginalCaloHit->m_isPseudoLayerSet),
+    m_pMainMCParticle(parameters.m_pOriginalCaloHit->m_pMainMCParticle),
     m_expectedDirection(parameters.m_pOriginalCaloHit->m_expectedDirection),
     m_cellNormalVector(parameters.m_pOriginalCaloHit->m_cellNormalVector),
     m_cellGeometry(parameters.m_pOriginalCaloHit->m_cellGeometry),
     m_cellSize0(parameters.m_pOriginalCaloHit->m_cellSize0),
     m_cellSize1(parameters.m_pOriginalCaloHit->m_cellSize1),
     m_cellThickness(parameters.m_pOriginalCaloHit->m_cellThickness),
+    m_cellLengthScale(parameters.m_pOriginalCaloHit->m_cellLengthScale),
     m_nCellRadiationLengths(parameters.m_pOriginalCaloHit->m_nCellRadiationLengths),
     m_nCellInteractionLengths(parameters.m_pOriginalCaloHit->m_nCellInteractionLengths),
     m_time(parameters.m_pOriginalCaloHit->m_time),
-    m_inputEnergy(parameters.m_weight.Get() * parameters.m_pOriginalCaloHit->m_inputEnergy),
-    m_mipEquivalentEnergy(parameters.m_weight.Get() * parameters.m_pOriginalCaloHit->m_mipEquivalentEnergy),
-    m_electromagneticEnergy(parameters.m_weight.Get() * parameters.m_pOriginalCaloHit->m_electromagneticEnergy),
-    m_hadronicEnergy(parameters.m_weight.Get() * parameters.m_pOriginalCaloHit->m_hadronicEnergy),
     m_isDigital(parameters.m_pOriginalCaloHit->m_isDigital),
-    m_hitType(parameters.m_pOriginalCaloHit->m_hitType),
-    m_hitRegion(parameters.m_pOriginalCaloHit->m_hitRegion),
-    m_layer(parameters.m_pOriginalCaloHit->m_layer),
-    m_pseudoLayer(parameters.m_pOriginalCaloHit->m_pseudoLayer),
     m_isInOuterSamplingLayer(parameters.m_pOriginalCaloHit->m_isInOuterSamplingLayer),
-    m_cellLengthScale(parameters.m_pOriginalCaloHit->m_cellLengthScale),
-    m_isPossibleMip(parameters.m_pOriginalCaloHit->m_isPossibleMip),
-    m_isIsolated(parameters.m_pOriginalCaloHit->m_isIsolated),
-    m_isAvailable(parameters.m_pOriginalCaloHit->m_isAvailable),
-    m_weight(parameters.m_weight.Get() * parameters.m_pOriginalCaloHit->m_weight),
-    m_mcParticleWeightMap(parameters.m_pOriginalCaloHit->m_mcParticleWeightMap),
+    m_pMCParticleWeightMap(NULL),
     m_pParentAddress(parameters.m_pOriginalCaloHit->m_pParentAddress)
 {
-    for (MCParticleWeightMap::iterator iter = m_mcParticleWeightMap.begin(), iterEnd = m_mcParticleWeightMap.end(); iter != iterEnd; ++iter)
+    if (NULL == parameters.m_pOriginalCaloHit->m_pMCParticleWeightMap)
+        return;
+
+    m_pMCParticleWeightMap = new MCParticleWeightMap(*(parameters.m_pOriginalCaloHit->m_pMCParticleWeightMap));
+
+    for (MCParticleWeightMap::iterator iter = m_pMCParticleWeightMap->begin(), iterEnd = m_pMCParticleWeightMap->end(); iter != iterEnd; ++iter)
         iter->second = iter->second * parameters.m_weight.Get();
 }
 
@@ -83,14 +100,25 @@ CaloHit::CaloHit(const PandoraContentApi::CaloHitFragment::Parameters &parameter
 
 CaloHit::~CaloHit()
 {
+    delete m_pMCParticleWeightMap;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+const MCParticle *CaloHit::GetMainMCParticle() const
+{
+    if (NULL == m_pMainMCParticle)
+        throw StatusCodeException(STATUS_CODE_NOT_INITIALIZED);
+
+    return m_pMainMCParticle;
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 StatusCode CaloHit::SetPseudoLayer(const unsigned int pseudoLayer)
 {
-    if (!(m_pseudoLayer = pseudoLayer))
-        return STATUS_CODE_NOT_INITIALIZED;
+    m_pseudoLayer = pseudoLayer;
+    m_isPseudoLayerSet = true;
 
     return STATUS_CODE_SUCCESS;
 }
@@ -112,14 +140,41 @@ StatusCode CaloHit::AlterMetadata(const PandoraContentApi::CaloHit::Metadata &me
 
 void CaloHit::SetMCParticleWeightMap(const MCParticleWeightMap &mcParticleWeightMap)
 {
-    m_mcParticleWeightMap = mcParticleWeightMap;
+    if (mcParticleWeightMap.empty())
+    {
+        this->RemoveMCParticles();
+        return;
+    }
+
+    if (NULL == m_pMCParticleWeightMap)
+    {
+        m_pMCParticleWeightMap = new MCParticleWeightMap(mcParticleWeightMap);
+    }
+    else
+    {
+        *m_pMCParticleWeightMap = mcParticleWeightMap;
+    }
+
+    float bestWeight(0.f);
+    m_pMainMCParticle = NULL;
+
+    for (MCParticleWeightMap::const_iterator iter = m_pMCParticleWeightMap->begin(), iterEnd = m_pMCParticleWeightMap->end(); iter != iterEnd; ++iter)
+    {
+        if (iter->second > bestWeight)
+        {
+            bestWeight = iter->second;
+            m_pMainMCParticle = iter->first;
+        }
+    }
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 void CaloHit::RemoveMCParticles()
 {
-    m_mcParticleWeightMap.clear();
+    delete m_pMCParticleWeightMap;
+    m_pMCParticleWeightMap = NULL;
+    m_pMainMCParticle = NULL;
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
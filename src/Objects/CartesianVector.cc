@@ -14,29 +14,6 @@
 namespace pandora
 {
 
-float CartesianVector::GetCosOpeningAngle(const CartesianVector &rhs) const
-{
-    const float magnitudesSquared(this->GetMagnitudeSquared() * rhs.GetMagnitudeSquared());
-
-    if (magnitudesSquared < std::numeric_limits<float>::epsilon())
-        throw StatusCodeException(STATUS_CODE_NOT_INITIALIZED);
-
-    float cosTheta = this->GetDotProduct(rhs) / std::sqrt(magnitudesSquared);
-
-    if (cosTheta > 1.f)
-    {
-        cosTheta = 1.f;
-    }
-    else if (cosTheta < -1.f)
-    {
-        cosTheta = -1.f;
-    }
-
-    return cosTheta;
-}
-
-//------------------------------------------------------------------------------------------------------------------------------------------
-
 void CartesianVector::GetSphericalCoordinates(float &radius, float &phi, float &theta) const
 {
     const float magnitude(this->GetMagnitude());
@@ -63,18 +40,6 @@ void CartesianVector::GetCylindricalCoordinates(float &radius, float &phi, float
     z      = m_z;
 }
 
-//------------------------------------------------------------------------------------------------------------------------------------------
-
-CartesianVector CartesianVector::GetUnitVector() const
-{
-    const float magnitude(this->GetMagnitude());
-
-    if (std::fabs(magnitude) < std::numeric_limits<float>::epsilon())
-        throw StatusCodeException(STATUS_CODE_INVALID_PARAMETER);
-
-    return CartesianVector(m_x / magnitude, m_y / magnitude, m_z / magnitude);
-}
-
 //------------------------------------------------------------------------------------------------------------------------------------------
 //------------------------------------------------------------------------------------------------------------------------------------------
 
@@ -0,0 +1,197 @@
+/**
+ *  @file   PandoraSDK/src/Objects/CartesianVectorBatch.cc
+ *
+ *  @brief  Implementation of the cartesian vector batch class.
+ *
+ *  $Log: $
+ */
+
+#include "Objects/CartesianVectorBatch.h"
+
+#include <limits>
+
+namespace pandora
+{
+
+const unsigned int CartesianVectorBatch::BLOCK_SIZE = 8;
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+CartesianVectorBatch::CartesianVectorBatch(const CartesianPointList &pointList)
+{
+    this->Reserve(pointList.size());
+
+    for (CartesianPointList::const_iterator iter = pointList.begin(), iterEnd = pointList.end(); iter != iterEnd; ++iter)
+        this->Add(*iter);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void CartesianVectorBatch::Reserve(const unsigned int nVectors)
+{
+    m_x.reserve(nVectors);
+    m_y.reserve(nVectors);
+    m_z.reserve(nVectors);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void CartesianVectorBatch::GetDotProducts(const CartesianVector &reference, FloatVector &dotProducts) const
+{
+    const unsigned int nVectors(this->GetSize());
+    dotProducts.resize(nVectors);
+
+    if (0 == nVectors)
+        return;
+
+    const float refX(reference.GetX()), refY(reference.GetY()), refZ(reference.GetZ());
+    const float *const pX(&m_x[0]), *const pY(&m_y[0]), *const pZ(&m_z[0]);
+    float *const pOutput(&dotProducts[0]);
+
+    unsigned int i(0);
+
+    for (; i + BLOCK_SIZE <= nVectors; i += BLOCK_SIZE)
+    {
+        float block[BLOCK_SIZE];
+
+        for (unsigned int j = 0; j < BLOCK_SIZE; ++j)
+            block[j] = (pX[i + j] * refX) + (pY[i + j] * refY) + (pZ[i + j] * refZ);
+
+        for (unsigned int j = 0; j < BLOCK_SIZE; ++j)
+            pOutput[i + j] = block[j];
+    }
+
+    for (; i < nVectors; ++i)
+        pOutput[i] = (pX[i] * refX) + (pY[i] * refY) + (pZ[i] * refZ);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void CartesianVectorBatch::GetDistancesSquared(const CartesianVector &point, FloatVector &distancesSquared) const
+{
+    const unsigned int nVectors(this->GetSize());
+    distancesSquared.resize(nVectors);
+
+    if (0 == nVectors)
+        return;
+
+    const float pointX(point.GetX()), pointY(point.GetY()), pointZ(point.GetZ());
+    const float *const pX(&m_x[0]), *const pY(&m_y[0]), *const pZ(&m_z[0]);
+    float *const pOutput(&distancesSquared[0]);
+
+    unsigned int i(0);
+
+    for (; i + BLOCK_SIZE <= nVectors; i += BLOCK_SIZE)
+    {
+        float block[BLOCK_SIZE];
+
+        for (unsigned int j = 0; j < BLOCK_SIZE; ++j)
+        {
+            const float dX(pX[i + j] - pointX), dY(pY[i + j] - pointY), dZ(pZ[i + j] - pointZ);
+            block[j] = (dX * dX) + (dY * dY) + (dZ * dZ);
+        }
+
+        for (unsigned int j = 0; j < BLOCK_SIZE; ++j)
+            pOutput[i + j] = block[j];
+    }
+
+    for (; i < nVectors; ++i)
+    {
+        const float dX(pX[i] - pointX), dY(pY[i] - pointY), dZ(pZ[i] - pointZ);
+        pOutput[i] = (dX * dX) + (dY * dY) + (dZ * dZ);
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void CartesianVectorBatch::GetDistancesSquaredToLine(const CartesianVector &linePoint, const CartesianVector &lineDirection,
+    FloatVector &distancesSquared) const
+{
+    const unsigned int nVectors(this->GetSize());
+    distancesSquared.resize(nVectors);
+
+    if (0 == nVectors)
+        return;
+
+    const float pointX(linePoint.GetX()), pointY(linePoint.GetY()), pointZ(linePoint.GetZ());
+    const float dirX(lineDirection.GetX()), dirY(lineDirection.GetY()), dirZ(lineDirection.GetZ());
+    const float *const pX(&m_x[0]), *const pY(&m_y[0]), *const pZ(&m_z[0]);
+    float *const pOutput(&distancesSquared[0]);
+
+    unsigned int i(0);
+
+    for (; i + BLOCK_SIZE <= nVectors; i += BLOCK_SIZE)
+    {
+        float block[BLOCK_SIZE];
+
+        for (unsigned int j = 0; j < BLOCK_SIZE; ++j)
+        {
+            const float dX(pX[i + j] - pointX), dY(pY[i + j] - pointY), dZ(pZ[i + j] - pointZ);
+            const float crossX((dirY * dZ) - (dY * dirZ)), crossY((dirZ * dX) - (dZ * dirX)), crossZ((dirX * dY) - (dX * dirY));
+            block[j] = (crossX * crossX) + (crossY * crossY) + (crossZ * crossZ);
+        }
+
+        for (unsigned int j = 0; j < BLOCK_SIZE; ++j)
+            pOutput[i + j] = block[j];
+    }
+
+    for (; i < nVectors; ++i)
+    {
+        const float dX(pX[i] - pointX), dY(pY[i] - pointY), dZ(pZ[i] - pointZ);
+        const float crossX((dirY * dZ) - (dY * dirZ)), crossY((dirZ * dX) - (dZ * dirX)), crossZ((dirX * dY) - (dX * dirY));
+        pOutput[i] = (crossX * crossX) + (crossY * crossY) + (crossZ * crossZ);
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void CartesianVectorBatch::GetCosOpeningAngles(const CartesianVector &reference, FloatVector &cosOpeningAngles) const
+{
+    const unsigned int nVectors(this->GetSize());
+    cosOpeningAngles.resize(nVectors);
+
+    if (0 == nVectors)
+        return;
+
+    const float refX(reference.GetX()), refY(reference.GetY()), refZ(reference.GetZ());
+    const float refMagnitudeSquared(reference.GetMagnitudeSquared());
+    const float *const pX(&m_x[0]), *const pY(&m_y[0]), *const pZ(&m_z[0]);
+    float *const pOutput(&cosOpeningAngles[0]);
+
+    unsigned int i(0);
+
+    for (; i + BLOCK_SIZE <= nVectors; i += BLOCK_SIZE)
+    {
+        float magnitudesSquared[BLOCK_SIZE], dotProducts[BLOCK_SIZE];
+
+        for (unsigned int j = 0; j < BLOCK_SIZE; ++j)
+        {
+            magnitudesSquared[j] = ((pX[i + j] * pX[i + j]) + (pY[i + j] * pY[i + j]) + (pZ[i + j] * pZ[i + j])) * refMagnitudeSquared;
+            dotProducts[j] = (pX[i + j] * refX) + (pY[i + j] * refY) + (pZ[i + j] * refZ);
+        }
+
+        for (unsigned int j = 0; j < BLOCK_SIZE; ++j)
+            pOutput[i + j] = CartesianVectorBatch::GetCosOpeningAngle(dotProducts[j], magnitudesSquared[j]);
+    }
+
+    for (; i < nVectors; ++i)
+    {
+        const float magnitudesSquared(((pX[i] * pX[i]) + (pY[i] * pY[i]) + (pZ[i] * pZ[i])) * refMagnitudeSquared);
+        const float dotProduct((pX[i] * refX) + (pY[i] * refY) + (pZ[i] * refZ));
+        pOutput[i] = CartesianVectorBatch::GetCosOpeningAngle(dotProduct, magnitudesSquared);
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+float CartesianVectorBatch::GetCosOpeningAngle(const float dotProduct, const float magnitudesSquared)
+{
+    if (magnitudesSquared < std::numeric_limits<float>::epsilon())
+        throw StatusCodeException(STATUS_CODE_NOT_INITIALIZED);
+
+    const float cosTheta(dotProduct / std::sqrt(magnitudesSquared));
+
+    return ((cosTheta > 1.f) ? 1.f : (cosTheta < -1.f) ? -1.f : cosTheta);
+}
+
+} // namespace pandora
@@ -14,14 +14,94 @@
 
 #include "Pandora/Pandora.h"
 #include "Pandora/PdgTable.h"
+#include "Pandora/ThreadPool.h"
 
 #include "Plugins/EnergyCorrectionsPlugin.h"
 #include "Plugins/ParticleIdPlugin.h"
 #include "Plugins/ShowerProfilePlugin.h"
 
+#include <algorithm>
+
+#if __cplusplus > 199711L
+    #include <thread>
+#endif
+
 namespace pandora
 {
 
+const unsigned int Cluster::INITIAL_DIRECTION = 1 << 0;
+const unsigned int Cluster::FIT_TO_ALL_HITS = 1 << 1;
+const unsigned int Cluster::ENERGY_CORRECTIONS = 1 << 2;
+const unsigned int Cluster::FAST_PHOTON_FLAG = 1 << 3;
+const unsigned int Cluster::SHOWER_START_LAYER = 1 << 4;
+const unsigned int Cluster::SHOWER_PROFILE = 1 << 5;
+const unsigned int Cluster::INNER_LAYER_HIT_TYPE = 1 << 6;
+const unsigned int Cluster::OUTER_LAYER_HIT_TYPE = 1 << 7;
+const unsigned int Cluster::ALL_LAZY_PROPERTIES = (1 << 8) - 1;
+const unsigned int Cluster::LAZY_PROPERTY_CLAIM_SHIFT = 16;
+const unsigned int Cluster::CHUNKS_PER_THREAD = 4;
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+/**
+ *  @brief  PropertyCalculationTask class, calculating cluster properties for one of a number of equal chunks of a cluster vector
+ */
+class Cluster::PropertyCalculationTask : public ThreadPool::Task
+{
+public:
+    /**
+     *  @brief  Constructor
+     * 
+     *  @param  pandora the associated pandora instance
+     *  @param  clusterVector the vector of clusters
+     *  @param  clusterProperties the cluster properties to prepare
+     *  @param  nChunks the number of chunks into which to divide the cluster vector
+     */
+    PropertyCalculationTask(const Pandora &pandora, const ClusterVector &clusterVector, const unsigned int clusterProperties,
+        const unsigned int nChunks);
+
+    StatusCode Run(const unsigned int index) const;
+
+private:
+    const Pandora          &m_pandora;              ///< The associated pandora instance
+    const ClusterVector    &m_clusterVector;        ///< The vector of clusters
+    const unsigned int      m_clusterProperties;    ///< The cluster properties to prepare
+    const unsigned int      m_nChunks;              ///< The number of chunks into which to divide the cluster vector
+};
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+Cluster::PropertyCalculationTask::PropertyCalculationTask(const Pandora &pandora, const ClusterVector &clusterVector,
+        const unsigned int clusterProperties, const unsigned int nChunks) :
+    m_pandora(pandora),
+    m_clusterVector(clusterVector),
+    m_clusterProperties(clusterProperties),
+    m_nChunks(nChunks)
+{
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode Cluster::PropertyCalculationTask::Run(const unsigned int index) const
+{
+    if (1 == m_nChunks)
+    {
+        Cluster::CalculateProperties(m_pandora, m_clusterVector, m_clusterProperties);
+        return STATUS_CODE_SUCCESS;
+    }
+
+    const unsigned int nClusters(m_clusterVector.size());
+    const unsigned int beginIndex((nClusters * index) / m_nChunks), endIndex((nClusters * (index + 1)) / m_nChunks);
+
+    const ClusterVector chunkClusterVector(m_clusterVector.begin() + beginIndex, m_clusterVector.begin() + endIndex);
+    Cluster::CalculateProperties(m_pandora, chunkClusterVector, m_clusterProperties);
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 Cluster::Cluster(const PandoraContentApi::Cluster::Parameters &parameters) :
     m_nCaloHits(0),
     m_nPossibleMipHits(0),
@@ -32,9 +112,8 @@ Cluster::Cluster(const PandoraContentApi::Cluster::Parameters &parameters) :
     m_isolatedHadronicEnergy(0),
     m_particleId(UNKNOWN_PARTICLE_TYPE),
     m_pTrackSeed(parameters.m_pTrack.IsInitialized() ? parameters.m_pTrack.Get() : NULL),
+    m_lazyPropertyFlags(0),
     m_initialDirection(0.f, 0.f, 0.f),
-    m_isDirectionUpToDate(false),
-    m_isFitUpToDate(false),
     m_isAvailable(true)
 {
     if (parameters.m_caloHitList.empty() && parameters.m_isolatedCaloHitList.empty() && !parameters.m_pTrack.IsInitialized())
@@ -43,7 +122,9 @@ Cluster::Cluster(const PandoraContentApi::Cluster::Parameters &parameters) :
     if (parameters.m_pTrack.IsInitialized())
     {
         m_initialDirection = parameters.m_pTrack.Get()->GetTrackStateAtCalorimeter().GetMomentum().GetUnitVector();
-        m_isDirectionUpToDate = true;
+
+        if (this->ClaimLazyProperty(INITIAL_DIRECTION))
+            this->PublishLazyProperty(INITIAL_DIRECTION);
     }
 
     for (CaloHitList::const_iterator iter = parameters.m_caloHitList.begin(), iterEnd = parameters.m_caloHitList.end(); iter != iterEnd; ++iter)
@@ -63,6 +144,7 @@ StatusCode Cluster::AlterMetadata(const PandoraContentApi::Cluster::Metadata &me
 {
     if (metadata.m_particleId.IsInitialized())
     {
+        this->ResetLazyProperties(FAST_PHOTON_FLAG);
         m_isPhotonFast.Reset();
         m_particleId = metadata.m_particleId.Get();
     }
@@ -119,6 +201,8 @@ StatusCode Cluster::AddCaloHit(const CaloHit *const pCaloHit)
     if (!m_outerPseudoLayer.IsInitialized() || (pseudoLayer > m_outerPseudoLayer.Get()))
         m_outerPseudoLayer = pseudoLayer;
 
+    this->AddMCParticleWeights(pCaloHit);
+
     return STATUS_CODE_SUCCESS;
 }
 
@@ -169,14 +253,14 @@ StatusCode Cluster::RemoveCaloHit(const CaloHit *const pCaloHit)
     if (pseudoLayer >= m_outerPseudoLayer.Get())
         m_outerPseudoLayer = m_orderedCaloHitList.rbegin()->first;
 
-    return STATUS_CODE_SUCCESS;
+    return this->RemoveMCParticleWeights(pCaloHit);
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 StatusCode Cluster::AddIsolatedCaloHit(const CaloHit *const pCaloHit)
 {
-    if (!m_isolatedCaloHitList.insert(pCaloHit).second)
+    if (!m_isolatedCaloHitList.GetModifiable().insert(pCaloHit).second)
         return STATUS_CODE_ALREADY_PRESENT;
 
     const float electromagneticEnergy(pCaloHit->GetElectromagneticEnergy());
@@ -194,12 +278,16 @@ StatusCode Cluster::AddIsolatedCaloHit(const CaloHit *const pCaloHit)
 
 StatusCode Cluster::RemoveIsolatedCaloHit(const CaloHit *const pCaloHit)
 {
-    CaloHitList::iterator iter = m_isolatedCaloHitList.find(pCaloHit);
+    if (m_isolatedCaloHitList.Get().empty())
+        return STATUS_CODE_NOT_FOUND;
 
-    if (m_isolatedCaloHitList.end() == iter)
+    CaloHitList &isolatedCaloHitList(m_isolatedCaloHitList.GetModifiable());
+    CaloHitList::iterator iter = isolatedCaloHitList.find(pCaloHit);
+
+    if (isolatedCaloHitList.end() == iter)
         return STATUS_CODE_NOT_FOUND;
 
-    m_isolatedCaloHitList.erase(iter);
+    isolatedCaloHitList.erase(iter);
 
     const float electromagneticEnergy(pCaloHit->GetElectromagneticEnergy());
     const float hadronicEnergy(pCaloHit->GetHadronicEnergy());
@@ -235,8 +323,14 @@ const CartesianVector Cluster::GetCentroid(const unsigned int pseudoLayer) const
 
 void Cluster::CalculateFitToAllHitsResult() const
 {
-    (void) ClusterFitHelper::FitFullCluster(this, m_fitToAllHitsResult);
-    m_isFitUpToDate = true;
+    ClusterFitResult fitToAllHitsResult;
+    (void) ClusterFitHelper::FitFullCluster(this, fitToAllHitsResult);
+
+    if (this->ClaimLazyProperty(FIT_TO_ALL_HITS))
+    {
+        m_fitToAllHitsResult = fitToAllHitsResult;
+        this->PublishLazyProperty(FIT_TO_ALL_HITS);
+    }
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -244,25 +338,26 @@ void Cluster::CalculateFitToAllHitsResult() const
 void Cluster::CalculateInitialDirection() const
 {
     if (m_orderedCaloHitList.empty())
-    {
-        m_initialDirection.SetValues(0.f, 0.f, 0.f);
-        m_isDirectionUpToDate = false;
         throw StatusCodeException(STATUS_CODE_NOT_INITIALIZED);
-    }
-    
+
     CartesianVector initialDirection(0.f, 0.f, 0.f);
     CaloHitList *const pCaloHitList(m_orderedCaloHitList.begin()->second);
 
     for (CaloHitList::const_iterator iter = pCaloHitList->begin(), iterEnd = pCaloHitList->end(); iter != iterEnd; ++iter)
         initialDirection += (*iter)->GetExpectedDirection();
 
-    m_initialDirection = initialDirection.GetUnitVector();
-    m_isDirectionUpToDate = true;
+    const CartesianVector unitDirection(initialDirection.GetUnitVector());
+
+    if (this->ClaimLazyProperty(INITIAL_DIRECTION))
+    {
+        m_initialDirection = unitDirection;
+        this->PublishLazyProperty(INITIAL_DIRECTION);
+    }
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-void Cluster::CalculateLayerHitType(const unsigned int pseudoLayer, InputHitType &layerHitType) const
+void Cluster::CalculateLayerHitType(const unsigned int pseudoLayer, const unsigned int lazyProperty, InputHitType &layerHitType) const
 {
     OrderedCaloHitList::const_iterator listIter = m_orderedCaloHitList.find(pseudoLayer);
 
@@ -286,15 +381,22 @@ void Cluster::CalculateLayerHitType(const unsigned int pseudoLayer, InputHitType
     }
 
     float highestEnergy(0.f);
+    InputHitType highestEnergyHitType;
 
     for (HitTypeToEnergyMap::const_iterator iter = hitTypeToEnergyMap.begin(), iterEnd = hitTypeToEnergyMap.end(); iter != iterEnd; ++iter)
     {
         if (iter->second > highestEnergy)
         {
-            layerHitType = iter->first;
+            highestEnergyHitType = iter->first;
             highestEnergy = iter->second;
         }
     }
+
+    if (this->ClaimLazyProperty(lazyProperty))
+    {
+        layerHitType = highestEnergyHitType;
+        this->PublishLazyProperty(lazyProperty);
+    }
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -317,21 +419,14 @@ void Cluster::PerformEnergyCorrections(const Pandora &pandora) const
         trackComparisonEnergy = correctedHadronicEnergy;
     }
 
-    if (!(m_correctedElectromagneticEnergy = correctedElectromagneticEnergy) || !(m_correctedHadronicEnergy = correctedHadronicEnergy) ||
-        !(m_trackComparisonEnergy = trackComparisonEnergy))
-    {
-        throw StatusCodeException(STATUS_CODE_FAILURE);
-    }
+    this->SetEnergyCorrections(correctedElectromagneticEnergy, correctedHadronicEnergy, trackComparisonEnergy);
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 void Cluster::CalculateFastPhotonFlag(const Pandora &pandora) const
 {
-    const bool fastPhotonFlag(pandora.GetPlugins()->GetParticleId()->IsPhoton(this));
-
-    if (!(m_isPhotonFast = fastPhotonFlag))
-        throw StatusCodeException(STATUS_CODE_FAILURE);
+    this->SetFastPhotonFlag(pandora.GetPlugins()->GetParticleId()->IsPhoton(this));
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -343,8 +438,7 @@ void Cluster::CalculateShowerStartLayer(const Pandora &pandora) const
     unsigned int showerStartLayer(std::numeric_limits<unsigned int>::max());
     pShowerProfilePlugin->CalculateShowerStartLayer(this, showerStartLayer);
 
-    if (!(m_showerStartLayer = showerStartLayer))
-        throw StatusCodeException(STATUS_CODE_FAILURE);
+    this->SetShowerStartLayer(showerStartLayer);
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -356,8 +450,264 @@ void Cluster::CalculateShowerProfile(const Pandora &pandora) const
     float showerProfileStart(std::numeric_limits<float>::max()), showerProfileDiscrepancy(std::numeric_limits<float>::max());
     pShowerProfilePlugin->CalculateLongitudinalProfile(this, showerProfileStart, showerProfileDiscrepancy);
 
-    if (!(m_showerProfileStart = showerProfileStart) || !(m_showerProfileDiscrepancy = showerProfileDiscrepancy))
+    this->SetShowerProfile(showerProfileStart, showerProfileDiscrepancy);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void Cluster::SetEnergyCorrections(const float correctedElectromagneticEnergy, const float correctedHadronicEnergy,
+    const float trackComparisonEnergy) const
+{
+    InputFloat inputElectromagneticEnergy, inputHadronicEnergy, inputTrackComparisonEnergy;
+
+    if (!(inputElectromagneticEnergy = correctedElectromagneticEnergy) || !(inputHadronicEnergy = correctedHadronicEnergy) ||
+        !(inputTrackComparisonEnergy = trackComparisonEnergy))
+    {
+        throw StatusCodeException(STATUS_CODE_FAILURE);
+    }
+
+    if (this->ClaimLazyProperty(ENERGY_CORRECTIONS))
+    {
+        m_correctedElectromagneticEnergy = inputElectromagneticEnergy;
+        m_correctedHadronicEnergy = inputHadronicEnergy;
+        m_trackComparisonEnergy = inputTrackComparisonEnergy;
+        this->PublishLazyProperty(ENERGY_CORRECTIONS);
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void Cluster::SetFastPhotonFlag(const bool fastPhotonFlag) const
+{
+    InputBool inputFastPhotonFlag;
+
+    if (!(inputFastPhotonFlag = fastPhotonFlag))
+        throw StatusCodeException(STATUS_CODE_FAILURE);
+
+    if (this->ClaimLazyProperty(FAST_PHOTON_FLAG))
+    {
+        m_isPhotonFast = inputFastPhotonFlag;
+        this->PublishLazyProperty(FAST_PHOTON_FLAG);
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void Cluster::SetShowerStartLayer(const unsigned int showerStartLayer) const
+{
+    InputUInt inputShowerStartLayer;
+
+    if (!(inputShowerStartLayer = showerStartLayer))
+        throw StatusCodeException(STATUS_CODE_FAILURE);
+
+    if (this->ClaimLazyProperty(SHOWER_START_LAYER))
+    {
+        m_showerStartLayer = inputShowerStartLayer;
+        this->PublishLazyProperty(SHOWER_START_LAYER);
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void Cluster::SetShowerProfile(const float showerProfileStart, const float showerProfileDiscrepancy) const
+{
+    InputFloat inputShowerProfileStart, inputShowerProfileDiscrepancy;
+
+    if (!(inputShowerProfileStart = showerProfileStart) || !(inputShowerProfileDiscrepancy = showerProfileDiscrepancy))
+        throw StatusCodeException(STATUS_CODE_FAILURE);
+
+    if (this->ClaimLazyProperty(SHOWER_PROFILE))
+    {
+        m_showerProfileStart = inputShowerProfileStart;
+        m_showerProfileDiscrepancy = inputShowerProfileDiscrepancy;
+        this->PublishLazyProperty(SHOWER_PROFILE);
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode Cluster::PrepareProperties(const Pandora &pandora, const ClusterVector &clusterVector, const unsigned int clusterProperties,
+    const bool useThreadPool)
+{
+    if (0 != (clusterProperties & ~ALL_CLUSTER_PROPERTIES))
+        return STATUS_CODE_INVALID_PARAMETER;
+
+    if (clusterVector.empty() || (0 == clusterProperties))
+        return STATUS_CODE_SUCCESS;
+
+    const ThreadPool *const pThreadPool(pandora.GetThreadPool());
+    const unsigned int nThreads(useThreadPool ? pThreadPool->GetNThreads() : 1);
+    const unsigned int nChunks((nThreads > 1) ? std::min(static_cast<unsigned int>(clusterVector.size()), CHUNKS_PER_THREAD * nThreads) : 1);
+
+    const PropertyCalculationTask task(pandora, clusterVector, clusterProperties, nChunks);
+    return pThreadPool->ParallelFor(nChunks, task);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void Cluster::CalculateProperties(const Pandora &pandora, const ClusterVector &clusterVector, const unsigned int clusterProperties)
+{
+    if (clusterProperties & CLUSTER_ENERGY_CORRECTIONS)
+    {
+        ClusterVector outdatedClusterVector;
+        Cluster::SelectOutdatedClusters(clusterVector, ENERGY_CORRECTIONS, outdatedClusterVector);
+
+        if (!outdatedClusterVector.empty())
+            Cluster::PerformEnergyCorrections(pandora, outdatedClusterVector);
+    }
+
+    if (clusterProperties & CLUSTER_FAST_PHOTON_FLAG)
+    {
+        ClusterVector outdatedClusterVector;
+        Cluster::SelectOutdatedClusters(clusterVector, FAST_PHOTON_FLAG, outdatedClusterVector);
+
+        if (!outdatedClusterVector.empty())
+            Cluster::CalculateFastPhotonFlags(pandora, outdatedClusterVector);
+    }
+
+    if (clusterProperties & CLUSTER_SHOWER_START_LAYER)
+    {
+        ClusterVector outdatedClusterVector;
+        Cluster::SelectOutdatedClusters(clusterVector, SHOWER_START_LAYER, outdatedClusterVector);
+
+        if (!outdatedClusterVector.empty())
+            Cluster::CalculateShowerStartLayers(pandora, outdatedClusterVector);
+    }
+
+    if (clusterProperties & CLUSTER_SHOWER_PROFILE)
+    {
+        ClusterVector outdatedClusterVector;
+        Cluster::SelectOutdatedClusters(clusterVector, SHOWER_PROFILE, outdatedClusterVector);
+
+        if (!outdatedClusterVector.empty())
+            Cluster::CalculateShowerProfiles(pandora, outdatedClusterVector);
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void Cluster::PerformEnergyCorrections(const Pandora &pandora, const ClusterVector &clusterVector)
+{
+    FloatVector correctedElectromagneticEnergyVector, correctedHadronicEnergyVector;
+    PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, pandora.GetPlugins()->GetEnergyCorrections()->MakeEnergyCorrections(clusterVector,
+        correctedElectromagneticEnergyVector, correctedHadronicEnergyVector));
+
+    BoolVector isEmShowerVector;
+    pandora.GetPlugins()->GetParticleId()->IsEmShower(clusterVector, isEmShowerVector);
+
+    const unsigned int nClusters(clusterVector.size());
+
+    if ((correctedElectromagneticEnergyVector.size() != nClusters) || (correctedHadronicEnergyVector.size() != nClusters) ||
+        (isEmShowerVector.size() != nClusters))
+    {
         throw StatusCodeException(STATUS_CODE_FAILURE);
+    }
+
+    for (unsigned int i = 0; i < nClusters; ++i)
+    {
+        clusterVector[i]->SetEnergyCorrections(correctedElectromagneticEnergyVector[i], correctedHadronicEnergyVector[i],
+            isEmShowerVector[i] ? correctedElectromagneticEnergyVector[i] : correctedHadronicEnergyVector[i]);
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void Cluster::CalculateFastPhotonFlags(const Pandora &pandora, const ClusterVector &clusterVector)
+{
+    BoolVector isPhotonVector;
+    pandora.GetPlugins()->GetParticleId()->IsPhoton(clusterVector, isPhotonVector);
+
+    if (isPhotonVector.size() != clusterVector.size())
+        throw StatusCodeException(STATUS_CODE_FAILURE);
+
+    for (unsigned int i = 0, iEnd = clusterVector.size(); i < iEnd; ++i)
+        clusterVector[i]->SetFastPhotonFlag(isPhotonVector[i]);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void Cluster::CalculateShowerStartLayers(const Pandora &pandora, const ClusterVector &clusterVector)
+{
+    UIntVector showerStartLayerVector;
+    pandora.GetPlugins()->GetShowerProfilePlugin()->CalculateShowerStartLayer(clusterVector, showerStartLayerVector);
+
+    if (showerStartLayerVector.size() != clusterVector.size())
+        throw StatusCodeException(STATUS_CODE_FAILURE);
+
+    for (unsigned int i = 0, iEnd = clusterVector.size(); i < iEnd; ++i)
+        clusterVector[i]->SetShowerStartLayer(showerStartLayerVector[i]);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void Cluster::CalculateShowerProfiles(const Pandora &pandora, const ClusterVector &clusterVector)
+{
+    FloatVector showerProfileStartVector, showerProfileDiscrepancyVector;
+    pandora.GetPlugins()->GetShowerProfilePlugin()->CalculateLongitudinalProfile(clusterVector, showerProfileStartVector,
+        showerProfileDiscrepancyVector);
+
+    if ((showerProfileStartVector.size() != clusterVector.size()) || (showerProfileDiscrepancyVector.size() != clusterVector.size()))
+        throw StatusCodeException(STATUS_CODE_FAILURE);
+
+    for (unsigned int i = 0, iEnd = clusterVector.size(); i < iEnd; ++i)
+        clusterVector[i]->SetShowerProfile(showerProfileStartVector[i], showerProfileDiscrepancyVector[i]);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void Cluster::SelectOutdatedClusters(const ClusterVector &clusterVector, const unsigned int lazyProperty, ClusterVector &outdatedClusterVector)
+{
+    for (ClusterVector::const_iterator iter = clusterVector.begin(), iterEnd = clusterVector.end(); iter != iterEnd; ++iter)
+    {
+        if (!(*iter)->IsUpToDate(lazyProperty))
+            outdatedClusterVector.push_back(*iter);
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+bool Cluster::ClaimLazyProperty(const unsigned int lazyProperty) const
+{
+    const unsigned int claimFlag(lazyProperty << LAZY_PROPERTY_CLAIM_SHIFT);
+#if __cplusplus > 199711L
+    if (0 == (m_lazyPropertyFlags.fetch_or(claimFlag, std::memory_order_acq_rel) & claimFlag))
+        return true;
+
+    // ATTN: Another thread has claimed the property; its value is being stored and will be published shortly
+    while (!this->IsUpToDate(lazyProperty))
+        std::this_thread::yield();
+
+    return false;
+#else
+    if (0 != (m_lazyPropertyFlags & claimFlag))
+        return false;
+
+    m_lazyPropertyFlags |= claimFlag;
+    return true;
+#endif
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void Cluster::PublishLazyProperty(const unsigned int lazyProperty) const
+{
+#if __cplusplus > 199711L
+    m_lazyPropertyFlags.fetch_or(lazyProperty, std::memory_order_release);
+#else
+    m_lazyPropertyFlags |= lazyProperty;
+#endif
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void Cluster::ResetLazyProperties(const unsigned int lazyProperties)
+{
+    const unsigned int flags(lazyProperties | (lazyProperties << LAZY_PROPERTY_CLAIM_SHIFT));
+#if __cplusplus > 199711L
+    m_lazyPropertyFlags.fetch_and(~flags, std::memory_order_relaxed);
+#else
+    m_lazyPropertyFlags &= ~flags;
+#endif
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -367,7 +717,7 @@ StatusCode Cluster::ResetProperties()
     if (!m_orderedCaloHitList.empty())
         m_orderedCaloHitList.Reset();
 
-    m_isolatedCaloHitList.clear();
+    m_isolatedCaloHitList.Clear();
 
     m_nCaloHits = 0;
     m_nPossibleMipHits = 0;
@@ -381,6 +731,9 @@ StatusCode Cluster::ResetProperties()
     m_innerPseudoLayer.Reset();
     m_outerPseudoLayer.Reset();
 
+    m_mcParticleWeightMap.clear();
+    m_mcParticleHitCountMap.clear();
+
     m_particleId = UNKNOWN_PARTICLE_TYPE;
 
     this->ResetOutdatedProperties();
@@ -392,8 +745,7 @@ StatusCode Cluster::ResetProperties()
 
 void Cluster::ResetOutdatedProperties()
 {
-    m_isFitUpToDate = false;
-    m_isDirectionUpToDate = false;
+    this->ResetLazyProperties(ALL_LAZY_PROPERTIES);
     m_initialDirection.SetValues(0.f, 0.f, 0.f);
     m_fitToAllHitsResult.Reset();
     m_showerStartLayer.Reset();
@@ -420,7 +772,7 @@ StatusCode Cluster::AddHitsFromSecondCluster(const Cluster *const pCluster)
     const CaloHitList &isolatedCaloHitList(pCluster->GetIsolatedCaloHitList());
     for (CaloHitList::const_iterator iter = isolatedCaloHitList.begin(), iterEnd = isolatedCaloHitList.end(); iter != iterEnd; ++iter)
     {
-        if (!m_isolatedCaloHitList.insert(*iter).second)
+        if (!m_isolatedCaloHitList.GetModifiable().insert(*iter).second)
             return STATUS_CODE_ALREADY_PRESENT;
     }
 
@@ -461,17 +813,79 @@ StatusCode Cluster::AddHitsFromSecondCluster(const Cluster *const pCluster)
     m_innerPseudoLayer = m_orderedCaloHitList.begin()->first;
     m_outerPseudoLayer = m_orderedCaloHitList.rbegin()->first;
 
+    for (MCParticleWeightMap::const_iterator iter = pCluster->m_mcParticleWeightMap.begin(), iterEnd = pCluster->m_mcParticleWeightMap.end();
+        iter != iterEnd; ++iter)
+    {
+        m_mcParticleWeightMap[iter->first] += iter->second;
+        m_mcParticleHitCountMap[iter->first] += pCluster->m_mcParticleHitCountMap.at(iter->first);
+    }
+
     return STATUS_CODE_SUCCESS;
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+void Cluster::AddMCParticleWeights(const CaloHit *const pCaloHit)
+{
+    const MCParticleWeightMap &hitMCParticleWeightMap(pCaloHit->GetMCParticleWeightMap());
+
+    for (MCParticleWeightMap::const_iterator iter = hitMCParticleWeightMap.begin(), iterEnd = hitMCParticleWeightMap.end(); iter != iterEnd; ++iter)
+    {
+        m_mcParticleWeightMap[iter->first] += iter->second;
+        ++m_mcParticleHitCountMap[iter->first];
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode Cluster::RemoveMCParticleWeights(const CaloHit *const pCaloHit)
+{
+    const MCParticleWeightMap &hitMCParticleWeightMap(pCaloHit->GetMCParticleWeightMap());
+
+    for (MCParticleWeightMap::const_iterator iter = hitMCParticleWeightMap.begin(), iterEnd = hitMCParticleWeightMap.end(); iter != iterEnd; ++iter)
+    {
+        MCParticleHitCountMap::iterator countIter = m_mcParticleHitCountMap.find(iter->first);
+
+        if (m_mcParticleHitCountMap.end() == countIter)
+            return STATUS_CODE_FAILURE;
+
+        // Drop entries exactly, rather than leaving floating point residues, once no contributing hits remain
+        if (0 == --countIter->second)
+        {
+            m_mcParticleHitCountMap.erase(countIter);
+            m_mcParticleWeightMap.erase(iter->first);
+        }
+        else
+        {
+            m_mcParticleWeightMap[iter->first] -= iter->second;
+        }
+    }
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void Cluster::ResetMCParticleWeights()
+{
+    m_mcParticleWeightMap.clear();
+    m_mcParticleHitCountMap.clear();
+
+    for (OrderedCaloHitList::const_iterator iter = m_orderedCaloHitList.begin(), iterEnd = m_orderedCaloHitList.end(); iter != iterEnd; ++iter)
+    {
+        for (CaloHitList::const_iterator hitIter = iter->second->begin(), hitIterEnd = iter->second->end(); hitIter != hitIterEnd; ++hitIter)
+            this->AddMCParticleWeights(*hitIter);
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 StatusCode Cluster::AddTrackAssociation(const Track *const pTrack)
 {
     if (NULL == pTrack)
         return STATUS_CODE_INVALID_PARAMETER;
 
-    if (!m_associatedTrackList.insert(pTrack).second)
+    if (!m_associatedTrackList.GetModifiable().insert(pTrack).second)
         return STATUS_CODE_FAILURE;
 
     return STATUS_CODE_SUCCESS;
@@ -481,12 +895,16 @@ StatusCode Cluster::AddTrackAssociation(const Track *const pTrack)
 
 StatusCode Cluster::RemoveTrackAssociation(const Track *const pTrack)
 {
-    TrackList::iterator iter = m_associatedTrackList.find(pTrack);
+    if (m_associatedTrackList.Get().empty())
+        return STATUS_CODE_NOT_FOUND;
+
+    TrackList &associatedTrackList(m_associatedTrackList.GetModifiable());
+    TrackList::iterator iter = associatedTrackList.find(pTrack);
 
-    if (m_associatedTrackList.end() == iter)
+    if (associatedTrackList.end() == iter)
         return STATUS_CODE_NOT_FOUND;
 
-    m_associatedTrackList.erase(iter);
+    associatedTrackList.erase(iter);
 
     return STATUS_CODE_SUCCESS;
 }
@@ -36,7 +36,7 @@ MCParticle::~MCParticle()
 
 StatusCode MCParticle::AddDaughter(const MCParticle *const pMCParticle)
 {
-    if (!m_daughterList.insert(pMCParticle).second)
+    if (!m_daughterList.GetModifiable().insert(pMCParticle).second)
         return STATUS_CODE_ALREADY_PRESENT;
 
     return STATUS_CODE_SUCCESS;
@@ -46,7 +46,7 @@ StatusCode MCParticle::AddDaughter(const MCParticle *const pMCParticle)
 
 StatusCode MCParticle::AddParent(const MCParticle *const pMCParticle)
 {
-    if (!m_parentList.insert(pMCParticle).second)
+    if (!m_parentList.GetModifiable().insert(pMCParticle).second)
         return STATUS_CODE_ALREADY_PRESENT;
 
     return STATUS_CODE_SUCCESS;
@@ -56,12 +56,16 @@ StatusCode MCParticle::AddParent(const MCParticle *const pMCParticle)
 
 StatusCode MCParticle::RemoveDaughter(const MCParticle *const pMCParticle)
 {
-    MCParticleList::iterator iter = m_daughterList.find(pMCParticle);
+    if (m_daughterList.Get().empty())
+        return STATUS_CODE_NOT_FOUND;
+
+    MCParticleList &daughterList(m_daughterList.GetModifiable());
+    MCParticleList::iterator iter = daughterList.find(pMCParticle);
 
-    if (m_daughterList.end() == iter)
+    if (daughterList.end() == iter)
         return STATUS_CODE_NOT_FOUND;
 
-    m_daughterList.erase(iter);
+    daughterList.erase(iter);
 
     return STATUS_CODE_SUCCESS;
 }
@@ -70,12 +74,16 @@ StatusCode MCParticle::RemoveDaughter(const MCParticle *const pMCParticle)
 
 StatusCode MCParticle::RemoveParent(const MCParticle *const pMCParticle)
 {
-    MCParticleList::iterator iter = m_parentList.find(pMCParticle);
+    if (m_parentList.Get().empty())
+        return STATUS_CODE_NOT_FOUND;
+
+    MCParticleList &parentList(m_parentList.GetModifiable());
+    MCParticleList::iterator iter = parentList.find(pMCParticle);
 
-    if (m_parentList.end() == iter)
+    if (parentList.end() == iter)
         return STATUS_CODE_NOT_FOUND;
 
-    m_parentList.erase(iter);
+    parentList.erase(iter);
 
     return STATUS_CODE_SUCCESS;
 }
@@ -21,9 +21,10 @@ ParticleFlowObject::ParticleFlowObject(const PandoraContentApi::ParticleFlowObje
     m_energy(parameters.m_energy.Get()),
     m_momentum(parameters.m_momentum.Get()),
     m_trackList(parameters.m_trackList),
-    m_clusterList(parameters.m_clusterList),
-    m_vertexList(parameters.m_vertexList)
+    m_clusterList(parameters.m_clusterList)
 {
+    if (!parameters.m_vertexList.empty())
+        m_vertexList.GetModifiable() = parameters.m_vertexList;
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -114,7 +115,7 @@ StatusCode ParticleFlowObject::AddToPfo(const Track *const pTrack)
 template <>
 StatusCode ParticleFlowObject::AddToPfo(const Vertex *const pVertex)
 {
-    if (!m_vertexList.insert(pVertex).second)
+    if (!m_vertexList.GetModifiable().insert(pVertex).second)
         return STATUS_CODE_ALREADY_PRESENT;
 
     return STATUS_CODE_SUCCESS;
@@ -149,12 +150,16 @@ StatusCode ParticleFlowObject::RemoveFromPfo(const Track *const pTrack)
 template <>
 StatusCode ParticleFlowObject::RemoveFromPfo(const Vertex *const pVertex)
 {
-    VertexList::iterator iter = m_vertexList.find(pVertex);
+    if (m_vertexList.Get().empty())
+        return STATUS_CODE_NOT_FOUND;
+
+    VertexList &vertexList(m_vertexList.GetModifiable());
+    VertexList::iterator iter = vertexList.find(pVertex);
 
-    if (m_vertexList.end() == iter)
+    if (vertexList.end() == iter)
         return STATUS_CODE_NOT_FOUND;
 
-    m_vertexList.erase(iter);
+    vertexList.erase(iter);
     return STATUS_CODE_SUCCESS;
 }
 
@@ -165,7 +170,7 @@ StatusCode ParticleFlowObject::AddParent(const ParticleFlowObject *const pPfo)
     if (NULL == pPfo)
         return STATUS_CODE_INVALID_PARAMETER;
 
-    if (!m_parentPfoList.insert(pPfo).second)
+    if (!m_parentPfoList.GetModifiable().insert(pPfo).second)
         return STATUS_CODE_ALREADY_PRESENT;
 
     return STATUS_CODE_SUCCESS;
@@ -178,7 +183,7 @@ StatusCode ParticleFlowObject::AddDaughter(const ParticleFlowObject *const pPfo)
     if (NULL == pPfo)
         return STATUS_CODE_INVALID_PARAMETER;
 
-    if (!m_daughterPfoList.insert(pPfo).second)
+    if (!m_daughterPfoList.GetModifiable().insert(pPfo).second)
         return STATUS_CODE_ALREADY_PRESENT;
 
     return STATUS_CODE_SUCCESS;
@@ -188,12 +193,16 @@ StatusCode ParticleFlowObject::AddDaughter(const ParticleFlowObject *const pPfo)
 
 StatusCode ParticleFlowObject::RemoveParent(const ParticleFlowObject *const pPfo)
 {
-    PfoList::const_iterator iter = m_parentPfoList.find(pPfo);
+    if (m_parentPfoList.Get().empty())
+        return STATUS_CODE_NOT_FOUND;
 
-    if (m_parentPfoList.end() == iter)
+    PfoList &parentPfoList(m_parentPfoList.GetModifiable());
+    PfoList::const_iterator iter = parentPfoList.find(pPfo);
+
+    if (parentPfoList.end() == iter)
         return STATUS_CODE_NOT_FOUND;
 
-    m_parentPfoList.erase(iter);
+    parentPfoList.erase(iter);
     return STATUS_CODE_SUCCESS;
 }
 
@@ -201,12 +210,16 @@ StatusCode ParticleFlowObject::RemoveParent(const ParticleFlowObject *const pPfo
 
 StatusCode ParticleFlowObject::RemoveDaughter(const ParticleFlowObject *const pPfo)
 {
-    PfoList::const_iterator iter = m_daughterPfoList.find(pPfo);
+    if (m_daughterPfoList.Get().empty())
+        return STATUS_CODE_NOT_FOUND;
+
+    PfoList &daughterPfoList(m_daughterPfoList.GetModifiable());
+    PfoList::const_iterator iter = daughterPfoList.find(pPfo);
 
-    if (m_daughterPfoList.end() == iter)
+    if (daughterPfoList.end() == iter)
         return STATUS_CODE_NOT_FOUND;
 
-    m_daughterPfoList.erase(iter);
+    daughterPfoList.erase(iter);
     return STATUS_CODE_SUCCESS;
 }
 
@@ -16,22 +16,10 @@ namespace pandora
 
 const MCParticle *Track::GetMainMCParticle() const
 {
-    float bestWeight(0.f);
-    const MCParticle *pBestMCParticle = NULL;
-
-    for (MCParticleWeightMap::const_iterator iter = m_mcParticleWeightMap.begin(), iterEnd = m_mcParticleWeightMap.end(); iter != iterEnd; ++iter)
-    {
-        if (iter->second > bestWeight)
-        {
-            bestWeight = iter->second;
-            pBestMCParticle = iter->first;
-        }
-    }
-
-    if (NULL == pBestMCParticle)
+    if (NULL == m_pMainMCParticle)
         throw StatusCodeException(STATUS_CODE_NOT_INITIALIZED);
 
-    return pBestMCParticle;
+    return m_pMainMCParticle;
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -53,6 +41,7 @@ Track::Track(const PandoraApi::Track::Parameters &parameters) :
     m_canFormPfo(parameters.m_canFormPfo.Get()),
     m_canFormClusterlessPfo(parameters.m_canFormClusterlessPfo.Get()),
     m_pAssociatedCluster(NULL),
+    m_pMainMCParticle(NULL),
     m_pParentAddress(parameters.m_pParentAddress.Get()),
     m_isAvailable(true)
 {
@@ -68,23 +57,42 @@ Track::Track(const PandoraApi::Track::Parameters &parameters) :
 
 Track::~Track()
 {
-    m_parentTrackList.clear();
-    m_siblingTrackList.clear();
-    m_daughterTrackList.clear();
+    m_parentTrackList.Clear();
+    m_siblingTrackList.Clear();
+    m_daughterTrackList.Clear();
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 void Track::SetMCParticleWeightMap(const MCParticleWeightMap &mcParticleWeightMap)
 {
-    m_mcParticleWeightMap = mcParticleWeightMap;
+    if (mcParticleWeightMap.empty())
+    {
+        this->RemoveMCParticles();
+        return;
+    }
+
+    m_mcParticleWeightMap.GetModifiable() = mcParticleWeightMap;
+
+    float bestWeight(0.f);
+    m_pMainMCParticle = NULL;
+
+    for (MCParticleWeightMap::const_iterator iter = mcParticleWeightMap.begin(), iterEnd = mcParticleWeightMap.end(); iter != iterEnd; ++iter)
+    {
+        if (iter->second > bestWeight)
+        {
+            bestWeight = iter->second;
+            m_pMainMCParticle = iter->first;
+        }
+    }
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 void Track::RemoveMCParticles()
 {
-    m_mcParticleWeightMap.clear();
+    m_mcParticleWeightMap.Clear();
+    m_pMainMCParticle = NULL;
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -121,7 +129,7 @@ StatusCode Track::AddParent(const Track *const pTrack)
     if (NULL == pTrack)
         return STATUS_CODE_INVALID_PARAMETER;
 
-    if (!m_parentTrackList.insert(pTrack).second)
+    if (!m_parentTrackList.GetModifiable().insert(pTrack).second)
         return STATUS_CODE_ALREADY_PRESENT;
 
     return STATUS_CODE_SUCCESS;
@@ -134,7 +142,7 @@ StatusCode Track::AddDaughter(const Track *const pTrack)
     if (NULL == pTrack)
         return STATUS_CODE_INVALID_PARAMETER;
 
-    if (!m_daughterTrackList.insert(pTrack).second)
+    if (!m_daughterTrackList.GetModifiable().insert(pTrack).second)
         return STATUS_CODE_ALREADY_PRESENT;
 
     return STATUS_CODE_SUCCESS;
@@ -147,7 +155,7 @@ StatusCode Track::AddSibling(const Track *const pTrack)
     if (NULL == pTrack)
         return STATUS_CODE_INVALID_PARAMETER;
 
-    if (!m_siblingTrackList.insert(pTrack).second)
+    if (!m_siblingTrackList.GetModifiable().insert(pTrack).second)
         return STATUS_CODE_ALREADY_PRESENT;
 
     return STATUS_CODE_SUCCESS;
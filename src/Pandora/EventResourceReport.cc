@@ -0,0 +1,97 @@
+/**
+ *  @file   PandoraSDK/src/Pandora/EventResourceReport.cc
+ *
+ *  @brief  Implementation of the event resource report classes.
+ *
+ *  $Log: $
+ */
+
+#include "Pandora/EventResourceReport.h"
+
+#include <iostream>
+
+namespace pandora
+{
+
+const unsigned int ObjectResourceReport::ESTIMATED_BYTES_PER_LIST_ENTRY = 5 * sizeof(void *);
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+ObjectResourceReport::ObjectResourceReport() :
+    m_nObjectsCreated(0),
+    m_nObjectsDeleted(0),
+    m_peakNLiveObjects(0),
+    m_objectSize(0),
+    m_nListEntries(0)
+{
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+unsigned long ObjectResourceReport::GetEstimatedPeakBytes() const
+{
+    return ((static_cast<unsigned long>(m_peakNLiveObjects) * m_objectSize) +
+        (static_cast<unsigned long>(m_nListEntries) * ESTIMATED_BYTES_PER_LIST_ENTRY));
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void ObjectResourceReport::Print(const std::string &objectType) const
+{
+    std::cout << "  " << objectType << ": created " << m_nObjectsCreated << ", deleted " << m_nObjectsDeleted << ", peak live "
+              << m_peakNLiveObjects << ", estimated peak bytes " << this->GetEstimatedPeakBytes() << ", named lists " << m_listSizes.size()
+              << std::endl;
+
+    for (ListSizeMap::const_iterator iter = m_listSizes.begin(), iterEnd = m_listSizes.end(); iter != iterEnd; ++iter)
+        std::cout << "    " << iter->first << ": " << iter->second << std::endl;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+EventResourceReport::EventResourceReport() :
+    m_maxReclusteringDepth(0),
+    m_nFragmentedCaloHits(0),
+    m_nMergedCaloHitFragments(0)
+{
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+unsigned int EventResourceReport::GetPeakNLiveObjects() const
+{
+    return (m_caloHits.m_peakNLiveObjects + m_tracks.m_peakNLiveObjects + m_mcParticles.m_peakNLiveObjects + m_clusters.m_peakNLiveObjects +
+        m_pfos.m_peakNLiveObjects + m_vertices.m_peakNLiveObjects);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+unsigned long EventResourceReport::GetEstimatedPeakBytes() const
+{
+    return (m_caloHits.GetEstimatedPeakBytes() + m_tracks.GetEstimatedPeakBytes() + m_mcParticles.GetEstimatedPeakBytes() +
+        m_clusters.GetEstimatedPeakBytes() + m_pfos.GetEstimatedPeakBytes() + m_vertices.GetEstimatedPeakBytes());
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void EventResourceReport::Print() const
+{
+    std::cout << "EventResourceReport: peak live objects " << this->GetPeakNLiveObjects() << ", estimated peak bytes "
+              << this->GetEstimatedPeakBytes() << ", max reclustering depth " << m_maxReclusteringDepth << ", fragmented calo hits "
+              << m_nFragmentedCaloHits << ", merged calo hit fragments " << m_nMergedCaloHitFragments << std::endl;
+
+    m_caloHits.Print("CaloHits");
+    m_tracks.Print("Tracks");
+    m_mcParticles.Print("MCParticles");
+    m_clusters.Print("Clusters");
+    m_pfos.Print("Pfos");
+    m_vertices.Print("Vertices");
+
+    for (AlgorithmExceptionCountMap::const_iterator iter = m_algorithmExceptionCounts.begin(), iterEnd = m_algorithmExceptionCounts.end();
+        iter != iterEnd; ++iter)
+    {
+        std::cout << "  Exceptions thrown in algorithm " << iter->first << ": " << iter->second << std::endl;
+    }
+}
+
+} // namespace pandora
@@ -0,0 +1,110 @@
+/**
+ *  @file   PandoraSDK/src/Pandora/FrozenListView.cc
+ * 
+ *  @brief  Implementation of the frozen list view class.
+ * 
+ *  $Log: $
+ */
+
+#include "Api/PandoraContentApi.h"
+
+#include "Pandora/Algorithm.h"
+#include "Pandora/FrozenListView.h"
+
+namespace pandora
+{
+
+FrozenListView::FrozenListView(const Algorithm &algorithm) :
+    m_pCaloHitList(NULL),
+    m_pTrackList(NULL),
+    m_pMCParticleList(NULL),
+    m_pClusterList(NULL),
+    m_pPfoList(NULL),
+    m_pVertexList(NULL),
+    m_pPandoraSettings(PandoraContentApi::GetSettings(algorithm)),
+    m_pGeometryManager(PandoraContentApi::GetGeometry(algorithm)),
+    m_pPluginManager(PandoraContentApi::GetPlugins(algorithm))
+{
+    // Lists absent at construction are left unset, and reported as such only if requested
+    if (STATUS_CODE_SUCCESS != PandoraContentApi::GetCurrentList(algorithm, m_pCaloHitList))
+        m_pCaloHitList = NULL;
+
+    if (STATUS_CODE_SUCCESS != PandoraContentApi::GetCurrentList(algorithm, m_pTrackList))
+        m_pTrackList = NULL;
+
+    if (STATUS_CODE_SUCCESS != PandoraContentApi::GetCurrentList(algorithm, m_pMCParticleList))
+        m_pMCParticleList = NULL;
+
+    if (STATUS_CODE_SUCCESS != PandoraContentApi::GetCurrentList(algorithm, m_pClusterList))
+        m_pClusterList = NULL;
+
+    if (STATUS_CODE_SUCCESS != PandoraContentApi::GetCurrentList(algorithm, m_pPfoList))
+        m_pPfoList = NULL;
+
+    if (STATUS_CODE_SUCCESS != PandoraContentApi::GetCurrentList(algorithm, m_pVertexList))
+        m_pVertexList = NULL;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <>
+StatusCode FrozenListView::AddList<CaloHitList>(const Algorithm &algorithm, const std::string &listName)
+{
+    return FrozenListView::AddList(algorithm, listName, m_nameToCaloHitListMap);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <>
+StatusCode FrozenListView::AddList<TrackList>(const Algorithm &algorithm, const std::string &listName)
+{
+    return FrozenListView::AddList(algorithm, listName, m_nameToTrackListMap);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <>
+StatusCode FrozenListView::AddList<MCParticleList>(const Algorithm &algorithm, const std::string &listName)
+{
+    return FrozenListView::AddList(algorithm, listName, m_nameToMCParticleListMap);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <>
+StatusCode FrozenListView::AddList<ClusterList>(const Algorithm &algorithm, const std::string &listName)
+{
+    return FrozenListView::AddList(algorithm, listName, m_nameToClusterListMap);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <>
+StatusCode FrozenListView::AddList<PfoList>(const Algorithm &algorithm, const std::string &listName)
+{
+    return FrozenListView::AddList(algorithm, listName, m_nameToPfoListMap);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <>
+StatusCode FrozenListView::AddList<VertexList>(const Algorithm &algorithm, const std::string &listName)
+{
+    return FrozenListView::AddList(algorithm, listName, m_nameToVertexListMap);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename T>
+StatusCode FrozenListView::AddList(const Algorithm &algorithm, const std::string &listName, std::map<std::string, const T *> &nameToListMap)
+{
+    const T *pT(NULL);
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::GetList(algorithm, listName, pT));
+
+    if (!nameToListMap.insert(typename std::map<std::string, const T *>::value_type(listName, pT)).second)
+        return STATUS_CODE_ALREADY_PRESENT;
+
+    return STATUS_CODE_SUCCESS;
+}
+
+} // namespace pandora
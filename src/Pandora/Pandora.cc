@@ -24,6 +24,9 @@
 #include "Pandora/Pandora.h"
 #include "Pandora/PandoraImpl.h"
 #include "Pandora/PandoraSettings.h"
+#include "Pandora/ThreadPool.h"
+
+#include "Persistency/ApiRecorder.h"
 
 #include "Xml/tinyxml.h"
 
@@ -41,9 +44,12 @@ Pandora::Pandora() :
     m_pTrackManager(NULL),
     m_pVertexManager(NULL),
     m_pPandoraSettings(NULL),
+    m_pThreadPool(NULL),
     m_pPandoraApiImpl(NULL),
     m_pPandoraContentApiImpl(NULL),
-    m_pPandoraImpl(NULL)
+    m_pPandoraImpl(NULL),
+    m_pApiRecorder(NULL),
+    m_isContentApiLocked(false)
 {
     try
     {
@@ -57,6 +63,7 @@ Pandora::Pandora() :
         m_pTrackManager = new TrackManager(this);
         m_pVertexManager = new VertexManager(this);
         m_pPandoraSettings = new PandoraSettings(this);
+        m_pThreadPool = new ThreadPool;
         m_pPandoraApiImpl = new PandoraApiImpl(this);
         m_pPandoraContentApiImpl = new PandoraContentApiImpl(this);
         m_pPandoraImpl = new PandoraImpl(this);
@@ -89,9 +96,11 @@ Pandora::~Pandora()
     delete m_pTrackManager;
     delete m_pVertexManager;
     delete m_pPandoraSettings;
+    delete m_pThreadPool;
     delete m_pPandoraApiImpl;
     delete m_pPandoraContentApiImpl;
     delete m_pPandoraImpl;
+    delete m_pApiRecorder;
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -110,6 +119,7 @@ StatusCode Pandora::PrepareEvent()
 StatusCode Pandora::ProcessEvent()
 {
     PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->PrepareEvent());
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, m_pPandoraImpl->ProcessRegions());
 
     // Loop over algorithms
     const StringVector &pandoraAlgorithms(m_pPandoraImpl->GetPandoraAlgorithms());
@@ -117,7 +127,7 @@ StatusCode Pandora::ProcessEvent()
     for (StringVector::const_iterator iter = pandoraAlgorithms.begin(), iterEnd = pandoraAlgorithms.end(); iter != iterEnd; ++iter)
         PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, m_pPandoraImpl->RunAlgorithm(*iter));
 
-    return STATUS_CODE_SUCCESS;
+    return m_pPandoraImpl->PrintEventResourceReportIfRequired();
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -131,16 +141,24 @@ StatusCode Pandora::ResetEvent()
 
 StatusCode Pandora::ReadSettings(const std::string &xmlFileName)
 {
-    try
+    TiXmlDocument xmlDocument(xmlFileName);
+
+    if (!xmlDocument.LoadFile())
     {
-        TiXmlDocument xmlDocument(xmlFileName);
+        std::cout << "Pandora::ReadSettings - Invalid xml file." << std::endl;
+        std::cout << "Failure in reading pandora settings, " << StatusCodeToString(STATUS_CODE_FAILURE) << std::endl;
+        return STATUS_CODE_FAILURE;
+    }
 
-        if (!xmlDocument.LoadFile())
-        {
-            std::cout << "Pandora::ReadSettings - Invalid xml file." << std::endl;
-            throw StatusCodeException(STATUS_CODE_FAILURE);
-        }
+    return this->ReadSettings(xmlDocument);
+}
 
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode Pandora::ReadSettings(TiXmlDocument &xmlDocument)
+{
+    try
+    {
         const TiXmlHandle xmlDocumentHandle(&xmlDocument);
         const TiXmlHandle xmlHandle(TiXmlHandle(xmlDocumentHandle.FirstChildElement().Element()));
 
@@ -166,6 +184,9 @@ StatusCode Pandora::ReadSettings(const std::string &xmlFileName)
 
 const PandoraApiImpl *Pandora::GetPandoraApiImpl() const
 {
+    if (m_isContentApiLocked)
+        throw StatusCodeException(STATUS_CODE_NOT_ALLOWED);
+
     return m_pPandoraApiImpl;
 }
 
@@ -173,6 +194,9 @@ const PandoraApiImpl *Pandora::GetPandoraApiImpl() const
 
 const PandoraContentApiImpl *Pandora::GetPandoraContentApiImpl() const
 {
+    if (m_isContentApiLocked)
+        throw StatusCodeException(STATUS_CODE_NOT_ALLOWED);
+
     return m_pPandoraContentApiImpl;
 }
 
@@ -197,4 +221,11 @@ const PluginManager *Pandora::GetPlugins() const
     return m_pPluginManager;
 }
 
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+const ThreadPool *Pandora::GetThreadPool() const
+{
+    return m_pThreadPool;
+}
+
 } // namespace pandora
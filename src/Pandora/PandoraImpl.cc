@@ -6,6 +6,7 @@
  *  $Log: $
  */
 
+#include "Api/PandoraApiImpl.h"
 #include "Api/PandoraContentApiImpl.h"
 
 #include "Managers/AlgorithmManager.h"
@@ -17,14 +18,100 @@
 #include "Managers/TrackManager.h"
 #include "Managers/VertexManager.h"
 
+#include "Objects/Cluster.h"
+
+#include "Pandora/EventResourceReport.h"
 #include "Pandora/Pandora.h"
 #include "Pandora/PandoraImpl.h"
 #include "Pandora/PandoraSettings.h"
+#include "Pandora/ThreadPool.h"
+
+#include "Plugins/RegionPartitionPlugin.h"
+
+#include <algorithm>
+#include <limits>
 
 namespace pandora
 {
 
-StatusCode PandoraImpl::PrepareMCParticles() const
+const std::string PandoraImpl::REGION_PFO_LIST_NAME = "RegionPfos";
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode PandoraImpl::PrepareMCParticles()
+{
+    const PandoraSettings *const pSettings(m_pPandora->GetSettings());
+    m_isMCParticlePreparationPending = false;
+
+    if (!pSettings->ShouldPrepareMCParticles())
+        return STATUS_CODE_SUCCESS;
+
+    if (pSettings->ShouldPrepareMCParticlesOnDemand())
+    {
+        m_isMCParticlePreparationPending = true;
+        return STATUS_CODE_SUCCESS;
+    }
+
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->PerformMCParticlePreparation());
+
+    // ATTN: Clusters retained from the previous sliding window hold empty mc particle weight maps until the calo hits are matched again
+    m_pPandora->m_pClusterManager->ResetMCParticleWeights();
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode PandoraImpl::PrepareTracks()
+{
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, m_pPandora->m_pTrackManager->CreateInputList());
+
+    const PandoraSettings *const pSettings(m_pPandora->GetSettings());
+    m_isTrackAssociationPending = false;
+
+    if (!pSettings->ShouldAssociateTracks())
+        return STATUS_CODE_SUCCESS;
+
+    if (pSettings->ShouldAssociateTracksOnDemand())
+    {
+        m_isTrackAssociationPending = true;
+        return STATUS_CODE_SUCCESS;
+    }
+
+    return m_pPandora->m_pTrackManager->AssociateTracks();
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode PandoraImpl::PrepareMCParticlesIfPending()
+{
+    if (!m_isMCParticlePreparationPending)
+        return STATUS_CODE_SUCCESS;
+
+    m_isMCParticlePreparationPending = false;
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->PerformMCParticlePreparation());
+
+    // ATTN: Clusters created before the calo hit mc particle weights were assigned will hold empty mc particle weight maps
+    m_pPandora->m_pClusterManager->ResetMCParticleWeights();
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode PandoraImpl::AssociateTracksIfPending()
+{
+    if (!m_isTrackAssociationPending)
+        return STATUS_CODE_SUCCESS;
+
+    m_isTrackAssociationPending = false;
+
+    return m_pPandora->m_pTrackManager->AssociateTracks();
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode PandoraImpl::PerformMCParticlePreparation() const
 {
     PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, m_pPandora->m_pMCManager->AddMCParticleRelationships());
     PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, m_pPandora->m_pMCManager->IdentifyPfoTargets());
@@ -41,15 +128,6 @@ StatusCode PandoraImpl::PrepareMCParticles() const
 
     return STATUS_CODE_SUCCESS;
 }
-//------------------------------------------------------------------------------------------------------------------------------------------
-
-StatusCode PandoraImpl::PrepareTracks() const
-{
-    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, m_pPandora->m_pTrackManager->CreateInputList());
-    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, m_pPandora->m_pTrackManager->AssociateTracks());
-
-    return STATUS_CODE_SUCCESS;
-}
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
@@ -76,7 +154,16 @@ StatusCode PandoraImpl::RunAlgorithm(const std::string &algorithmName) const
 
 StatusCode PandoraImpl::InitializeSettings(const TiXmlHandle *const pXmlHandle) const
 {
-    return m_pPandora->m_pPandoraSettings->Initialize(pXmlHandle);
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, m_pPandora->m_pPandoraSettings->Initialize(pXmlHandle));
+
+    const bool shouldRetainCapacity(m_pPandora->m_pPandoraSettings->ShouldRetainInputListCapacity());
+    m_pPandora->m_pCaloHitManager->SetShouldRetainCapacity(shouldRetainCapacity);
+    m_pPandora->m_pMCManager->SetShouldRetainCapacity(shouldRetainCapacity);
+    m_pPandora->m_pTrackManager->SetShouldRetainCapacity(shouldRetainCapacity);
+
+    StatusCodeException::SetShouldCaptureBackTrace(m_pPandora->m_pPandoraSettings->ShouldCaptureExceptionBackTrace());
+
+    return m_pPandora->m_pThreadPool->SetNThreads(m_pPandora->m_pPandoraSettings->GetNThreads());
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -95,23 +182,286 @@ StatusCode PandoraImpl::InitializePlugins(const TiXmlHandle *const pXmlHandle) c
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-StatusCode PandoraImpl::ResetEvent() const
+StatusCode PandoraImpl::ResetEvent()
 {
-    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, m_pPandora->m_pCaloHitManager->ResetForNextEvent());
-    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, m_pPandora->m_pClusterManager->ResetForNextEvent());
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->ResetEventContent(false, 0.f));
+
+    // Region pfos, deleted above, refer to clusters, tracks and vertices owned by the region instances, so the regions are reset last
+    for (PandoraVector::const_iterator iter = m_regionPandoraVector.begin(), iterEnd = m_regionPandoraVector.end(); iter != iterEnd; ++iter)
+        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, (*iter)->m_pPandoraImpl->ResetEvent());
+
+    m_caloHitRegionMap.clear();
+    m_trackRegionMap.clear();
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode PandoraImpl::AdvanceSlidingWindow(const float windowStartTime)
+{
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->ResetEventContent(true, windowStartTime));
+
+    for (PandoraVector::const_iterator iter = m_regionPandoraVector.begin(), iterEnd = m_regionPandoraVector.end(); iter != iterEnd; ++iter)
+        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, (*iter)->m_pPandoraImpl->AdvanceSlidingWindow(windowStartTime));
+
+    // Retained calo hits keep their parent addresses, so only the track routing is cleared
+    m_trackRegionMap.clear();
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode PandoraImpl::ResetEventContent(const bool isNewWindow, const float windowStartTime)
+{
+    m_isMCParticlePreparationPending = false;
+    m_isTrackAssociationPending = false;
+    m_pPandora->m_pAlgorithmManager->m_exceptionCountMap.clear();
+
+    // Clusters for the next window are selected whilst all their calo hits still exist, before any manager is reset
+    ClusterManager::NameToClusterListMap windowClusterListMap;
+    ClusterList retainedClusterList;
+
+    if (isNewWindow)
+    {
+        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, m_pPandora->m_pClusterManager->SelectClustersForNextWindow(windowStartTime,
+            windowClusterListMap));
+    }
+
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, isNewWindow ? m_pPandora->m_pCaloHitManager->ResetForNextWindow(windowStartTime) :
+        m_pPandora->m_pCaloHitManager->ResetForNextEvent());
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, isNewWindow ?
+        m_pPandora->m_pClusterManager->ResetForNextWindow(windowClusterListMap, retainedClusterList) :
+        m_pPandora->m_pClusterManager->ResetForNextEvent());
     PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, m_pPandora->m_pMCManager->ResetForNextEvent());
     PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, m_pPandora->m_pPfoManager->ResetForNextEvent());
     PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, m_pPandora->m_pTrackManager->ResetForNextEvent());
     PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, m_pPandora->m_pVertexManager->ResetForNextEvent());
 
+    if (!isNewWindow)
+        return STATUS_CODE_SUCCESS;
+
+    // The retained calo hits are made available unless clustered, and the retained clusters lose their mc particle weights
+    for (ClusterList::const_iterator iter = retainedClusterList.begin(), iterEnd = retainedClusterList.end(); iter != iterEnd; ++iter)
+    {
+        CaloHitList clusterCaloHitList((*iter)->GetIsolatedCaloHitList());
+        (*iter)->GetOrderedCaloHitList().GetCaloHitList(clusterCaloHitList);
+        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, m_pPandora->m_pCaloHitManager->SetAvailability(&clusterCaloHitList, false));
+    }
+
+    m_pPandora->m_pClusterManager->ResetMCParticleWeights();
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode PandoraImpl::GetEventResourceReport(EventResourceReport &eventResourceReport) const
+{
+    m_pPandora->m_pCaloHitManager->GetResourceReport(eventResourceReport.m_caloHits);
+    m_pPandora->m_pTrackManager->GetResourceReport(eventResourceReport.m_tracks);
+    m_pPandora->m_pMCManager->GetResourceReport(eventResourceReport.m_mcParticles);
+    m_pPandora->m_pClusterManager->GetResourceReport(eventResourceReport.m_clusters);
+    m_pPandora->m_pPfoManager->GetResourceReport(eventResourceReport.m_pfos);
+    m_pPandora->m_pVertexManager->GetResourceReport(eventResourceReport.m_vertices);
+
+    eventResourceReport.m_maxReclusteringDepth = m_pPandora->m_pCaloHitManager->m_maxNReclusteringProcesses;
+    eventResourceReport.m_nFragmentedCaloHits = m_pPandora->m_pCaloHitManager->m_nFragmentedCaloHits;
+    eventResourceReport.m_nMergedCaloHitFragments = m_pPandora->m_pCaloHitManager->m_nMergedCaloHitFragments;
+    eventResourceReport.m_algorithmExceptionCounts = m_pPandora->m_pAlgorithmManager->m_exceptionCountMap;
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode PandoraImpl::PrintEventResourceReportIfRequired() const
+{
+    const unsigned int objectThreshold(m_pPandora->GetSettings()->GetResourceReportObjectThreshold());
+    const float memoryThreshold(m_pPandora->GetSettings()->GetResourceReportMemoryThreshold());
+
+    if ((0 == objectThreshold) && (memoryThreshold < std::numeric_limits<float>::epsilon()))
+        return STATUS_CODE_SUCCESS;
+
+    EventResourceReport eventResourceReport;
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->GetEventResourceReport(eventResourceReport));
+
+    const bool isObjectThresholdExceeded((objectThreshold > 0) && (eventResourceReport.GetPeakNLiveObjects() > objectThreshold));
+    const bool isMemoryThresholdExceeded((memoryThreshold > std::numeric_limits<float>::epsilon()) &&
+        (static_cast<float>(eventResourceReport.GetEstimatedPeakBytes()) > memoryThreshold * 1024.f * 1024.f));
+
+    if (isObjectThresholdExceeded || isMemoryThresholdExceeded)
+        eventResourceReport.Print();
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode PandoraImpl::AddRegionInstance(const Pandora *const pRegionPandora)
+{
+    if ((NULL == pRegionPandora) || (m_pPandora == pRegionPandora))
+        return STATUS_CODE_INVALID_PARAMETER;
+
+    if (m_regionPandoraVector.end() != std::find(m_regionPandoraVector.begin(), m_regionPandoraVector.end(), pRegionPandora))
+        return STATUS_CODE_ALREADY_PRESENT;
+
+    // A region instance is reset only by its primary instance, so it can have neither a second primary nor regions of its own
+    PandoraImpl *const pRegionPandoraImpl(pRegionPandora->m_pPandoraImpl);
+
+    if ((NULL != m_pPrimaryPandora) || (NULL != pRegionPandoraImpl->m_pPrimaryPandora) || !pRegionPandoraImpl->m_regionPandoraVector.empty())
+        return STATUS_CODE_NOT_ALLOWED;
+
+    pRegionPandoraImpl->m_pPrimaryPandora = m_pPandora;
+    m_regionPandoraVector.push_back(pRegionPandora);
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename PARAMETERS>
+StatusCode PandoraImpl::GetRegionInstance(const PARAMETERS &parameters, const Pandora *&pRegionPandora) const
+{
+    pRegionPandora = NULL;
+
+    if (m_regionPandoraVector.empty())
+        return STATUS_CODE_SUCCESS;
+
+    const RegionPartitionPlugin *const pRegionPartitionPlugin(m_pPandora->m_pPluginManager->m_pRegionPartitionPlugin);
+
+    if (NULL == pRegionPartitionPlugin)
+        return STATUS_CODE_NOT_INITIALIZED;
+
+    unsigned int region(0);
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, pRegionPartitionPlugin->GetRegion(parameters, region));
+
+    if (region >= m_regionPandoraVector.size())
+        return STATUS_CODE_OUT_OF_RANGE;
+
+    pRegionPandora = m_regionPandoraVector[region];
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+const Pandora *PandoraImpl::GetCaloHitRegionInstance(const void *const pCaloHitParentAddress) const
+{
+    AddressToPandoraMap::const_iterator iter = m_caloHitRegionMap.find(pCaloHitParentAddress);
+    return ((m_caloHitRegionMap.end() != iter) ? iter->second : NULL);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+const Pandora *PandoraImpl::GetTrackRegionInstance(const void *const pTrackParentAddress) const
+{
+    AddressToPandoraMap::const_iterator iter = m_trackRegionMap.find(pTrackParentAddress);
+    return ((m_trackRegionMap.end() != iter) ? iter->second : NULL);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+/**
+ *  @brief  RegionProcessingTask class, processing the current event in a single region pandora instance
+ */
+class PandoraImpl::RegionProcessingTask : public ThreadPool::Task
+{
+public:
+    /**
+     *  @brief  Constructor
+     * 
+     *  @param  regionPandoraVector the region pandora instances, indexed by region
+     *  @param  statusCodeVector to receive the processing status code for each region, with one entry per region
+     */
+    RegionProcessingTask(const PandoraVector &regionPandoraVector, StatusCodeVector &statusCodeVector);
+
+    StatusCode Run(const unsigned int index) const;
+
+private:
+    const PandoraVector    &m_regionPandoraVector;  ///< The region pandora instances, indexed by region
+    StatusCodeVector       &m_statusCodeVector;     ///< The processing status codes, indexed by region
+};
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+PandoraImpl::RegionProcessingTask::RegionProcessingTask(const PandoraVector &regionPandoraVector, StatusCodeVector &statusCodeVector) :
+    m_regionPandoraVector(regionPandoraVector),
+    m_statusCodeVector(statusCodeVector)
+{
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode PandoraImpl::RegionProcessingTask::Run(const unsigned int index) const
+{
+    // Each task writes only its own entry, so that a failing region does not prevent the others from completing
+    try
+    {
+        m_statusCodeVector.at(index) = m_regionPandoraVector.at(index)->GetPandoraApiImpl()->ProcessEvent();
+    }
+    catch (StatusCodeException &statusCodeException)
+    {
+        m_statusCodeVector.at(index) = statusCodeException.GetStatusCode();
+    }
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode PandoraImpl::ProcessRegions() const
+{
+    if (m_regionPandoraVector.empty())
+        return STATUS_CODE_SUCCESS;
+
+    // Each region instance has its own managers, so the regions can be processed concurrently without further synchronisation
+    StatusCodeVector statusCodeVector(m_regionPandoraVector.size(), STATUS_CODE_FAILURE);
+    const RegionProcessingTask regionProcessingTask(m_regionPandoraVector, statusCodeVector);
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, m_pPandora->m_pThreadPool->ParallelFor(m_regionPandoraVector.size(), regionProcessingTask));
+
+    // Create the region pfo list even if no region produces any pfos
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, m_pPandora->m_pPfoManager->AdoptObjects(REGION_PFO_LIST_NAME, PfoList()));
+
+    for (unsigned int region = 0; region < m_regionPandoraVector.size(); ++region)
+    {
+        if (STATUS_CODE_SUCCESS != statusCodeVector[region])
+        {
+            std::cout << "Failure in processing region " << region << ", " << StatusCodeToString(statusCodeVector[region]) << std::endl;
+            continue;
+        }
+
+        const Pandora *const pRegionPandora(m_regionPandoraVector[region]);
+        const PfoList *pRegionPfoList(NULL);
+        std::string regionPfoListName;
+
+        if (STATUS_CODE_SUCCESS != pRegionPandora->m_pPfoManager->GetCurrentList(pRegionPfoList, regionPfoListName))
+            continue;
+
+        // The region pfos are transferred, rather than copied, so that pfos of any derived type reach the primary instance intact
+        const PfoList regionPfoList(*pRegionPfoList);
+        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, pRegionPandora->m_pPfoManager->ReleaseObjects(regionPfoList));
+        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, m_pPandora->m_pPfoManager->AdoptObjects(REGION_PFO_LIST_NAME, regionPfoList));
+    }
+
+    m_pPandora->m_pPfoManager->SetCurrentListName(REGION_PFO_LIST_NAME);
+
     return STATUS_CODE_SUCCESS;
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 PandoraImpl::PandoraImpl(Pandora *const pPandora) :
-    m_pPandora(pPandora)
+    m_pPandora(pPandora),
+    m_isMCParticlePreparationPending(false),
+    m_isTrackAssociationPending(false),
+    m_pPrimaryPandora(NULL)
 {
 }
 
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template StatusCode PandoraImpl::GetRegionInstance(const PandoraApi::CaloHit::Parameters &, const Pandora *&) const;
+template StatusCode PandoraImpl::GetRegionInstance(const PandoraApi::Track::Parameters &, const Pandora *&) const;
+
 } // namespace pandora
@@ -19,12 +19,21 @@ PandoraSettings::PandoraSettings(const Pandora *const pPandora) :
     m_singleHitTypeClusteringMode(false),
     m_shouldCollapseMCParticlesToPfoTarget(false),
     m_useSingleMCParticleAssociation(false),
+    m_shouldPrepareMCParticles(true),
+    m_shouldPrepareMCParticlesOnDemand(false),
+    m_shouldAssociateTracks(true),
+    m_shouldAssociateTracksOnDemand(false),
+    m_shouldRetainInputListCapacity(false),
+    m_shouldCaptureExceptionBackTrace(true),
     m_electromagneticEnergyResolution(0.2f),
     m_hadronicEnergyResolution(0.6f),
     m_mcPfoSelectionRadius(500.f),
     m_mcPfoSelectionMomentum(0.01f),
     m_mcPfoSelectionLowEnergyNPCutOff(1.2f),
     m_gapTolerance(0.f),
+    m_nThreads(1),
+    m_resourceReportObjectThreshold(0),
+    m_resourceReportMemoryThreshold(0.f),
     m_pPandora(pPandora)
 {
 }
@@ -76,6 +85,30 @@ StatusCode PandoraSettings::ReadGlobalSettings(const TiXmlHandle *const pXmlHand
     PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(*pXmlHandle,
         "UseSingleMCParticleAssociation", m_useSingleMCParticleAssociation));
 
+    m_shouldPrepareMCParticles = true;
+    PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(*pXmlHandle,
+        "ShouldPrepareMCParticles", m_shouldPrepareMCParticles));
+
+    m_shouldPrepareMCParticlesOnDemand = false;
+    PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(*pXmlHandle,
+        "ShouldPrepareMCParticlesOnDemand", m_shouldPrepareMCParticlesOnDemand));
+
+    m_shouldAssociateTracks = true;
+    PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(*pXmlHandle,
+        "ShouldAssociateTracks", m_shouldAssociateTracks));
+
+    m_shouldAssociateTracksOnDemand = false;
+    PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(*pXmlHandle,
+        "ShouldAssociateTracksOnDemand", m_shouldAssociateTracksOnDemand));
+
+    m_shouldRetainInputListCapacity = false;
+    PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(*pXmlHandle,
+        "ShouldRetainInputListCapacity", m_shouldRetainInputListCapacity));
+
+    m_shouldCaptureExceptionBackTrace = true;
+    PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(*pXmlHandle,
+        "ShouldCaptureExceptionBackTrace", m_shouldCaptureExceptionBackTrace));
+
     m_electromagneticEnergyResolution = 0.2f;
     PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(*pXmlHandle,
         "ElectromagneticEnergyResolution", m_electromagneticEnergyResolution));
@@ -102,6 +135,24 @@ StatusCode PandoraSettings::ReadGlobalSettings(const TiXmlHandle *const pXmlHand
     PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(*pXmlHandle,
         "MCPfoSelectionProtonNeutronEnergyCutOff", m_mcPfoSelectionLowEnergyNPCutOff));
 
+    m_nThreads = 1;
+    PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(*pXmlHandle,
+        "NumberOfThreads", m_nThreads));
+
+    if (0 == m_nThreads)
+        return STATUS_CODE_INVALID_PARAMETER;
+
+    m_resourceReportObjectThreshold = 0;
+    PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(*pXmlHandle,
+        "ResourceReportObjectThreshold", m_resourceReportObjectThreshold));
+
+    m_resourceReportMemoryThreshold = 0.f;
+    PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(*pXmlHandle,
+        "ResourceReportMemoryThreshold", m_resourceReportMemoryThreshold));
+
+    if (m_resourceReportMemoryThreshold < 0.f)
+        return STATUS_CODE_INVALID_PARAMETER;
+
     return STATUS_CODE_SUCCESS;
 }
 
@@ -0,0 +1,146 @@
+/**
+ *  @file   PandoraSDK/src/Pandora/PfoExportBuffer.cc
+ *
+ *  @brief  Implementation of the pfo export buffer class.
+ *
+ *  $Log: $
+ */
+
+#include "Objects/CaloHit.h"
+#include "Objects/Cluster.h"
+#include "Objects/ParticleFlowObject.h"
+#include "Objects/Track.h"
+
+#include "Pandora/PfoExportBuffer.h"
+
+#include <algorithm>
+
+namespace pandora
+{
+
+PfoExportBuffer::PfoExportBuffer()
+{
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void PfoExportBuffer::Fill(const PfoList &pfoList)
+{
+    this->Clear();
+
+    // Number the pfos in list order, with a sorted copy of the numbering used to resolve parent and daughter relationships
+    unsigned int pfoIndex(0);
+    m_pfoIndices.reserve(pfoList.size());
+
+    for (PfoList::const_iterator iter = pfoList.begin(), iterEnd = pfoList.end(); iter != iterEnd; ++iter)
+        m_pfoIndices.push_back(PfoIndexPair(*iter, pfoIndex++));
+
+    std::sort(m_pfoIndices.begin(), m_pfoIndices.end());
+
+    m_particleIds.reserve(pfoList.size());
+    m_charges.reserve(pfoList.size());
+    m_masses.reserve(pfoList.size());
+    m_energies.reserve(pfoList.size());
+    m_momentumX.reserve(pfoList.size());
+    m_momentumY.reserve(pfoList.size());
+    m_momentumZ.reserve(pfoList.size());
+    m_pfoClusterOffsets.reserve(pfoList.size() + 1);
+    m_pfoTrackOffsets.reserve(pfoList.size() + 1);
+    m_pfoParentOffsets.reserve(pfoList.size() + 1);
+    m_pfoDaughterOffsets.reserve(pfoList.size() + 1);
+
+    m_pfoClusterOffsets.push_back(0);
+    m_clusterCaloHitOffsets.push_back(0);
+    m_pfoTrackOffsets.push_back(0);
+    m_pfoParentOffsets.push_back(0);
+    m_pfoDaughterOffsets.push_back(0);
+
+    for (PfoList::const_iterator iter = pfoList.begin(), iterEnd = pfoList.end(); iter != iterEnd; ++iter)
+    {
+        const ParticleFlowObject *const pPfo = *iter;
+        const CartesianVector &momentum(pPfo->GetMomentum());
+
+        m_particleIds.push_back(pPfo->GetParticleId());
+        m_charges.push_back(pPfo->GetCharge());
+        m_masses.push_back(pPfo->GetMass());
+        m_energies.push_back(pPfo->GetEnergy());
+        m_momentumX.push_back(momentum.GetX());
+        m_momentumY.push_back(momentum.GetY());
+        m_momentumZ.push_back(momentum.GetZ());
+
+        const ClusterList &clusterList(pPfo->GetClusterList());
+
+        for (ClusterList::const_iterator clusterIter = clusterList.begin(), clusterIterEnd = clusterList.end(); clusterIter != clusterIterEnd; ++clusterIter)
+        {
+            const Cluster *const pCluster = *clusterIter;
+            const OrderedCaloHitList &orderedCaloHitList(pCluster->GetOrderedCaloHitList());
+
+            for (OrderedCaloHitList::const_iterator layerIter = orderedCaloHitList.begin(), layerIterEnd = orderedCaloHitList.end();
+                layerIter != layerIterEnd; ++layerIter)
+            {
+                for (CaloHitList::const_iterator hitIter = layerIter->second->begin(), hitIterEnd = layerIter->second->end(); hitIter != hitIterEnd; ++hitIter)
+                    m_caloHitAddresses.push_back((*hitIter)->GetParentCaloHitAddress());
+            }
+
+            const CaloHitList &isolatedCaloHitList(pCluster->GetIsolatedCaloHitList());
+
+            for (CaloHitList::const_iterator hitIter = isolatedCaloHitList.begin(), hitIterEnd = isolatedCaloHitList.end(); hitIter != hitIterEnd; ++hitIter)
+                m_caloHitAddresses.push_back((*hitIter)->GetParentCaloHitAddress());
+
+            m_clusterCaloHitOffsets.push_back(m_caloHitAddresses.size());
+        }
+
+        m_pfoClusterOffsets.push_back(m_clusterCaloHitOffsets.size() - 1);
+
+        const TrackList &trackList(pPfo->GetTrackList());
+
+        for (TrackList::const_iterator trackIter = trackList.begin(), trackIterEnd = trackList.end(); trackIter != trackIterEnd; ++trackIter)
+            m_trackAddresses.push_back((*trackIter)->GetParentTrackAddress());
+
+        m_pfoTrackOffsets.push_back(m_trackAddresses.size());
+
+        this->AppendPfoIndices(pPfo->GetParentPfoList(), m_parentPfoIndices);
+        m_pfoParentOffsets.push_back(m_parentPfoIndices.size());
+
+        this->AppendPfoIndices(pPfo->GetDaughterPfoList(), m_daughterPfoIndices);
+        m_pfoDaughterOffsets.push_back(m_daughterPfoIndices.size());
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void PfoExportBuffer::Clear()
+{
+    m_particleIds.clear();
+    m_charges.clear();
+    m_masses.clear();
+    m_energies.clear();
+    m_momentumX.clear();
+    m_momentumY.clear();
+    m_momentumZ.clear();
+    m_pfoClusterOffsets.clear();
+    m_clusterCaloHitOffsets.clear();
+    m_caloHitAddresses.clear();
+    m_pfoTrackOffsets.clear();
+    m_trackAddresses.clear();
+    m_pfoParentOffsets.clear();
+    m_parentPfoIndices.clear();
+    m_pfoDaughterOffsets.clear();
+    m_daughterPfoIndices.clear();
+    m_pfoIndices.clear();
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void PfoExportBuffer::AppendPfoIndices(const PfoList &relatedPfoList, UIntVector &pfoIndices) const
+{
+    for (PfoList::const_iterator iter = relatedPfoList.begin(), iterEnd = relatedPfoList.end(); iter != iterEnd; ++iter)
+    {
+        PfoIndexVector::const_iterator indexIter = std::lower_bound(m_pfoIndices.begin(), m_pfoIndices.end(), PfoIndexPair(*iter, 0));
+
+        if ((m_pfoIndices.end() != indexIter) && (*iter == indexIter->first))
+            pfoIndices.push_back(indexIter->second);
+    }
+}
+
+} // namespace pandora
@@ -0,0 +1,112 @@
+/**
+ *  @file   PandoraSDK/src/Pandora/StatusCodes.cc
+ *
+ *  @brief  Implementation of the status code exception class.
+ *
+ *  $Log: $
+ */
+
+#include "Pandora/StatusCodes.h"
+
+#if defined(__GNUC__) && defined(BACKTRACE)
+    #include <cstdlib>
+    #include <execinfo.h>
+#endif
+
+namespace pandora
+{
+
+#if __cplusplus > 199711L
+std::atomic<bool> StatusCodeException::m_shouldCaptureBackTrace(true);
+std::atomic<unsigned int> StatusCodeException::m_nExceptionsThrown(0);
+thread_local std::atomic<unsigned int> *StatusCodeException::m_pThreadExceptionCounter = NULL;
+#else
+bool StatusCodeException::m_shouldCaptureBackTrace = true;
+unsigned int StatusCodeException::m_nExceptionsThrown = 0;
+#endif
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCodeException::StatusCodeException(const StatusCode statusCode) :
+    m_statusCode(statusCode)
+{
+    ++m_nExceptionsThrown;
+
+#if __cplusplus > 199711L
+    if (NULL != m_pThreadExceptionCounter)
+        ++(*m_pThreadExceptionCounter);
+#endif
+
+#if defined(__GNUC__) && defined(BACKTRACE)
+    if (m_shouldCaptureBackTrace)
+    {
+        void *stackAddresses[MAX_BACKTRACE_DEPTH];
+        const int stackDepth(backtrace(stackAddresses, MAX_BACKTRACE_DEPTH));
+        m_stackAddresses.assign(stackAddresses, stackAddresses + stackDepth);
+    }
+#endif
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+const std::string &StatusCodeException::GetBackTrace() const
+{
+#if defined(__GNUC__) && defined(BACKTRACE)
+    const unsigned int stackDepth(m_stackAddresses.size());
+
+    if (m_backTrace.empty() && (stackDepth > 1))
+    {
+        char **stackStrings = backtrace_symbols(&m_stackAddresses[0], stackDepth);
+
+        if (NULL != stackStrings)
+        {
+            m_backTrace = "\nBackTrace\n    ";
+
+            for (unsigned int i = 1; i < stackDepth; ++i)
+            {
+                m_backTrace += stackStrings[i];
+                m_backTrace += "\n    ";
+            }
+
+            free(stackStrings); // malloc()ed by backtrace_symbols
+        }
+    }
+#endif
+
+    return m_backTrace;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void StatusCodeException::SetShouldCaptureBackTrace(const bool shouldCaptureBackTrace)
+{
+    m_shouldCaptureBackTrace = shouldCaptureBackTrace;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+unsigned int StatusCodeException::GetNExceptionsThrown()
+{
+    return m_nExceptionsThrown;
+}
+
+#if __cplusplus > 199711L
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+std::atomic<unsigned int> *StatusCodeException::SetThreadExceptionCounter(std::atomic<unsigned int> *const pExceptionCounter)
+{
+    std::atomic<unsigned int> *const pPreviousExceptionCounter(m_pThreadExceptionCounter);
+    m_pThreadExceptionCounter = pExceptionCounter;
+
+    return pPreviousExceptionCounter;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+std::atomic<unsigned int> *StatusCodeException::GetThreadExceptionCounter()
+{
+    return m_pThreadExceptionCounter;
+}
+#endif
+
+} // namespace pandora
@@ -0,0 +1,314 @@
+/**
+ *  @file   PandoraSDK/src/Pandora/ThreadPool.cc
+ *
+ *  @brief  Implementation of the thread pool class.
+ *
+ *  $Log: $
+ */
+
+#include "Pandora/ThreadPool.h"
+
+#include <algorithm>
+
+#if __cplusplus > 199711L
+    #include <atomic>
+    #include <condition_variable>
+    #include <mutex>
+    #include <thread>
+#endif
+
+namespace pandora
+{
+
+#if __cplusplus > 199711L
+/**
+ *  @brief  Workers class, holding the worker threads and the state of the current parallel loop
+ */
+class ThreadPool::Workers
+{
+public:
+    /**
+     *  @brief  Constructor, starting the worker threads
+     *
+     *  @param  nWorkers the number of worker threads
+     */
+    Workers(const unsigned int nWorkers);
+
+    /**
+     *  @brief  Destructor, stopping the worker threads
+     */
+    ~Workers();
+
+    /**
+     *  @brief  Run a task for each index in the range [0, nIndices), using the worker threads and the calling thread
+     *
+     *  @param  nIndices the number of indices
+     *  @param  task the task
+     */
+    StatusCode ParallelFor(const unsigned int nIndices, const Task &task);
+
+    /**
+     *  @brief  Whether the calling thread is currently running a task from a parallel loop
+     *
+     *  @return boolean
+     */
+    static bool IsInParallelFor();
+
+private:
+    /**
+     *  @brief  Wait for, and take part in, parallel loops until the pool is destroyed
+     */
+    void RunWorker();
+
+    /**
+     *  @brief  Take chunks of indices from the current parallel loop and run the task for them, until no indices remain
+     */
+    void ProcessIndices();
+
+    typedef std::vector<std::thread> ThreadVector;
+
+    ThreadVector                m_threads;              ///< The worker threads
+    std::mutex                  m_submissionMutex;      ///< The mutex allowing only a single parallel loop at a time
+    std::mutex                  m_mutex;                ///< The mutex protecting the loop state
+    std::condition_variable     m_startCondition;       ///< Signalled when a parallel loop starts, or the pool is destroyed
+    std::condition_variable     m_doneCondition;        ///< Signalled when the last worker leaves a parallel loop
+    unsigned int                m_generation;           ///< The number of parallel loops started so far
+    unsigned int                m_nBusyWorkers;         ///< The number of worker threads yet to leave the current loop
+    bool                        m_shouldStop;           ///< Whether the worker threads should stop
+    const Task                 *m_pTask;                ///< Address of the task for the current loop
+    unsigned int                m_nIndices;             ///< The number of indices in the current loop
+    unsigned int                m_chunkSize;            ///< The number of indices taken by a thread at a time
+    std::atomic<unsigned int>   m_nextIndex;            ///< The next index to be taken in the current loop
+    std::atomic<bool>           m_hasFailed;            ///< Whether any task in the current loop has failed
+    StatusCode                  m_statusCode;           ///< The first failure status code in the current loop
+    std::atomic<unsigned int>  *m_pExceptionCounter;    ///< The exception counter of the thread that started the current loop
+
+    static thread_local bool    m_isInParallelFor;      ///< Whether the current thread is running a task from a parallel loop
+};
+
+thread_local bool ThreadPool::Workers::m_isInParallelFor = false;
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+ThreadPool::Workers::Workers(const unsigned int nWorkers) :
+    m_generation(0),
+    m_nBusyWorkers(0),
+    m_shouldStop(false),
+    m_pTask(NULL),
+    m_nIndices(0),
+    m_chunkSize(1),
+    m_nextIndex(0),
+    m_hasFailed(false),
+    m_statusCode(STATUS_CODE_SUCCESS),
+    m_pExceptionCounter(NULL)
+{
+    for (unsigned int i = 0; i < nWorkers; ++i)
+        m_threads.push_back(std::thread(&Workers::RunWorker, this));
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+ThreadPool::Workers::~Workers()
+{
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_shouldStop = true;
+    }
+
+    m_startCondition.notify_all();
+
+    for (ThreadVector::iterator iter = m_threads.begin(), iterEnd = m_threads.end(); iter != iterEnd; ++iter)
+        iter->join();
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode ThreadPool::Workers::ParallelFor(const unsigned int nIndices, const Task &task)
+{
+    std::unique_lock<std::mutex> submissionLock(m_submissionMutex);
+
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_pTask = &task;
+        m_nIndices = nIndices;
+        m_chunkSize = std::max(1U, nIndices / (4 * (static_cast<unsigned int>(m_threads.size()) + 1)));
+        m_nextIndex.store(0);
+        m_hasFailed.store(false);
+        m_statusCode = STATUS_CODE_SUCCESS;
+        m_pExceptionCounter = StatusCodeException::GetThreadExceptionCounter();
+        m_nBusyWorkers = m_threads.size();
+        ++m_generation;
+    }
+
+    m_startCondition.notify_all();
+    this->ProcessIndices();
+
+    std::unique_lock<std::mutex> lock(m_mutex);
+
+    while (m_nBusyWorkers > 0)
+        m_doneCondition.wait(lock);
+
+    m_pTask = NULL;
+    m_pExceptionCounter = NULL;
+
+    return m_statusCode;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+bool ThreadPool::Workers::IsInParallelFor()
+{
+    return m_isInParallelFor;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void ThreadPool::Workers::RunWorker()
+{
+    unsigned int generation(0);
+
+    while (true)
+    {
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+
+            while (!m_shouldStop && (generation == m_generation))
+                m_startCondition.wait(lock);
+
+            if (m_shouldStop)
+                return;
+
+            generation = m_generation;
+        }
+
+        this->ProcessIndices();
+
+        bool isLastWorker(false);
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            isLastWorker = (0 == --m_nBusyWorkers);
+        }
+
+        if (isLastWorker)
+            m_doneCondition.notify_one();
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void ThreadPool::Workers::ProcessIndices()
+{
+    // Exceptions constructed by the tasks are counted as though constructed by the thread that started the loop
+    std::atomic<unsigned int> *const pThreadExceptionCounter(StatusCodeException::SetThreadExceptionCounter(m_pExceptionCounter));
+    m_isInParallelFor = true;
+
+    while (!m_hasFailed.load(std::memory_order_relaxed))
+    {
+        const unsigned int beginIndex(m_nextIndex.fetch_add(m_chunkSize));
+
+        if (beginIndex >= m_nIndices)
+            break;
+
+        const unsigned int endIndex(std::min(m_nIndices, beginIndex + m_chunkSize));
+        const StatusCode statusCode(ThreadPool::RunTask(beginIndex, endIndex, *m_pTask));
+
+        if (STATUS_CODE_SUCCESS != statusCode)
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+
+            if (!m_hasFailed.exchange(true))
+                m_statusCode = statusCode;
+        }
+    }
+
+    m_isInParallelFor = false;
+    StatusCodeException::SetThreadExceptionCounter(pThreadExceptionCounter);
+}
+#endif
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+ThreadPool::ThreadPool() :
+    m_nThreads(1),
+    m_pWorkers(NULL)
+{
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+ThreadPool::~ThreadPool()
+{
+#if __cplusplus > 199711L
+    delete m_pWorkers;
+#endif
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode ThreadPool::ParallelFor(const unsigned int nIndices, const Task &task) const
+{
+    if (0 == nIndices)
+        return STATUS_CODE_SUCCESS;
+
+#if __cplusplus > 199711L
+    if ((NULL != m_pWorkers) && (nIndices > 1) && !Workers::IsInParallelFor())
+        return m_pWorkers->ParallelFor(nIndices, task);
+#endif
+
+    return ThreadPool::RunTask(0, nIndices, task);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode ThreadPool::SetNThreads(const unsigned int nThreads)
+{
+    if (0 == nThreads)
+        return STATUS_CODE_INVALID_PARAMETER;
+
+    if (nThreads == m_nThreads)
+        return STATUS_CODE_SUCCESS;
+
+#if __cplusplus > 199711L
+    delete m_pWorkers;
+    m_pWorkers = NULL;
+
+    if (nThreads > 1)
+        m_pWorkers = new Workers(nThreads - 1);
+
+    m_nThreads = nThreads;
+#else
+    if (nThreads > 1)
+        std::cout << "ThreadPool: NumberOfThreads requires c++11, tasks will be run on the calling thread " << std::endl;
+#endif
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode ThreadPool::RunTask(const unsigned int beginIndex, const unsigned int endIndex, const Task &task)
+{
+    for (unsigned int index = beginIndex; index < endIndex; ++index)
+    {
+        try
+        {
+            const StatusCode statusCode(task.Run(index));
+
+            if (STATUS_CODE_SUCCESS != statusCode)
+                return statusCode;
+        }
+        catch (StatusCodeException &statusCodeException)
+        {
+            return statusCodeException.GetStatusCode();
+        }
+        catch (...)
+        {
+            return STATUS_CODE_FAILURE;
+        }
+    }
+
+    return STATUS_CODE_SUCCESS;
+}
+
+} // namespace pandora
@@ -0,0 +1,284 @@
+/**
+ *  @file   PandoraSDK/src/Persistency/ApiRecorder.cc
+ *
+ *  @brief  Implementation of the api recorder class.
+ *
+ *  $Log: $
+ */
+
+#include "Persistency/ApiRecorder.h"
+
+#include <sstream>
+
+namespace pandora
+{
+
+ApiRecorder::ApiRecorder(const std::string &traceFileName)
+{
+    m_fileStream.open(traceFileName.c_str(), std::ios::out | std::ios::binary | std::ios::trunc);
+
+    if (!m_fileStream.is_open() || !m_fileStream.good())
+        throw StatusCodeException(STATUS_CODE_FAILURE);
+
+    PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->WriteVariable(PANDORA_TRACE_HASH));
+    PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->WriteVariable(PANDORA_TRACE_VERSION));
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+ApiRecorder::~ApiRecorder()
+{
+    m_fileStream.close();
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode ApiRecorder::Record(const PandoraApi::CaloHit::Parameters &parameters,
+    const ObjectFactory<PandoraApi::CaloHit::Parameters, PandoraApi::CaloHit::Object> &factory)
+{
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->WriteRecordId(RECORD_CALO_HIT));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->WriteFactoryFlag(factory));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->WriteInput(parameters.m_positionVector));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->WriteInput(parameters.m_expectedDirection));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->WriteInput(parameters.m_cellNormalVector));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->WriteInput(parameters.m_cellGeometry));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->WriteInput(parameters.m_cellSize0));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->WriteInput(parameters.m_cellSize1));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->WriteInput(parameters.m_cellThickness));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->WriteInput(parameters.m_nCellRadiationLengths));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->WriteInput(parameters.m_nCellInteractionLengths));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->WriteInput(parameters.m_time));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->WriteInput(parameters.m_inputEnergy));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->WriteInput(parameters.m_mipEquivalentEnergy));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->WriteInput(parameters.m_electromagneticEnergy));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->WriteInput(parameters.m_hadronicEnergy));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->WriteInput(parameters.m_isDigital));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->WriteInput(parameters.m_hitType));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->WriteInput(parameters.m_hitRegion));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->WriteInput(parameters.m_layer));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->WriteInput(parameters.m_isInOuterSamplingLayer));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->WriteInput(parameters.m_pParentAddress));
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode ApiRecorder::Record(const PandoraApi::Track::Parameters &parameters,
+    const ObjectFactory<PandoraApi::Track::Parameters, PandoraApi::Track::Object> &factory)
+{
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->WriteRecordId(RECORD_TRACK));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->WriteFactoryFlag(factory));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->WriteInput(parameters.m_d0));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->WriteInput(parameters.m_z0));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->WriteInput(parameters.m_particleId));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->WriteInput(parameters.m_charge));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->WriteInput(parameters.m_mass));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->WriteInput(parameters.m_momentumAtDca));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->WriteInput(parameters.m_trackStateAtStart));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->WriteInput(parameters.m_trackStateAtEnd));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->WriteInput(parameters.m_trackStateAtCalorimeter));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->WriteInput(parameters.m_timeAtCalorimeter));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->WriteInput(parameters.m_reachesCalorimeter));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->WriteInput(parameters.m_isProjectedToEndCap));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->WriteInput(parameters.m_canFormPfo));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->WriteInput(parameters.m_canFormClusterlessPfo));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->WriteInput(parameters.m_pParentAddress));
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode ApiRecorder::Record(const PandoraApi::MCParticle::Parameters &parameters,
+    const ObjectFactory<PandoraApi::MCParticle::Parameters, PandoraApi::MCParticle::Object> &factory)
+{
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->WriteRecordId(RECORD_MC_PARTICLE));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->WriteFactoryFlag(factory));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->WriteInput(parameters.m_energy));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->WriteInput(parameters.m_momentum));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->WriteInput(parameters.m_vertex));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->WriteInput(parameters.m_endpoint));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->WriteInput(parameters.m_particleId));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->WriteInput(parameters.m_mcParticleType));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->WriteInput(parameters.m_pParentAddress));
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode ApiRecorder::Record(const PandoraApi::Geometry::SubDetector::Parameters &parameters,
+    const ObjectFactory<PandoraApi::Geometry::SubDetector::Parameters, PandoraApi::Geometry::SubDetector::Object> &factory)
+{
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->WriteRecordId(RECORD_SUB_DETECTOR));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->WriteFactoryFlag(factory));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->WriteInput(parameters.m_subDetectorName));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->WriteInput(parameters.m_subDetectorType));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->WriteInput(parameters.m_innerRCoordinate));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->WriteInput(parameters.m_innerZCoordinate));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->WriteInput(parameters.m_innerPhiCoordinate));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->WriteInput(parameters.m_innerSymmetryOrder));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->WriteInput(parameters.m_outerRCoordinate));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->WriteInput(parameters.m_outerZCoordinate));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->WriteInput(parameters.m_outerPhiCoordinate));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->WriteInput(parameters.m_outerSymmetryOrder));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->WriteInput(parameters.m_isMirroredInZ));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->WriteInput(parameters.m_nLayers));
+
+    const unsigned int nLayerParameters(parameters.m_layerParametersList.size());
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->WriteVariable(nLayerParameters));
+
+    for (PandoraApi::Geometry::LayerParametersList::const_iterator iter = parameters.m_layerParametersList.begin(),
+        iterEnd = parameters.m_layerParametersList.end(); iter != iterEnd; ++iter)
+    {
+        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->WriteInput(iter->m_closestDistanceToIp));
+        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->WriteInput(iter->m_nRadiationLengths));
+        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->WriteInput(iter->m_nInteractionLengths));
+    }
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode ApiRecorder::Record(const PandoraApi::Geometry::LineGap::Parameters &parameters,
+    const ObjectFactory<PandoraApi::Geometry::LineGap::Parameters, PandoraApi::Geometry::LineGap::Object> &factory)
+{
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->WriteRecordId(RECORD_LINE_GAP));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->WriteFactoryFlag(factory));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->WriteInput(parameters.m_hitType));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->WriteInput(parameters.m_lineStartZ));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->WriteInput(parameters.m_lineEndZ));
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode ApiRecorder::Record(const PandoraApi::Geometry::BoxGap::Parameters &parameters,
+    const ObjectFactory<PandoraApi::Geometry::BoxGap::Parameters, PandoraApi::Geometry::BoxGap::Object> &factory)
+{
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->WriteRecordId(RECORD_BOX_GAP));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->WriteFactoryFlag(factory));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->WriteInput(parameters.m_vertex));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->WriteInput(parameters.m_side1));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->WriteInput(parameters.m_side2));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->WriteInput(parameters.m_side3));
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode ApiRecorder::Record(const PandoraApi::Geometry::ConcentricGap::Parameters &parameters,
+    const ObjectFactory<PandoraApi::Geometry::ConcentricGap::Parameters, PandoraApi::Geometry::ConcentricGap::Object> &factory)
+{
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->WriteRecordId(RECORD_CONCENTRIC_GAP));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->WriteFactoryFlag(factory));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->WriteInput(parameters.m_minZCoordinate));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->WriteInput(parameters.m_maxZCoordinate));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->WriteInput(parameters.m_innerRCoordinate));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->WriteInput(parameters.m_innerPhiCoordinate));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->WriteInput(parameters.m_innerSymmetryOrder));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->WriteInput(parameters.m_outerRCoordinate));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->WriteInput(parameters.m_outerPhiCoordinate));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->WriteInput(parameters.m_outerSymmetryOrder));
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode ApiRecorder::RecordRelationship(const RelationshipId relationshipId, const void *const address1, const void *const address2,
+    const float weight)
+{
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->WriteRecordId(RECORD_RELATIONSHIP));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->WriteVariable(relationshipId));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->WriteVariable(address1));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->WriteVariable(address2));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->WriteVariable(weight));
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode ApiRecorder::RecordSettings(const std::string &xmlFileName)
+{
+    std::ifstream xmlFileStream(xmlFileName.c_str(), std::ios::in);
+
+    if (!xmlFileStream.is_open() || !xmlFileStream.good())
+    {
+        std::cout << "ApiRecorder::RecordSettings - unable to read settings file " << xmlFileName << std::endl;
+        return STATUS_CODE_FAILURE;
+    }
+
+    std::ostringstream xmlContent;
+    xmlContent << xmlFileStream.rdbuf();
+
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->WriteRecordId(RECORD_SETTINGS));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->WriteVariable(xmlFileName));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->WriteVariable(xmlContent.str()));
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode ApiRecorder::RecordHitTypeGranularity(const HitType hitType, const Granularity granularity)
+{
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->WriteRecordId(RECORD_HIT_TYPE_GRANULARITY));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->WriteVariable(hitType));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->WriteVariable(granularity));
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode ApiRecorder::RecordProcessEvent()
+{
+    return this->WriteRecordId(RECORD_PROCESS_EVENT);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode ApiRecorder::RecordReset()
+{
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->WriteRecordId(RECORD_RESET));
+
+    // Event boundary: ensure the trace is complete on disk, even if the client framework terminates abruptly
+    m_fileStream.flush();
+
+    if (!m_fileStream.good())
+        return STATUS_CODE_FAILURE;
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode ApiRecorder::RecordAdvanceSlidingWindow(const float windowStartTime)
+{
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->WriteRecordId(RECORD_ADVANCE_SLIDING_WINDOW));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->WriteVariable(windowStartTime));
+
+    // Time slice boundary, treated as an event boundary
+    m_fileStream.flush();
+
+    if (!m_fileStream.good())
+        return STATUS_CODE_FAILURE;
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode ApiRecorder::WriteRecordId(const ApiRecordId apiRecordId)
+{
+    const unsigned char recordId(static_cast<unsigned char>(apiRecordId));
+    return this->WriteVariable(recordId);
+}
+
+} // namespace pandora
@@ -0,0 +1,430 @@
+/**
+ *  @file   PandoraSDK/src/Persistency/ApiReplayer.cc
+ *
+ *  @brief  Implementation of the api replayer class.
+ *
+ *  $Log: $
+ */
+
+#include "Api/PandoraApiImpl.h"
+
+#include "Persistency/ApiReplayer.h"
+
+#include "Xml/tinyxml.h"
+
+#include <fstream>
+
+namespace pandora
+{
+
+ApiReplayer::ApiReplayer(const pandora::Pandora &pandora, const std::string &traceFileName) :
+    m_pPandora(&pandora),
+    m_position(0),
+    m_nEventsReplayed(0),
+    m_pCaloHitFactory(NULL),
+    m_pTrackFactory(NULL),
+    m_pMCParticleFactory(NULL)
+{
+    std::ifstream fileStream(traceFileName.c_str(), std::ios::in | std::ios::binary);
+
+    if (!fileStream.is_open() || !fileStream.good())
+        throw StatusCodeException(STATUS_CODE_FAILURE);
+
+    fileStream.seekg(0, std::ios::end);
+    const std::ifstream::pos_type fileSize(fileStream.tellg());
+    fileStream.seekg(0, std::ios::beg);
+
+    m_traceBuffer.resize(static_cast<size_t>(fileSize));
+
+    if (!m_traceBuffer.empty())
+        fileStream.read(&m_traceBuffer[0], fileSize);
+
+    if (!fileStream.good())
+        throw StatusCodeException(STATUS_CODE_FAILURE);
+
+    std::string traceHash;
+    PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->ReadVariable(traceHash));
+
+    if (PANDORA_TRACE_HASH != traceHash)
+        throw StatusCodeException(STATUS_CODE_FAILURE);
+
+    unsigned int traceVersion(0);
+    PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->ReadVariable(traceVersion));
+
+    if (PANDORA_TRACE_VERSION != traceVersion)
+    {
+        std::cout << "ApiReplayer: unsupported trace version " << traceVersion << std::endl;
+        throw StatusCodeException(STATUS_CODE_INVALID_PARAMETER);
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode ApiReplayer::ReplayNextEvent()
+{
+    // Replayed calls must not be recorded again, which would append the replayed input to any trace being written by the instance
+    PandoraApiImpl *const pPandoraApiImpl(m_pPandora->m_pPandoraApiImpl);
+    ApiRecorder *const pApiRecorder(pPandoraApiImpl->SetApiRecorder(NULL));
+    StatusCode statusCode(STATUS_CODE_FAILURE);
+
+    try
+    {
+        statusCode = this->ReplayEventRecords();
+    }
+    catch (...)
+    {
+        pPandoraApiImpl->SetApiRecorder(pApiRecorder);
+        throw;
+    }
+
+    pPandoraApiImpl->SetApiRecorder(pApiRecorder);
+    return statusCode;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode ApiReplayer::ReplayEventRecords()
+{
+    ApiRecordId apiRecordId(UNKNOWN_RECORD);
+    const StatusCode firstStatusCode(this->ReplayNextRecord(apiRecordId));
+
+    if (STATUS_CODE_SUCCESS != firstStatusCode)
+        return firstStatusCode;
+
+    while ((RECORD_RESET != apiRecordId) && (RECORD_ADVANCE_SLIDING_WINDOW != apiRecordId))
+    {
+        const StatusCode statusCode(this->ReplayNextRecord(apiRecordId));
+
+        // Tolerate a trace that ends without a final reset, e.g. if the client framework did not reset after its last event
+        if (STATUS_CODE_NOT_FOUND == statusCode)
+            break;
+
+        if (STATUS_CODE_SUCCESS != statusCode)
+            return statusCode;
+    }
+
+    ++m_nEventsReplayed;
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode ApiReplayer::ReplayAll()
+{
+    StatusCode statusCode(STATUS_CODE_SUCCESS);
+
+    while (STATUS_CODE_SUCCESS == statusCode)
+        statusCode = this->ReplayNextEvent();
+
+    if (STATUS_CODE_NOT_FOUND != statusCode)
+        return statusCode;
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode ApiReplayer::ReplayNextRecord(ApiRecordId &apiRecordId)
+{
+    unsigned char recordId(0);
+
+    // Clean end of trace is indicated by absence of any further record identifier
+    if (STATUS_CODE_SUCCESS != this->ReadVariable(recordId))
+        return STATUS_CODE_NOT_FOUND;
+
+    apiRecordId = static_cast<ApiRecordId>(recordId);
+
+    StatusCode statusCode(STATUS_CODE_FAILURE);
+
+    switch (apiRecordId)
+    {
+    case RECORD_CALO_HIT:
+        statusCode = this->ReplayObject(m_pCaloHitFactory);
+        break;
+    case RECORD_TRACK:
+        statusCode = this->ReplayObject(m_pTrackFactory);
+        break;
+    case RECORD_MC_PARTICLE:
+        statusCode = this->ReplayObject(m_pMCParticleFactory);
+        break;
+    case RECORD_RELATIONSHIP:
+        statusCode = this->ReplayRelationship();
+        break;
+    case RECORD_SUB_DETECTOR:
+        statusCode = this->ReplayObject<PandoraApi::Geometry::SubDetector::Parameters, PandoraApi::Geometry::SubDetector::Object>(NULL);
+        break;
+    case RECORD_LINE_GAP:
+        statusCode = this->ReplayObject<PandoraApi::Geometry::LineGap::Parameters, PandoraApi::Geometry::LineGap::Object>(NULL);
+        break;
+    case RECORD_BOX_GAP:
+        statusCode = this->ReplayObject<PandoraApi::Geometry::BoxGap::Parameters, PandoraApi::Geometry::BoxGap::Object>(NULL);
+        break;
+    case RECORD_CONCENTRIC_GAP:
+        statusCode = this->ReplayObject<PandoraApi::Geometry::ConcentricGap::Parameters, PandoraApi::Geometry::ConcentricGap::Object>(NULL);
+        break;
+    case RECORD_SETTINGS:
+        statusCode = this->ReplaySettings();
+        break;
+    case RECORD_HIT_TYPE_GRANULARITY:
+        statusCode = this->ReplayHitTypeGranularity();
+        break;
+    case RECORD_PROCESS_EVENT:
+        statusCode = PandoraApi::ProcessEvent(*m_pPandora);
+        break;
+    case RECORD_RESET:
+        statusCode = PandoraApi::Reset(*m_pPandora);
+        break;
+    case RECORD_ADVANCE_SLIDING_WINDOW:
+        statusCode = this->ReplayAdvanceSlidingWindow();
+        break;
+    default:
+        std::cout << "ApiReplayer: unrecognized record in trace " << static_cast<unsigned int>(recordId) << std::endl;
+        return STATUS_CODE_FAILURE;
+    }
+
+    // A record truncated by the end of the trace is corrupt, rather than a clean end of trace
+    if (STATUS_CODE_NOT_FOUND == statusCode)
+        return STATUS_CODE_FAILURE;
+
+    return statusCode;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template<typename PARAMETERS, typename OBJECT>
+StatusCode ApiReplayer::ReplayObject(const ObjectFactory<PARAMETERS, OBJECT> *const pCustomFactory)
+{
+    bool isCustomFactory(false);
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->ReadVariable(isCustomFactory));
+
+    if (isCustomFactory && (NULL == pCustomFactory))
+    {
+        std::cout << "ApiReplayer: object recorded using a custom factory, but no equivalent factory has been provided" << std::endl;
+        return STATUS_CODE_NOT_INITIALIZED;
+    }
+
+    // Parameters are allocated by the chosen factory, so that any derived parameters it expects are present, if left unset
+    const PandoraObjectFactory<PARAMETERS, OBJECT> pandoraFactory;
+    const ObjectFactory<PARAMETERS, OBJECT> &factory(isCustomFactory ? *pCustomFactory : pandoraFactory);
+    PARAMETERS *const pParameters(factory.NewParameters());
+
+    StatusCode statusCode(this->ReadParameters(*pParameters));
+
+    if (STATUS_CODE_SUCCESS == statusCode)
+        statusCode = PandoraApi::ObjectCreationHelper<PARAMETERS, OBJECT>::Create(*m_pPandora, *pParameters, factory);
+
+    delete pParameters;
+    return statusCode;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode ApiReplayer::ReadParameters(PandoraApi::CaloHit::Parameters &parameters)
+{
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->ReadInput(parameters.m_positionVector));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->ReadInput(parameters.m_expectedDirection));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->ReadInput(parameters.m_cellNormalVector));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->ReadInput(parameters.m_cellGeometry));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->ReadInput(parameters.m_cellSize0));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->ReadInput(parameters.m_cellSize1));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->ReadInput(parameters.m_cellThickness));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->ReadInput(parameters.m_nCellRadiationLengths));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->ReadInput(parameters.m_nCellInteractionLengths));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->ReadInput(parameters.m_time));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->ReadInput(parameters.m_inputEnergy));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->ReadInput(parameters.m_mipEquivalentEnergy));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->ReadInput(parameters.m_electromagneticEnergy));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->ReadInput(parameters.m_hadronicEnergy));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->ReadInput(parameters.m_isDigital));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->ReadInput(parameters.m_hitType));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->ReadInput(parameters.m_hitRegion));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->ReadInput(parameters.m_layer));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->ReadInput(parameters.m_isInOuterSamplingLayer));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->ReadInput(parameters.m_pParentAddress));
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode ApiReplayer::ReadParameters(PandoraApi::Track::Parameters &parameters)
+{
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->ReadInput(parameters.m_d0));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->ReadInput(parameters.m_z0));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->ReadInput(parameters.m_particleId));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->ReadInput(parameters.m_charge));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->ReadInput(parameters.m_mass));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->ReadInput(parameters.m_momentumAtDca));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->ReadInput(parameters.m_trackStateAtStart));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->ReadInput(parameters.m_trackStateAtEnd));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->ReadInput(parameters.m_trackStateAtCalorimeter));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->ReadInput(parameters.m_timeAtCalorimeter));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->ReadInput(parameters.m_reachesCalorimeter));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->ReadInput(parameters.m_isProjectedToEndCap));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->ReadInput(parameters.m_canFormPfo));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->ReadInput(parameters.m_canFormClusterlessPfo));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->ReadInput(parameters.m_pParentAddress));
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode ApiReplayer::ReadParameters(PandoraApi::MCParticle::Parameters &parameters)
+{
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->ReadInput(parameters.m_energy));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->ReadInput(parameters.m_momentum));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->ReadInput(parameters.m_vertex));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->ReadInput(parameters.m_endpoint));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->ReadInput(parameters.m_particleId));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->ReadInput(parameters.m_mcParticleType));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->ReadInput(parameters.m_pParentAddress));
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode ApiReplayer::ReplayRelationship()
+{
+    RelationshipId relationshipId(UNKNOWN_RELATIONSHIP);
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->ReadVariable(relationshipId));
+    const void *address1(NULL);
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->ReadVariable(address1));
+    const void *address2(NULL);
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->ReadVariable(address2));
+    float weight(1.f);
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->ReadVariable(weight));
+
+    switch (relationshipId)
+    {
+    case CALO_HIT_TO_MC:
+        return PandoraApi::SetCaloHitToMCParticleRelationship(*m_pPandora, address1, address2, weight);
+    case TRACK_TO_MC:
+        return PandoraApi::SetTrackToMCParticleRelationship(*m_pPandora, address1, address2, weight);
+    case MC_PARENT_DAUGHTER:
+        return PandoraApi::SetMCParentDaughterRelationship(*m_pPandora, address1, address2);
+    case TRACK_PARENT_DAUGHTER:
+        return PandoraApi::SetTrackParentDaughterRelationship(*m_pPandora, address1, address2);
+    case TRACK_SIBLING:
+        return PandoraApi::SetTrackSiblingRelationship(*m_pPandora, address1, address2);
+    default:
+        return STATUS_CODE_FAILURE;
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode ApiReplayer::ReadParameters(PandoraApi::Geometry::SubDetector::Parameters &parameters)
+{
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->ReadInput(parameters.m_subDetectorName));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->ReadInput(parameters.m_subDetectorType));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->ReadInput(parameters.m_innerRCoordinate));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->ReadInput(parameters.m_innerZCoordinate));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->ReadInput(parameters.m_innerPhiCoordinate));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->ReadInput(parameters.m_innerSymmetryOrder));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->ReadInput(parameters.m_outerRCoordinate));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->ReadInput(parameters.m_outerZCoordinate));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->ReadInput(parameters.m_outerPhiCoordinate));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->ReadInput(parameters.m_outerSymmetryOrder));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->ReadInput(parameters.m_isMirroredInZ));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->ReadInput(parameters.m_nLayers));
+
+    unsigned int nLayerParameters(0);
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->ReadVariable(nLayerParameters));
+
+    for (unsigned int iLayer = 0; iLayer < nLayerParameters; ++iLayer)
+    {
+        PandoraApi::Geometry::LayerParameters layerParameters;
+        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->ReadInput(layerParameters.m_closestDistanceToIp));
+        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->ReadInput(layerParameters.m_nRadiationLengths));
+        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->ReadInput(layerParameters.m_nInteractionLengths));
+        parameters.m_layerParametersList.push_back(layerParameters);
+    }
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode ApiReplayer::ReadParameters(PandoraApi::Geometry::LineGap::Parameters &parameters)
+{
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->ReadInput(parameters.m_hitType));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->ReadInput(parameters.m_lineStartZ));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->ReadInput(parameters.m_lineEndZ));
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode ApiReplayer::ReadParameters(PandoraApi::Geometry::BoxGap::Parameters &parameters)
+{
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->ReadInput(parameters.m_vertex));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->ReadInput(parameters.m_side1));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->ReadInput(parameters.m_side2));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->ReadInput(parameters.m_side3));
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode ApiReplayer::ReadParameters(PandoraApi::Geometry::ConcentricGap::Parameters &parameters)
+{
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->ReadInput(parameters.m_minZCoordinate));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->ReadInput(parameters.m_maxZCoordinate));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->ReadInput(parameters.m_innerRCoordinate));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->ReadInput(parameters.m_innerPhiCoordinate));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->ReadInput(parameters.m_innerSymmetryOrder));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->ReadInput(parameters.m_outerRCoordinate));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->ReadInput(parameters.m_outerPhiCoordinate));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->ReadInput(parameters.m_outerSymmetryOrder));
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode ApiReplayer::ReplaySettings()
+{
+    std::string xmlFileName;
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->ReadVariable(xmlFileName));
+    std::string xmlContent;
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->ReadVariable(xmlContent));
+
+    TiXmlDocument xmlDocument(xmlFileName);
+    xmlDocument.Parse(xmlContent.c_str());
+
+    if (xmlDocument.Error())
+    {
+        std::cout << "ApiReplayer: invalid recorded settings, " << xmlDocument.ErrorDesc() << std::endl;
+        return STATUS_CODE_FAILURE;
+    }
+
+    return m_pPandora->GetPandoraApiImpl()->ReadSettings(xmlDocument);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode ApiReplayer::ReplayHitTypeGranularity()
+{
+    HitType hitType(ECAL);
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->ReadVariable(hitType));
+    Granularity granularity(FINE);
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->ReadVariable(granularity));
+
+    return PandoraApi::SetHitTypeGranularity(*m_pPandora, hitType, granularity);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode ApiReplayer::ReplayAdvanceSlidingWindow()
+{
+    float windowStartTime(0.f);
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->ReadVariable(windowStartTime));
+
+    return PandoraApi::AdvanceSlidingWindow(*m_pPandora, windowStartTime);
+}
+
+} // namespace pandora
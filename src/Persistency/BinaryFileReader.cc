@@ -11,13 +11,18 @@
 
 #include "Persistency/BinaryFileReader.h"
 
+#include <cmath>
+#include <limits>
+
 namespace pandora
 {
 
 BinaryFileReader::BinaryFileReader(const pandora::Pandora &pandora, const std::string &fileName) :
     FileReader(pandora, fileName),
     m_containerPosition(0),
-    m_containerSize(0)
+    m_containerSize(0),
+    m_isReadingBlock(false),
+    m_blockPosition(0)
 {
     m_fileType = BINARY;
     m_fileStream.open(fileName.c_str(), std::ios::in | std::ios::binary);
@@ -35,12 +40,14 @@ BinaryFileReader::~BinaryFileReader()
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-StatusCode BinaryFileReader::ReadHeader()
+StatusCode BinaryFileReader::ReadContainerHeader(ContainerCodec &containerCodec)
 {
+    m_isReadingBlock = false;
+
     std::string fileHash;
     PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->ReadVariable(fileHash));
 
-    if (PANDORA_FILE_HASH != fileHash)
+    if ((PANDORA_FILE_HASH != fileHash) && (PANDORA_COMPRESSED_FILE_HASH != fileHash))
         return STATUS_CODE_FAILURE;
 
     PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->ReadVariable(m_containerId));
@@ -54,6 +61,58 @@ StatusCode BinaryFileReader::ReadHeader()
     if (0 == m_containerSize)
         return STATUS_CODE_FAILURE;
 
+    containerCodec = NO_COMPRESSION;
+
+    if (PANDORA_COMPRESSED_FILE_HASH == fileHash)
+    {
+        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->ReadVariable(containerCodec));
+
+        if (BLOCK_COMPRESSION != containerCodec)
+            return STATUS_CODE_FAILURE;
+    }
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode BinaryFileReader::ReadCompressedBlock()
+{
+    unsigned int blockSize(0);
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->ReadVariable(blockSize));
+
+    const std::ifstream::pos_type endPosition(m_containerPosition + m_containerSize);
+    const std::streamoff compressedSize(endPosition - m_fileStream.tellg());
+
+    if (compressedSize <= 0)
+        return STATUS_CODE_FAILURE;
+
+    m_compressedBuffer.resize(static_cast<std::size_t>(compressedSize));
+    m_fileStream.read(&m_compressedBuffer[0], compressedSize);
+
+    if (!m_fileStream.good())
+        return STATUS_CODE_FAILURE;
+
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, BlockCodec::Decompress(&m_compressedBuffer[0], m_compressedBuffer.size(), blockSize, m_blockBuffer));
+
+    m_blockPosition = 0;
+    m_isReadingBlock = true;
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode BinaryFileReader::ReadHeader()
+{
+    m_caloHitCellVector.clear();
+
+    ContainerCodec containerCodec(UNKNOWN_CODEC);
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->ReadContainerHeader(containerCodec));
+
+    if (NO_COMPRESSION != containerCodec)
+        return this->ReadCompressedBlock();
+
     return STATUS_CODE_SUCCESS;
 }
 
@@ -61,7 +120,8 @@ StatusCode BinaryFileReader::ReadHeader()
 
 StatusCode BinaryFileReader::GoToNextContainer()
 {
-    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->ReadHeader());
+    ContainerCodec containerCodec(UNKNOWN_CODEC);
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->ReadContainerHeader(containerCodec));
     m_fileStream.seekg(m_containerPosition + m_containerSize, std::ios::beg);
 
     if (!m_fileStream.good())
@@ -74,12 +134,13 @@ StatusCode BinaryFileReader::GoToNextContainer()
 
 ContainerId BinaryFileReader::GetNextContainerId()
 {
+    m_isReadingBlock = false;
     const std::ifstream::pos_type initialPosition(m_fileStream.tellg());
 
     std::string fileHash;
     PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->ReadVariable(fileHash));
 
-    if (PANDORA_FILE_HASH != fileHash)
+    if ((PANDORA_FILE_HASH != fileHash) && (PANDORA_COMPRESSED_FILE_HASH != fileHash))
         throw StatusCodeException(STATUS_CODE_FAILURE);
 
     ContainerId containerId(UNKNOWN_CONTAINER);
@@ -195,6 +256,10 @@ StatusCode BinaryFileReader::ReadNextEventComponent()
         return this->ReadMCParticle(false);
     case RELATIONSHIP:
         return this->ReadRelationship(false);
+    case CALO_HIT_CELL:
+        return this->ReadCaloHitCell(false);
+    case COMPACT_CALO_HIT:
+        return this->ReadCompactCaloHit(false);
     case EVENT_END:
         m_containerId = UNKNOWN_CONTAINER;
         return STATUS_CODE_NOT_FOUND;
@@ -524,8 +589,6 @@ StatusCode BinaryFileReader::ReadCaloHit(bool checkComponentId)
         pParameters->m_layer = layer;
         pParameters->m_isInOuterSamplingLayer = isInOuterSamplingLayer;
         pParameters->m_pParentAddress = pParentAddress;
-        PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::CaloHit::Create(*m_pPandora, *pParameters, *m_pCaloHitFactory));
-        delete pParameters;
     }
     catch (StatusCodeException &statusCodeException)
     {
@@ -533,7 +596,7 @@ StatusCode BinaryFileReader::ReadCaloHit(bool checkComponentId)
         return statusCodeException.GetStatusCode();
     }
 
-    return STATUS_CODE_SUCCESS;
+    return this->CreateCaloHit(pParameters);
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -604,8 +667,6 @@ StatusCode BinaryFileReader::ReadTrack(bool checkComponentId)
         pParameters->m_canFormPfo = canFormPfo;
         pParameters->m_canFormClusterlessPfo = canFormClusterlessPfo;
         pParameters->m_pParentAddress = pParentAddress;
-        PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::Track::Create(*m_pPandora, *pParameters, *m_pTrackFactory));
-        delete pParameters;
     }
     catch (StatusCodeException &statusCodeException)
     {
@@ -613,7 +674,7 @@ StatusCode BinaryFileReader::ReadTrack(bool checkComponentId)
         return statusCodeException.GetStatusCode();
     }
 
-    return STATUS_CODE_SUCCESS;
+    return this->CreateTrack(pParameters);
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -660,8 +721,6 @@ StatusCode BinaryFileReader::ReadMCParticle(bool checkComponentId)
         pParameters->m_particleId = particleId;
         pParameters->m_mcParticleType = mcParticleType;
         pParameters->m_pParentAddress = pParentAddress;
-        PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::MCParticle::Create(*m_pPandora, *pParameters, *m_pMCParticleFactory));
-        delete pParameters;
     }
     catch (StatusCodeException &statusCodeException)
     {
@@ -669,7 +728,7 @@ StatusCode BinaryFileReader::ReadMCParticle(bool checkComponentId)
         return statusCodeException.GetStatusCode();
     }
 
-    return STATUS_CODE_SUCCESS;
+    return this->CreateMCParticle(pParameters);
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -697,23 +756,170 @@ StatusCode BinaryFileReader::ReadRelationship(bool checkComponentId)
     float weight(1.f);
     PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->ReadVariable(weight));
 
-    switch (relationshipId)
-    {
-    case CALO_HIT_TO_MC:
-        return PandoraApi::SetCaloHitToMCParticleRelationship(*m_pPandora, address1, address2, weight);
-    case TRACK_TO_MC:
-        return PandoraApi::SetTrackToMCParticleRelationship(*m_pPandora, address1, address2, weight);
-    case MC_PARENT_DAUGHTER:
-        return PandoraApi::SetMCParentDaughterRelationship(*m_pPandora, address1, address2);
-    case TRACK_PARENT_DAUGHTER:
-        return PandoraApi::SetTrackParentDaughterRelationship(*m_pPandora, address1, address2);
-    case TRACK_SIBLING:
-        return PandoraApi::SetTrackSiblingRelationship(*m_pPandora, address1, address2);
-    default:
+    return this->CreateRelationship(relationshipId, address1, address2, weight);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode BinaryFileReader::ReadCaloHitCell(bool checkComponentId)
+{
+    if (EVENT != m_containerId)
+        return STATUS_CODE_FAILURE;
+
+    if (checkComponentId)
+    {
+        ComponentId componentId(UNKNOWN_COMPONENT);
+        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->ReadVariable(componentId));
+
+        if (CALO_HIT_CELL != componentId)
+            return STATUS_CODE_FAILURE;
+    }
+
+    unsigned char cellGeometry(0), hitType(0), hitRegion(0);
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->ReadVariable(cellGeometry));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->ReadVariable(hitType));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->ReadVariable(hitRegion));
+
+    CaloHitCell caloHitCell;
+    caloHitCell.m_cellGeometry = static_cast<CellGeometry>(cellGeometry);
+    caloHitCell.m_hitType = static_cast<HitType>(hitType);
+    caloHitCell.m_hitRegion = static_cast<HitRegion>(hitRegion);
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->ReadVariable(caloHitCell.m_isDigital));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->ReadVariable(caloHitCell.m_isInOuterSamplingLayer));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->ReadVariable(caloHitCell.m_layer));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->ReadVariable(caloHitCell.m_cellNormalVector));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->ReadVariable(caloHitCell.m_cellThickness));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->ReadVariable(caloHitCell.m_nCellRadiationLengths));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->ReadVariable(caloHitCell.m_nCellInteractionLengths));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->ReadVariable(caloHitCell.m_cellSize0));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->ReadVariable(caloHitCell.m_cellSize1));
+
+    m_caloHitCellVector.push_back(caloHitCell);
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode BinaryFileReader::ReadCompactCaloHit(bool checkComponentId)
+{
+    if (EVENT != m_containerId)
         return STATUS_CODE_FAILURE;
+
+    if (checkComponentId)
+    {
+        ComponentId componentId(UNKNOWN_COMPONENT);
+        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->ReadVariable(componentId));
+
+        if (COMPACT_CALO_HIT != componentId)
+            return STATUS_CODE_FAILURE;
+    }
+
+    PandoraApi::CaloHit::Parameters *pParameters = m_pCaloHitFactory->NewParameters();
+
+    try
+    {
+        PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, m_pCaloHitFactory->Read(*pParameters, *this));
+
+        unsigned int cellIndex(0);
+        PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->ReadVariable(cellIndex));
+
+        if (cellIndex >= m_caloHitCellVector.size())
+            throw StatusCodeException(STATUS_CODE_FAILURE);
+
+        const CaloHitCell &caloHitCell(m_caloHitCellVector[cellIndex]);
+
+        CartesianVector positionVector(0.f, 0.f, 0.f);
+        PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->ReadVariable(positionVector));
+        CartesianVector expectedDirection(0.f, 0.f, 0.f);
+        PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->ReadQuantisedUnitVector(expectedDirection));
+        float time(0.f);
+        PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->ReadVariable(time));
+        float inputEnergy(0.f);
+        PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->ReadVariable(inputEnergy));
+        float mipEquivalentEnergy(0.f);
+        PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->ReadVariable(mipEquivalentEnergy));
+        float electromagneticEnergy(0.f);
+        PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->ReadVariable(electromagneticEnergy));
+        float hadronicEnergy(0.f);
+        PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->ReadVariable(hadronicEnergy));
+        const void *pParentAddress(NULL);
+        PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->ReadVariable(pParentAddress));
+
+        pParameters->m_positionVector = positionVector;
+        pParameters->m_expectedDirection = expectedDirection;
+        pParameters->m_cellNormalVector = caloHitCell.m_cellNormalVector;
+        pParameters->m_cellGeometry = caloHitCell.m_cellGeometry;
+        pParameters->m_cellSize0 = caloHitCell.m_cellSize0;
+        pParameters->m_cellSize1 = caloHitCell.m_cellSize1;
+        pParameters->m_cellThickness = caloHitCell.m_cellThickness;
+        pParameters->m_nCellRadiationLengths = caloHitCell.m_nCellRadiationLengths;
+        pParameters->m_nCellInteractionLengths = caloHitCell.m_nCellInteractionLengths;
+        pParameters->m_time = time;
+        pParameters->m_inputEnergy = inputEnergy;
+        pParameters->m_mipEquivalentEnergy = mipEquivalentEnergy;
+        pParameters->m_electromagneticEnergy = electromagneticEnergy;
+        pParameters->m_hadronicEnergy = hadronicEnergy;
+        pParameters->m_isDigital = caloHitCell.m_isDigital;
+        pParameters->m_hitType = caloHitCell.m_hitType;
+        pParameters->m_hitRegion = caloHitCell.m_hitRegion;
+        pParameters->m_layer = caloHitCell.m_layer;
+        pParameters->m_isInOuterSamplingLayer = caloHitCell.m_isInOuterSamplingLayer;
+        pParameters->m_pParentAddress = pParentAddress;
     }
+    catch (StatusCodeException &statusCodeException)
+    {
+        delete pParameters;
+        return statusCodeException.GetStatusCode();
+    }
+
+    return this->CreateCaloHit(pParameters);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode BinaryFileReader::ReadQuantisedUnitVector(CartesianVector &unitVector)
+{
+    unsigned short quantisedU(0), quantisedV(0);
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->ReadVariable(quantisedU));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->ReadVariable(quantisedV));
+
+    const float maxValue(static_cast<float>(std::numeric_limits<unsigned short>::max()));
+    const float u(2.f * static_cast<float>(quantisedU) / maxValue - 1.f), v(2.f * static_cast<float>(quantisedV) / maxValue - 1.f);
+    const float w(1.f - std::fabs(u) - std::fabs(v));
+
+    // Octahedral projection: points outside the |u| + |v| <= 1 square are folded back onto the lower hemisphere
+    if (w < 0.f)
+    {
+        unitVector = CartesianVector((1.f - std::fabs(v)) * ((u < 0.f) ? -1.f : 1.f), (1.f - std::fabs(u)) * ((v < 0.f) ? -1.f : 1.f), w);
+    }
+    else
+    {
+        unitVector = CartesianVector(u, v, w);
+    }
+
+    unitVector = unitVector.GetUnitVector();
 
     return STATUS_CODE_SUCCESS;
 }
 
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+BinaryFileReader::CaloHitCell::CaloHitCell() :
+    m_cellGeometry(RECTANGULAR),
+    m_hitType(ECAL),
+    m_hitRegion(BARREL),
+    m_isDigital(false),
+    m_isInOuterSamplingLayer(false),
+    m_layer(0),
+    m_cellNormalVector(0.f, 0.f, 0.f),
+    m_cellThickness(0.f),
+    m_nCellRadiationLengths(0.f),
+    m_nCellInteractionLengths(0.f),
+    m_cellSize0(0.f),
+    m_cellSize1(0.f)
+{
+}
+
 } // namespace pandora
@@ -16,12 +16,176 @@
 #include "Objects/Track.h"
 
 #include "Persistency/BinaryFileWriter.h"
+#include "Persistency/BlockCodec.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+
+#if __cplusplus > 199711L
+    #include <condition_variable>
+    #include <deque>
+    #include <mutex>
+    #include <thread>
+#endif
 
 namespace pandora
 {
 
+#if __cplusplus > 199711L
+/**
+ *  @brief  BackgroundWriter class, writing completed container buffers to file in a background thread. The total size of the
+ *          buffers awaiting writing is bounded, and written buffers are recycled so that their capacity is reused.
+ */
+class BinaryFileWriter::BackgroundWriter
+{
+public:
+    /**
+     *  @brief  Constructor, starting the background thread
+     * 
+     *  @param  fileStream the file stream, which must not be used elsewhere until the background writer is destroyed
+     *  @param  maxBufferedBytes the maximum number of bytes awaiting writing
+     */
+    BackgroundWriter(std::ofstream &fileStream, const std::size_t maxBufferedBytes);
+
+    /**
+     *  @brief  Destructor, writing all remaining buffers and stopping the background thread
+     */
+    ~BackgroundWriter();
+
+    /**
+     *  @brief  Queue a container buffer for writing, waiting if the buffered size limit would be exceeded
+     * 
+     *  @param  containerBuffer the container buffer, which receives an empty, recycled buffer in exchange
+     */
+    StatusCode Push(ContainerBuffer &containerBuffer);
+
+private:
+    /**
+     *  @brief  Write queued buffers until the background writer is destroyed
+     */
+    void WriteBuffers();
+
+    typedef std::deque<ContainerBuffer> ContainerBufferQueue;
+
+    std::ofstream              &m_fileStream;           ///< The stream class to write to the file
+    const std::size_t           m_maxBufferedBytes;     ///< The maximum number of bytes awaiting writing
+    std::size_t                 m_nBufferedBytes;       ///< The number of bytes awaiting writing
+    ContainerBufferQueue        m_pendingBuffers;       ///< The buffers awaiting writing
+    ContainerBuffer             m_spareBuffer;          ///< A written buffer, retaining its capacity for reuse
+    bool                        m_shouldStop;           ///< Whether the background thread should stop, once all buffers are written
+    bool                        m_hasFailed;            ///< Whether a write to file has failed
+    std::mutex                  m_mutex;                ///< The mutex protecting the queue contents
+    std::condition_variable     m_pendingCondition;     ///< Signalled when a buffer is queued, or the background writer is destroyed
+    std::condition_variable     m_writtenCondition;     ///< Signalled when a buffer has been written
+    std::thread                 m_thread;               ///< The background thread
+};
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+BinaryFileWriter::BackgroundWriter::BackgroundWriter(std::ofstream &fileStream, const std::size_t maxBufferedBytes) :
+    m_fileStream(fileStream),
+    m_maxBufferedBytes(maxBufferedBytes),
+    m_nBufferedBytes(0),
+    m_shouldStop(false),
+    m_hasFailed(false)
+{
+    m_thread = std::thread(&BackgroundWriter::WriteBuffers, this);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+BinaryFileWriter::BackgroundWriter::~BackgroundWriter()
+{
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_shouldStop = true;
+    }
+
+    m_pendingCondition.notify_one();
+    m_thread.join();
+
+    if (m_hasFailed)
+        std::cout << "BinaryFileWriter: failed to write buffered containers to file " << std::endl;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode BinaryFileWriter::BackgroundWriter::Push(ContainerBuffer &containerBuffer)
+{
+    const std::size_t nBytes(containerBuffer.size());
+
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+
+        // ATTN: A single container larger than the limit is accepted once all earlier containers have been written
+        while (!m_hasFailed && (m_nBufferedBytes > 0) && (m_nBufferedBytes + nBytes > m_maxBufferedBytes))
+            m_writtenCondition.wait(lock);
+
+        if (m_hasFailed)
+            return STATUS_CODE_FAILURE;
+
+        m_pendingBuffers.push_back(ContainerBuffer());
+        m_pendingBuffers.back().swap(containerBuffer);
+        containerBuffer.swap(m_spareBuffer);
+        m_nBufferedBytes += nBytes;
+    }
+
+    m_pendingCondition.notify_one();
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void BinaryFileWriter::BackgroundWriter::WriteBuffers()
+{
+    ContainerBuffer containerBuffer;
+
+    while (true)
+    {
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+
+            while (!m_shouldStop && m_pendingBuffers.empty())
+                m_pendingCondition.wait(lock);
+
+            if (m_pendingBuffers.empty())
+                return;
+
+            containerBuffer.swap(m_pendingBuffers.front());
+            m_pendingBuffers.pop_front();
+        }
+
+        m_fileStream.write(&containerBuffer[0], containerBuffer.size());
+        const bool isGood(m_fileStream.good());
+
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_nBufferedBytes -= containerBuffer.size();
+            m_hasFailed = m_hasFailed || !isGood;
+
+            containerBuffer.clear();
+
+            if (containerBuffer.capacity() > m_spareBuffer.capacity())
+                containerBuffer.swap(m_spareBuffer);
+        }
+
+        m_writtenCondition.notify_one();
+    }
+}
+#endif
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 BinaryFileWriter::BinaryFileWriter(const pandora::Pandora &pandora, const std::string &fileName, const FileMode fileMode) :
-    FileWriter(pandora, fileName)
+    FileWriter(pandora, fileName),
+    m_containerPosition(0),
+    m_containerCodec(NO_COMPRESSION),
+    m_shouldWriteCompactCaloHits(false),
+    m_directionPrecisionBits(16),
+    m_pBackgroundWriter(NULL)
 {
     m_fileType = BINARY;
 
@@ -45,25 +209,80 @@ BinaryFileWriter::BinaryFileWriter(const pandora::Pandora &pandora, const std::s
 
     if (!m_fileStream.is_open() || !m_fileStream.good())
         throw StatusCodeException(STATUS_CODE_FAILURE);
-
-    m_containerPosition = m_fileStream.tellp();
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 BinaryFileWriter::~BinaryFileWriter()
 {
+#if __cplusplus > 199711L
+    delete m_pBackgroundWriter;
+#endif
+    m_fileStream.flush();
     m_fileStream.close();
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+StatusCode BinaryFileWriter::EnableBackgroundWriting(const unsigned int maxBufferedBytes)
+{
+    if (NULL != m_pBackgroundWriter)
+        return STATUS_CODE_ALREADY_INITIALIZED;
+
+    if (UNKNOWN_CONTAINER != m_containerId)
+        return STATUS_CODE_NOT_ALLOWED;
+
+#if __cplusplus > 199711L
+    m_pBackgroundWriter = new BackgroundWriter(m_fileStream, maxBufferedBytes);
+    return STATUS_CODE_SUCCESS;
+#else
+    (void) maxBufferedBytes;
+    return STATUS_CODE_NOT_ALLOWED;
+#endif
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode BinaryFileWriter::SetContainerCodec(const ContainerCodec containerCodec)
+{
+    if ((NO_COMPRESSION != containerCodec) && (BLOCK_COMPRESSION != containerCodec))
+        return STATUS_CODE_INVALID_PARAMETER;
+
+    if (UNKNOWN_CONTAINER != m_containerId)
+        return STATUS_CODE_NOT_ALLOWED;
+
+    m_containerCodec = containerCodec;
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode BinaryFileWriter::EnableCompactCaloHits(const unsigned int directionPrecisionBits)
+{
+    if ((0 == directionPrecisionBits) || (directionPrecisionBits > 16))
+        return STATUS_CODE_INVALID_PARAMETER;
+
+    if (UNKNOWN_CONTAINER != m_containerId)
+        return STATUS_CODE_NOT_ALLOWED;
+
+    m_shouldWriteCompactCaloHits = true;
+    m_directionPrecisionBits = directionPrecisionBits;
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 StatusCode BinaryFileWriter::WriteHeader(const ContainerId containerId)
 {
+    m_containerBuffer.clear();
+    m_caloHitCellMap.clear();
+
     PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->WriteVariable(PANDORA_FILE_HASH));
     PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->WriteVariable(containerId));
 
-    m_containerPosition = m_fileStream.tellp();
+    m_containerPosition = m_containerBuffer.size();
     const std::ofstream::pos_type dummyContainerSize(0);
     PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->WriteVariable(dummyContainerSize));
 
@@ -80,21 +299,59 @@ StatusCode BinaryFileWriter::WriteFooter()
         return STATUS_CODE_FAILURE;
 
     PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->WriteVariable((EVENT == m_containerId) ? EVENT_END : GEOMETRY_END));
+
+    if (NO_COMPRESSION != m_containerCodec)
+        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->CompressContainer());
+
     m_containerId = UNKNOWN_CONTAINER;
 
-    const std::ofstream::pos_type containerSize(m_fileStream.tellp() - m_containerPosition);
-    m_fileStream.seekp(m_containerPosition, std::ios::beg);
+    const std::ofstream::pos_type containerSize(static_cast<std::streamoff>(m_containerBuffer.size() - m_containerPosition));
+    std::memcpy(&m_containerBuffer[m_containerPosition], &containerSize, sizeof(containerSize));
 
-    if (!m_fileStream.good())
-        return STATUS_CODE_FAILURE;
+    return this->FlushContainer();
+}
 
-    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->WriteVariable(containerSize));
-    m_fileStream.seekp(0, std::ios::end);
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode BinaryFileWriter::FlushContainer()
+{
+#if __cplusplus > 199711L
+    if (NULL != m_pBackgroundWriter)
+        return m_pBackgroundWriter->Push(m_containerBuffer);
+#endif
+
+    m_fileStream.write(&m_containerBuffer[0], m_containerBuffer.size());
+    m_containerBuffer.clear();
 
     if (!m_fileStream.good())
         return STATUS_CODE_FAILURE;
 
-    m_containerPosition = m_fileStream.tellp();
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode BinaryFileWriter::CompressContainer()
+{
+    const std::size_t blockPosition(m_containerPosition + sizeof(std::ofstream::pos_type));
+    const std::size_t blockSize(m_containerBuffer.size() - blockPosition);
+
+    if (blockSize > std::numeric_limits<unsigned int>::max())
+        return STATUS_CODE_OUT_OF_RANGE;
+
+    BlockCodec::Compress(&m_containerBuffer[blockPosition], blockSize, m_compressedBuffer);
+
+    // ATTN: Compressed container keeps the hash, id and size layout, so that containers can still be skipped without decompression
+    m_containerBuffer.clear();
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->WriteVariable(PANDORA_COMPRESSED_FILE_HASH));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->WriteVariable(m_containerId));
+
+    m_containerPosition = m_containerBuffer.size();
+    const std::ofstream::pos_type dummyContainerSize(0);
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->WriteVariable(dummyContainerSize));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->WriteVariable(m_containerCodec));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->WriteVariable(static_cast<unsigned int>(blockSize)));
+    this->WriteBytes(&m_compressedBuffer[0], m_compressedBuffer.size());
 
     return STATUS_CODE_SUCCESS;
 }
@@ -203,6 +460,9 @@ StatusCode BinaryFileWriter::WriteCaloHit(const CaloHit *const pCaloHit)
     if (EVENT != m_containerId)
         return STATUS_CODE_FAILURE;
 
+    if (m_shouldWriteCompactCaloHits)
+        return this->WriteCompactCaloHit(pCaloHit);
+
     PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->WriteVariable(CALO_HIT));
     PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, m_pCaloHitFactory->Write(pCaloHit, *this));
 
@@ -297,4 +557,85 @@ StatusCode BinaryFileWriter::WriteRelationship(const RelationshipId relationship
     return STATUS_CODE_SUCCESS;
 }
 
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode BinaryFileWriter::WriteCompactCaloHit(const CaloHit *const pCaloHit)
+{
+    // ATTN: Serialize the cell properties as a dictionary entry, then remove the entry again if an identical one was already written
+    const std::size_t cellPosition(m_containerBuffer.size());
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->WriteVariable(CALO_HIT_CELL));
+
+    const std::size_t cellPropertiesPosition(m_containerBuffer.size());
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->WriteVariable(static_cast<unsigned char>(pCaloHit->GetCellGeometry())));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->WriteVariable(static_cast<unsigned char>(pCaloHit->GetHitType())));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->WriteVariable(static_cast<unsigned char>(pCaloHit->GetHitRegion())));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->WriteVariable(pCaloHit->IsDigital()));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->WriteVariable(pCaloHit->IsInOuterSamplingLayer()));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->WriteVariable(pCaloHit->GetLayer()));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->WriteVariable(pCaloHit->GetCellNormalVector()));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->WriteVariable(pCaloHit->GetCellThickness()));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->WriteVariable(pCaloHit->GetNCellRadiationLengths()));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->WriteVariable(pCaloHit->GetNCellInteractionLengths()));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->WriteVariable(pCaloHit->GetCellSize0()));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->WriteVariable(pCaloHit->GetCellSize1()));
+
+    m_caloHitCell.assign(m_containerBuffer.begin() + cellPropertiesPosition, m_containerBuffer.end());
+    CaloHitCellMap::const_iterator cellIter(m_caloHitCellMap.find(m_caloHitCell));
+
+    if (m_caloHitCellMap.end() == cellIter)
+    {
+        cellIter = m_caloHitCellMap.insert(CaloHitCellMap::value_type(m_caloHitCell, m_caloHitCellMap.size())).first;
+    }
+    else
+    {
+        m_containerBuffer.resize(cellPosition);
+    }
+
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->WriteVariable(COMPACT_CALO_HIT));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, m_pCaloHitFactory->Write(pCaloHit, *this));
+
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->WriteVariable(cellIter->second));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->WriteVariable(pCaloHit->GetPositionVector()));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->WriteQuantisedUnitVector(pCaloHit->GetExpectedDirection()));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->WriteVariable(pCaloHit->GetTime()));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->WriteVariable(pCaloHit->GetInputEnergy()));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->WriteVariable(pCaloHit->GetMipEquivalentEnergy()));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->WriteVariable(pCaloHit->GetElectromagneticEnergy()));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->WriteVariable(pCaloHit->GetHadronicEnergy()));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->WriteVariable(pCaloHit->GetParentCaloHitAddress()));
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode BinaryFileWriter::WriteQuantisedUnitVector(const CartesianVector &unitVector)
+{
+    // Octahedral projection: the unit sphere is mapped onto the |u| + |v| <= 1 square, folding the lower hemisphere outwards
+    const float norm(std::fabs(unitVector.GetX()) + std::fabs(unitVector.GetY()) + std::fabs(unitVector.GetZ()));
+    float u((norm > 0.f) ? unitVector.GetX() / norm : 0.f), v((norm > 0.f) ? unitVector.GetY() / norm : 0.f);
+
+    if (unitVector.GetZ() < 0.f)
+    {
+        const float foldedU((1.f - std::fabs(v)) * ((u < 0.f) ? -1.f : 1.f));
+        const float foldedV((1.f - std::fabs(u)) * ((v < 0.f) ? -1.f : 1.f));
+        u = foldedU;
+        v = foldedV;
+    }
+
+    // ATTN: Coordinates always span the full 16 bits, so reading is independent of precision; discarded low bits are left zero
+    const unsigned int shift(16 - m_directionPrecisionBits);
+    const unsigned int maxValue(std::numeric_limits<unsigned short>::max());
+    const unsigned int fullU(static_cast<unsigned int>(0.5f + 0.5f * (u + 1.f) * static_cast<float>(maxValue)));
+    const unsigned int fullV(static_cast<unsigned int>(0.5f + 0.5f * (v + 1.f) * static_cast<float>(maxValue)));
+
+    const unsigned short quantisedU(static_cast<unsigned short>(std::min(maxValue, ((fullU + ((1u << shift) >> 1)) >> shift) << shift)));
+    const unsigned short quantisedV(static_cast<unsigned short>(std::min(maxValue, ((fullV + ((1u << shift) >> 1)) >> shift) << shift)));
+
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->WriteVariable(quantisedU));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->WriteVariable(quantisedV));
+
+    return STATUS_CODE_SUCCESS;
+}
+
 } // namespace pandora
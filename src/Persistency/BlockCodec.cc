@@ -0,0 +1,194 @@
+/**
+ *  @file   PandoraSDK/src/Persistency/BlockCodec.cc
+ *
+ *  @brief  Implementation of the block codec class.
+ *
+ *  $Log: $
+ */
+
+#include "Persistency/BlockCodec.h"
+
+#include <cstring>
+
+namespace pandora
+{
+
+const unsigned int BlockCodec::HASH_BITS = 16;
+const std::size_t BlockCodec::MIN_MATCH_LENGTH = 4;
+const std::size_t BlockCodec::MAX_MATCH_OFFSET = 65535;
+const std::size_t BlockCodec::MAX_TOKEN_LENGTH = 15;
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void BlockCodec::Compress(const char *const pInput, const std::size_t inputSize, ByteVector &output)
+{
+    output.clear();
+    output.reserve(inputSize + (inputSize / 255) + 16);
+
+    // ATTN: Hash table holds the most recent position at which each four byte sequence was seen; stale entries are rejected below
+    std::vector<std::size_t> hashTable(1 << HASH_BITS, 0);
+
+    std::size_t anchor(0), position(0);
+
+    while (position + MIN_MATCH_LENGTH <= inputSize)
+    {
+        const unsigned int hashIndex(BlockCodec::GetHashIndex(pInput + position));
+        const std::size_t candidate(hashTable[hashIndex]);
+        hashTable[hashIndex] = position;
+
+        if ((candidate >= position) || (position - candidate > MAX_MATCH_OFFSET) ||
+            (0 != std::memcmp(pInput + candidate, pInput + position, MIN_MATCH_LENGTH)))
+        {
+            ++position;
+            continue;
+        }
+
+        std::size_t matchLength(MIN_MATCH_LENGTH);
+
+        while ((position + matchLength < inputSize) && (pInput[candidate + matchLength] == pInput[position + matchLength]))
+            ++matchLength;
+
+        BlockCodec::WriteSequence(pInput + anchor, position - anchor, position - candidate, matchLength, output);
+        position += matchLength;
+        anchor = position;
+    }
+
+    if (anchor < inputSize)
+        BlockCodec::WriteSequence(pInput + anchor, inputSize - anchor, 0, 0, output);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode BlockCodec::Decompress(const char *const pInput, const std::size_t inputSize, const std::size_t outputSize, ByteVector &output)
+{
+    output.resize(outputSize);
+
+    const unsigned char *const pBytes(reinterpret_cast<const unsigned char*>(pInput));
+    std::size_t inputPosition(0), outputPosition(0);
+
+    while (inputPosition < inputSize)
+    {
+        const unsigned char token(pBytes[inputPosition++]);
+
+        std::size_t nLiterals(token >> 4);
+
+        if (MAX_TOKEN_LENGTH == nLiterals)
+            PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, BlockCodec::ReadLengthExtension(pBytes, inputSize, inputPosition, nLiterals));
+
+        if ((nLiterals > inputSize - inputPosition) || (nLiterals > outputSize - outputPosition))
+            return STATUS_CODE_FAILURE;
+
+        if (nLiterals > 0)
+            std::memcpy(&output[outputPosition], pInput + inputPosition, nLiterals);
+
+        inputPosition += nLiterals;
+        outputPosition += nLiterals;
+
+        if (inputPosition == inputSize)
+            break;
+
+        if (inputPosition + 2 > inputSize)
+            return STATUS_CODE_FAILURE;
+
+        const std::size_t matchOffset(pBytes[inputPosition] | (pBytes[inputPosition + 1] << 8));
+        inputPosition += 2;
+
+        std::size_t matchLength(token & 0xf);
+
+        if (MAX_TOKEN_LENGTH == matchLength)
+            PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, BlockCodec::ReadLengthExtension(pBytes, inputSize, inputPosition, matchLength));
+
+        matchLength += MIN_MATCH_LENGTH;
+
+        if ((0 == matchOffset) || (matchOffset > outputPosition) || (matchLength > outputSize - outputPosition))
+            return STATUS_CODE_FAILURE;
+
+        char *const pOutput(&output[outputPosition]);
+
+        if (matchOffset >= matchLength)
+        {
+            std::memcpy(pOutput, pOutput - matchOffset, matchLength);
+        }
+        else
+        {
+            // ATTN: Overlapping back-reference, repeating the most recent matchOffset bytes, must be copied in order
+            for (std::size_t i = 0; i < matchLength; ++i)
+                pOutput[i] = pOutput[i - matchOffset];
+        }
+
+        outputPosition += matchLength;
+    }
+
+    if (outputPosition != outputSize)
+        return STATUS_CODE_FAILURE;
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+unsigned int BlockCodec::GetHashIndex(const char *const pBytes)
+{
+    unsigned int sequence(0);
+    std::memcpy(&sequence, pBytes, sizeof(sequence));
+
+    return (sequence * 2654435761U) >> (32 - HASH_BITS);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void BlockCodec::WriteSequence(const char *const pLiterals, const std::size_t nLiterals, const std::size_t matchOffset,
+    const std::size_t matchLength, ByteVector &output)
+{
+    const std::size_t matchToken((0 == matchOffset) ? 0 : matchLength - MIN_MATCH_LENGTH);
+    const unsigned char token(static_cast<unsigned char>(((nLiterals < MAX_TOKEN_LENGTH ? nLiterals : MAX_TOKEN_LENGTH) << 4) |
+        (matchToken < MAX_TOKEN_LENGTH ? matchToken : MAX_TOKEN_LENGTH)));
+    output.push_back(static_cast<char>(token));
+
+    if (nLiterals >= MAX_TOKEN_LENGTH)
+        BlockCodec::WriteLengthExtension(nLiterals - MAX_TOKEN_LENGTH, output);
+
+    output.insert(output.end(), pLiterals, pLiterals + nLiterals);
+
+    if (0 == matchOffset)
+        return;
+
+    output.push_back(static_cast<char>(matchOffset & 0xff));
+    output.push_back(static_cast<char>((matchOffset >> 8) & 0xff));
+
+    if (matchToken >= MAX_TOKEN_LENGTH)
+        BlockCodec::WriteLengthExtension(matchToken - MAX_TOKEN_LENGTH, output);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void BlockCodec::WriteLengthExtension(std::size_t length, ByteVector &output)
+{
+    while (length >= 255)
+    {
+        output.push_back(static_cast<char>(255));
+        length -= 255;
+    }
+
+    output.push_back(static_cast<char>(length));
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode BlockCodec::ReadLengthExtension(const unsigned char *const pInput, const std::size_t inputSize, std::size_t &position,
+    std::size_t &length)
+{
+    while (true)
+    {
+        if (position >= inputSize)
+            return STATUS_CODE_FAILURE;
+
+        const unsigned char extension(pInput[position++]);
+        length += extension;
+
+        if (255 != extension)
+            return STATUS_CODE_SUCCESS;
+    }
+}
+
+} // namespace pandora
@@ -12,15 +12,194 @@
 #include "Persistency/BinaryFileReader.h"
 #include "Persistency/XmlFileReader.h"
 
+#if __cplusplus > 199711L
+    #include <condition_variable>
+    #include <deque>
+    #include <mutex>
+    #include <thread>
+#endif
+
 using namespace pandora;
 
+#if __cplusplus > 199711L
+/**
+ *  @brief  ReadAheadQueue class, decoding events from the event file in a background thread, so that file access and decoding
+ *          overlap with the processing of earlier events. A fixed pool of staged events bounds the number of events held in memory.
+ */
+class EventReadingAlgorithm::ReadAheadQueue
+{
+public:
+    /**
+     *  @brief  Constructor, starting the background thread
+     * 
+     *  @param  pFileReader address of the file reader, which must not be used elsewhere until the queue is destroyed
+     *  @param  depth the maximum number of decoded events awaiting processing
+     */
+    ReadAheadQueue(FileReader *const pFileReader, const unsigned int depth);
+
+    /**
+     *  @brief  Destructor, stopping the background thread
+     */
+    ~ReadAheadQueue();
+
+    /**
+     *  @brief  Get the next decoded event, waiting for the background thread if necessary
+     * 
+     *  @param  pStagedEvent to receive the address of the staged event, to be passed back via ReleaseEvent
+     */
+    StatusCode PopEvent(StagedEvent *&pStagedEvent);
+
+    /**
+     *  @brief  Return a staged event to the pool, once its objects have been created
+     * 
+     *  @param  pStagedEvent address of the staged event
+     */
+    void ReleaseEvent(StagedEvent *const pStagedEvent);
+
+private:
+    /**
+     *  @brief  Decode events until the end of the file is reached, an error occurs or the queue is destroyed
+     */
+    void ReadEvents();
+
+    typedef std::pair<StatusCode, StagedEvent*> ReadResult;
+    typedef std::deque<ReadResult> ReadResultQueue;
+    typedef std::vector<StagedEvent*> StagedEventVector;
+
+    FileReader                 *m_pFileReader;          ///< Address of the file reader
+    StagedEventVector           m_freeEvents;           ///< The staged events available to the background thread
+    ReadResultQueue             m_readResults;          ///< The decoded events, in file order, awaiting processing
+    bool                        m_shouldStop;           ///< Whether the background thread should stop
+    std::mutex                  m_mutex;                ///< The mutex protecting the queue contents
+    std::condition_variable     m_freeCondition;        ///< Signalled when a staged event is released, or the queue is destroyed
+    std::condition_variable     m_readCondition;        ///< Signalled when an event has been decoded
+    std::thread                 m_thread;               ///< The background thread
+};
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+EventReadingAlgorithm::ReadAheadQueue::ReadAheadQueue(FileReader *const pFileReader, const unsigned int depth) :
+    m_pFileReader(pFileReader),
+    m_shouldStop(false)
+{
+    for (unsigned int i = 0; i < depth; ++i)
+        m_freeEvents.push_back(new StagedEvent);
+
+    m_thread = std::thread(&ReadAheadQueue::ReadEvents, this);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+EventReadingAlgorithm::ReadAheadQueue::~ReadAheadQueue()
+{
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_shouldStop = true;
+    }
+
+    m_freeCondition.notify_one();
+    m_thread.join();
+
+    for (StagedEventVector::const_iterator iter = m_freeEvents.begin(), iterEnd = m_freeEvents.end(); iter != iterEnd; ++iter)
+        delete *iter;
+
+    for (ReadResultQueue::const_iterator iter = m_readResults.begin(), iterEnd = m_readResults.end(); iter != iterEnd; ++iter)
+        delete iter->second;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode EventReadingAlgorithm::ReadAheadQueue::PopEvent(StagedEvent *&pStagedEvent)
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+
+    while (m_readResults.empty())
+        m_readCondition.wait(lock);
+
+    // ATTN: A failed read ends the background thread, so the result is left in place to be reported by all subsequent requests
+    const ReadResult &readResult(m_readResults.front());
+
+    if (STATUS_CODE_SUCCESS != readResult.first)
+        return readResult.first;
+
+    pStagedEvent = readResult.second;
+    m_readResults.pop_front();
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void EventReadingAlgorithm::ReadAheadQueue::ReleaseEvent(StagedEvent *const pStagedEvent)
+{
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_freeEvents.push_back(pStagedEvent);
+    }
+
+    m_freeCondition.notify_one();
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void EventReadingAlgorithm::ReadAheadQueue::ReadEvents()
+{
+    while (true)
+    {
+        StagedEvent *pStagedEvent(NULL);
+
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+
+            while (!m_shouldStop && m_freeEvents.empty())
+                m_freeCondition.wait(lock);
+
+            if (m_shouldStop)
+                return;
+
+            pStagedEvent = m_freeEvents.back();
+            m_freeEvents.pop_back();
+        }
+
+        StatusCode statusCode(STATUS_CODE_SUCCESS);
+
+        try
+        {
+            statusCode = m_pFileReader->ReadEvent(*pStagedEvent);
+        }
+        catch (StatusCodeException &statusCodeException)
+        {
+            statusCode = statusCodeException.GetStatusCode();
+        }
+        catch (...)
+        {
+            statusCode = STATUS_CODE_FAILURE;
+        }
+
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_readResults.push_back(ReadResult(statusCode, pStagedEvent));
+        }
+
+        m_readCondition.notify_one();
+
+        if (STATUS_CODE_SUCCESS != statusCode)
+            return;
+    }
+}
+#endif
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 EventReadingAlgorithm::EventReadingAlgorithm() :
     m_geometryFileType(UNKNOWN_FILE_TYPE),
     m_eventFileType(UNKNOWN_FILE_TYPE),
     m_shouldReadGeometry(false),
     m_shouldReadEvents(true),
     m_skipToEvent(0),
-    m_pEventFileReader(NULL)
+    m_pEventFileReader(NULL),
+    m_readAheadDepth(0),
+    m_pReadAheadQueue(NULL)
 {
 }
 
@@ -28,6 +207,9 @@ EventReadingAlgorithm::EventReadingAlgorithm() :
 
 EventReadingAlgorithm::~EventReadingAlgorithm()
 {
+#if __cplusplus > 199711L
+    delete m_pReadAheadQueue;
+#endif
     delete m_pEventFileReader;
 }
 
@@ -69,6 +251,15 @@ StatusCode EventReadingAlgorithm::Initialize()
         }
 
         PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, m_pEventFileReader->GoToEvent(m_skipToEvent));
+
+        if (m_readAheadDepth > 0)
+        {
+#if __cplusplus > 199711L
+            m_pReadAheadQueue = new ReadAheadQueue(m_pEventFileReader, m_readAheadDepth);
+#else
+            std::cout << "EventReadingAlgorithm: ReadAheadDepth requires c++11, events will be read synchronously " << std::endl;
+#endif
+        }
     }
 
     return STATUS_CODE_SUCCESS;
@@ -80,7 +271,22 @@ StatusCode EventReadingAlgorithm::Run()
 {
     if ((NULL != m_pEventFileReader) && m_shouldReadEvents)
     {
-        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, m_pEventFileReader->ReadEvent());
+#if __cplusplus > 199711L
+        if (NULL != m_pReadAheadQueue)
+        {
+            StagedEvent *pStagedEvent(NULL);
+            PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, m_pReadAheadQueue->PopEvent(pStagedEvent));
+
+            const StatusCode creationStatusCode(m_pEventFileReader->CreateEvent(*pStagedEvent));
+            m_pReadAheadQueue->ReleaseEvent(pStagedEvent);
+            PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, creationStatusCode);
+        }
+        else
+#endif
+        {
+            PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, m_pEventFileReader->ReadEvent());
+        }
+
         PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::RepeatEventPreparation(*this));
     }
 
@@ -146,5 +352,8 @@ StatusCode EventReadingAlgorithm::ReadSettings(const TiXmlHandle xmlHandle)
     PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle,
         "SkipToEvent", m_skipToEvent));
 
+    PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle,
+        "ReadAheadDepth", m_readAheadDepth));
+
     return STATUS_CODE_SUCCESS;
 }
@@ -23,6 +23,11 @@ EventWritingAlgorithm::EventWritingAlgorithm() :
     m_shouldWriteTrackRelationships(true),
     m_shouldOverwriteEventFile(false),
     m_shouldOverwriteGeometryFile(false),
+    m_shouldWriteInBackground(false),
+    m_maxBufferedBytes(100000000),
+    m_shouldCompressContainers(false),
+    m_shouldWriteCompactCaloHits(false),
+    m_directionPrecisionBits(16),
     m_pEventFileWriter(NULL)
 {
 }
@@ -45,6 +50,12 @@ StatusCode EventWritingAlgorithm::Initialize()
         if (BINARY == m_geometryFileType)
         {
             BinaryFileWriter geometryFileWriter(this->GetPandora(), m_geometryFileName, fileMode);
+
+            if (m_shouldCompressContainers)
+            {
+                PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, geometryFileWriter.SetContainerCodec(BLOCK_COMPRESSION));
+            }
+
             PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, geometryFileWriter.WriteGeometry());
         }
         else if (XML == m_geometryFileType)
@@ -64,7 +75,23 @@ StatusCode EventWritingAlgorithm::Initialize()
 
         if (BINARY == m_eventFileType)
         {
-            m_pEventFileWriter = new BinaryFileWriter(this->GetPandora(), m_eventFileName, fileMode);
+            BinaryFileWriter *const pBinaryFileWriter(new BinaryFileWriter(this->GetPandora(), m_eventFileName, fileMode));
+            m_pEventFileWriter = pBinaryFileWriter;
+
+            if (m_shouldCompressContainers)
+            {
+                PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, pBinaryFileWriter->SetContainerCodec(BLOCK_COMPRESSION));
+            }
+
+            if (m_shouldWriteCompactCaloHits)
+            {
+                PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, pBinaryFileWriter->EnableCompactCaloHits(m_directionPrecisionBits));
+            }
+
+            if (m_shouldWriteInBackground)
+            {
+                PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, pBinaryFileWriter->EnableBackgroundWriting(m_maxBufferedBytes));
+            }
         }
         else if (XML == m_eventFileType)
         {
@@ -169,5 +196,20 @@ StatusCode EventWritingAlgorithm::ReadSettings(const TiXmlHandle xmlHandle)
     PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle,
         "ShouldWriteTrackRelationships", m_shouldWriteTrackRelationships));
 
+    PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle,
+        "ShouldWriteInBackground", m_shouldWriteInBackground));
+
+    PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle,
+        "MaxBufferedBytes", m_maxBufferedBytes));
+
+    PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle,
+        "ShouldCompressContainers", m_shouldCompressContainers));
+
+    PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle,
+        "ShouldWriteCompactCaloHits", m_shouldWriteCompactCaloHits));
+
+    PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle,
+        "DirectionPrecisionBits", m_directionPrecisionBits));
+
     return STATUS_CODE_SUCCESS;
 }
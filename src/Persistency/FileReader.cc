@@ -13,8 +13,42 @@
 namespace pandora
 {
 
+StagedEvent::StagedEvent()
+{
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StagedEvent::~StagedEvent()
+{
+    this->Clear();
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void StagedEvent::Clear()
+{
+    for (CaloHitParametersVector::const_iterator iter = m_caloHitParameters.begin(), iterEnd = m_caloHitParameters.end(); iter != iterEnd; ++iter)
+        delete *iter;
+
+    for (TrackParametersVector::const_iterator iter = m_trackParameters.begin(), iterEnd = m_trackParameters.end(); iter != iterEnd; ++iter)
+        delete *iter;
+
+    for (MCParticleParametersVector::const_iterator iter = m_mcParticleParameters.begin(), iterEnd = m_mcParticleParameters.end(); iter != iterEnd; ++iter)
+        delete *iter;
+
+    m_caloHitParameters.clear();
+    m_trackParameters.clear();
+    m_mcParticleParameters.clear();
+    m_relationships.clear();
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 FileReader::FileReader(const pandora::Pandora &pandora, const std::string &fileName) :
-    Persistency(pandora, fileName)
+    Persistency(pandora, fileName),
+    m_pStagedEvent(NULL)
 {
 }
 
@@ -81,6 +115,60 @@ StatusCode FileReader::ReadEvent()
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+StatusCode FileReader::ReadEvent(StagedEvent &stagedEvent)
+{
+    stagedEvent.Clear();
+
+    m_pStagedEvent = &stagedEvent;
+    const StatusCode statusCode(this->ReadEvent());
+    m_pStagedEvent = NULL;
+
+    return statusCode;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode FileReader::CreateEvent(StagedEvent &stagedEvent) const
+{
+    try
+    {
+        for (StagedEvent::CaloHitParametersVector::const_iterator iter = stagedEvent.m_caloHitParameters.begin(),
+            iterEnd = stagedEvent.m_caloHitParameters.end(); iter != iterEnd; ++iter)
+        {
+            PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::CaloHit::Create(*m_pPandora, **iter, *m_pCaloHitFactory));
+        }
+
+        for (StagedEvent::TrackParametersVector::const_iterator iter = stagedEvent.m_trackParameters.begin(),
+            iterEnd = stagedEvent.m_trackParameters.end(); iter != iterEnd; ++iter)
+        {
+            PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::Track::Create(*m_pPandora, **iter, *m_pTrackFactory));
+        }
+
+        for (StagedEvent::MCParticleParametersVector::const_iterator iter = stagedEvent.m_mcParticleParameters.begin(),
+            iterEnd = stagedEvent.m_mcParticleParameters.end(); iter != iterEnd; ++iter)
+        {
+            PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::MCParticle::Create(*m_pPandora, **iter, *m_pMCParticleFactory));
+        }
+
+        for (StagedEvent::RelationshipVector::const_iterator iter = stagedEvent.m_relationships.begin(),
+            iterEnd = stagedEvent.m_relationships.end(); iter != iterEnd; ++iter)
+        {
+            PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->SetRelationship(iter->m_relationshipId, iter->m_address1, iter->m_address2, iter->m_weight));
+        }
+    }
+    catch (StatusCodeException &statusCodeException)
+    {
+        stagedEvent.Clear();
+        return statusCodeException.GetStatusCode();
+    }
+
+    stagedEvent.Clear();
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 StatusCode FileReader::GoToNextGeometry()
 {
     do
@@ -105,4 +193,97 @@ StatusCode FileReader::GoToNextEvent()
     return STATUS_CODE_SUCCESS;
 }
 
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode FileReader::CreateCaloHit(PandoraApi::CaloHit::Parameters *const pParameters)
+{
+    if (NULL != m_pStagedEvent)
+    {
+        m_pStagedEvent->m_caloHitParameters.push_back(pParameters);
+        return STATUS_CODE_SUCCESS;
+    }
+
+    const StatusCode statusCode(PandoraApi::CaloHit::Create(*m_pPandora, *pParameters, *m_pCaloHitFactory));
+    delete pParameters;
+
+    return statusCode;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode FileReader::CreateTrack(PandoraApi::Track::Parameters *const pParameters)
+{
+    if (NULL != m_pStagedEvent)
+    {
+        m_pStagedEvent->m_trackParameters.push_back(pParameters);
+        return STATUS_CODE_SUCCESS;
+    }
+
+    const StatusCode statusCode(PandoraApi::Track::Create(*m_pPandora, *pParameters, *m_pTrackFactory));
+    delete pParameters;
+
+    return statusCode;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode FileReader::CreateMCParticle(PandoraApi::MCParticle::Parameters *const pParameters)
+{
+    if (NULL != m_pStagedEvent)
+    {
+        m_pStagedEvent->m_mcParticleParameters.push_back(pParameters);
+        return STATUS_CODE_SUCCESS;
+    }
+
+    const StatusCode statusCode(PandoraApi::MCParticle::Create(*m_pPandora, *pParameters, *m_pMCParticleFactory));
+    delete pParameters;
+
+    return statusCode;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode FileReader::CreateRelationship(const RelationshipId relationshipId, const void *const address1, const void *const address2,
+    const float weight)
+{
+    if (NULL != m_pStagedEvent)
+    {
+        if (UNKNOWN_RELATIONSHIP <= relationshipId)
+            return STATUS_CODE_FAILURE;
+
+        StagedEvent::Relationship relationship;
+        relationship.m_relationshipId = relationshipId;
+        relationship.m_address1 = address1;
+        relationship.m_address2 = address2;
+        relationship.m_weight = weight;
+        m_pStagedEvent->m_relationships.push_back(relationship);
+
+        return STATUS_CODE_SUCCESS;
+    }
+
+    return this->SetRelationship(relationshipId, address1, address2, weight);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode FileReader::SetRelationship(const RelationshipId relationshipId, const void *const address1, const void *const address2,
+    const float weight) const
+{
+    switch (relationshipId)
+    {
+    case CALO_HIT_TO_MC:
+        return PandoraApi::SetCaloHitToMCParticleRelationship(*m_pPandora, address1, address2, weight);
+    case TRACK_TO_MC:
+        return PandoraApi::SetTrackToMCParticleRelationship(*m_pPandora, address1, address2, weight);
+    case MC_PARENT_DAUGHTER:
+        return PandoraApi::SetMCParentDaughterRelationship(*m_pPandora, address1, address2);
+    case TRACK_PARENT_DAUGHTER:
+        return PandoraApi::SetTrackParentDaughterRelationship(*m_pPandora, address1, address2);
+    case TRACK_SIBLING:
+        return PandoraApi::SetTrackSiblingRelationship(*m_pPandora, address1, address2);
+    default:
+        return STATUS_CODE_FAILURE;
+    }
+}
+
 } // namespace pandora
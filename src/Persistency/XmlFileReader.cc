@@ -510,8 +510,6 @@ StatusCode XmlFileReader::ReadCaloHit()
         pParameters->m_layer = layer;
         pParameters->m_isInOuterSamplingLayer = isInOuterSamplingLayer;
         pParameters->m_pParentAddress = pParentAddress;
-        PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::CaloHit::Create(*m_pPandora, *pParameters, *m_pCaloHitFactory));
-        delete pParameters;
     }
     catch (StatusCodeException &statusCodeException)
     {
@@ -519,7 +517,7 @@ StatusCode XmlFileReader::ReadCaloHit()
         return statusCodeException.GetStatusCode();
     }
 
-    return STATUS_CODE_SUCCESS;
+    return this->CreateCaloHit(pParameters);
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -581,8 +579,6 @@ StatusCode XmlFileReader::ReadTrack()
         pParameters->m_canFormPfo = canFormPfo;
         pParameters->m_canFormClusterlessPfo = canFormClusterlessPfo;
         pParameters->m_pParentAddress = pParentAddress;
-        PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::Track::Create(*m_pPandora, *pParameters, *m_pTrackFactory));
-        delete pParameters;
     }
     catch (StatusCodeException &statusCodeException)
     {
@@ -590,7 +586,7 @@ StatusCode XmlFileReader::ReadTrack()
         return statusCodeException.GetStatusCode();
     }
 
-    return STATUS_CODE_SUCCESS;
+    return this->CreateTrack(pParameters);
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -629,8 +625,6 @@ StatusCode XmlFileReader::ReadMCParticle()
         pParameters->m_particleId = particleId;
         pParameters->m_mcParticleType = mcParticleType;
         pParameters->m_pParentAddress = pParentAddress;
-        PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::MCParticle::Create(*m_pPandora, *pParameters, *m_pMCParticleFactory));
-        delete pParameters;
     }
     catch (StatusCodeException &statusCodeException)
     {
@@ -638,7 +632,7 @@ StatusCode XmlFileReader::ReadMCParticle()
         return statusCodeException.GetStatusCode();
     }
 
-    return STATUS_CODE_SUCCESS;
+    return this->CreateMCParticle(pParameters);
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -658,23 +652,7 @@ StatusCode XmlFileReader::ReadRelationship()
     float weight(1.f);
     PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->ReadVariable("Weight", weight));
 
-    switch (relationshipId)
-    {
-    case CALO_HIT_TO_MC:
-        return PandoraApi::SetCaloHitToMCParticleRelationship(*m_pPandora, address1, address2, weight);
-    case TRACK_TO_MC:
-        return PandoraApi::SetTrackToMCParticleRelationship(*m_pPandora, address1, address2, weight);
-    case MC_PARENT_DAUGHTER:
-        return PandoraApi::SetMCParentDaughterRelationship(*m_pPandora, address1, address2);
-    case TRACK_PARENT_DAUGHTER:
-        return PandoraApi::SetTrackParentDaughterRelationship(*m_pPandora, address1, address2);
-    case TRACK_SIBLING:
-        return PandoraApi::SetTrackSiblingRelationship(*m_pPandora, address1, address2);
-    default:
-        return STATUS_CODE_FAILURE;
-    }
-
-    return STATUS_CODE_SUCCESS;
+    return this->CreateRelationship(relationshipId, address1, address2, weight);
 }
 
 } // namespace pandora
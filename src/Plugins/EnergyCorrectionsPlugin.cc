@@ -15,6 +15,22 @@
 namespace pandora
 {
 
+StatusCode EnergyCorrectionPlugin::MakeEnergyCorrections(const ClusterVector &clusterVector, FloatVector &correctedEnergyVector) const
+{
+    if (clusterVector.size() != correctedEnergyVector.size())
+        return STATUS_CODE_INVALID_PARAMETER;
+
+    for (unsigned int i = 0, iEnd = clusterVector.size(); i < iEnd; ++i)
+    {
+        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->MakeEnergyCorrections(clusterVector[i], correctedEnergyVector[i]));
+    }
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 StatusCode EnergyCorrections::MakeEnergyCorrections(const Cluster *const pCluster, float &correctedElectromagneticEnergy,
     float &correctedHadronicEnergy) const
 {
@@ -39,6 +55,37 @@ StatusCode EnergyCorrections::MakeEnergyCorrections(const Cluster *const pCluste
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+StatusCode EnergyCorrections::MakeEnergyCorrections(const ClusterVector &clusterVector, FloatVector &correctedElectromagneticEnergyVector,
+    FloatVector &correctedHadronicEnergyVector) const
+{
+    correctedElectromagneticEnergyVector.clear();
+    correctedHadronicEnergyVector.clear();
+    correctedElectromagneticEnergyVector.reserve(clusterVector.size());
+    correctedHadronicEnergyVector.reserve(clusterVector.size());
+
+    for (ClusterVector::const_iterator iter = clusterVector.begin(), iterEnd = clusterVector.end(); iter != iterEnd; ++iter)
+    {
+        correctedElectromagneticEnergyVector.push_back((*iter)->GetElectromagneticEnergy());
+        correctedHadronicEnergyVector.push_back((*iter)->GetHadronicEnergy());
+    }
+
+    for (EnergyCorrectionPluginVector::const_iterator iter = m_hadEnergyCorrectionPlugins.begin(),
+        iterEnd = m_hadEnergyCorrectionPlugins.end(); iter != iterEnd; ++iter)
+    {
+        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, (*iter)->MakeEnergyCorrections(clusterVector, correctedHadronicEnergyVector));
+    }
+
+    for (EnergyCorrectionPluginVector::const_iterator iter = m_emEnergyCorrectionPlugins.begin(),
+        iterEnd = m_emEnergyCorrectionPlugins.end(); iter != iterEnd; ++iter)
+    {
+        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, (*iter)->MakeEnergyCorrections(clusterVector, correctedElectromagneticEnergyVector));
+    }
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 EnergyCorrections::EnergyCorrections(const Pandora *const pPandora) :
     m_pPandora(pPandora)
 {
@@ -19,6 +19,18 @@
 namespace pandora
 {
 
+void ParticleIdPlugin::IsMatch(const ClusterVector &clusterVector, BoolVector &isMatchVector) const
+{
+    isMatchVector.clear();
+    isMatchVector.reserve(clusterVector.size());
+
+    for (ClusterVector::const_iterator iter = clusterVector.begin(), iterEnd = clusterVector.end(); iter != iterEnd; ++iter)
+        isMatchVector.push_back(this->IsMatch(*iter));
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 bool ParticleId::IsEmShower(const Cluster *const pCluster) const
 {
     if (NULL == m_pEmShowerPlugin)
@@ -42,6 +54,57 @@ bool ParticleId::IsPhoton(const Cluster *const pCluster) const
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+void ParticleId::IsEmShower(const ClusterVector &clusterVector, BoolVector &isEmShowerVector) const
+{
+    if (NULL == m_pEmShowerPlugin)
+    {
+        isEmShowerVector.assign(clusterVector.size(), false);
+        return;
+    }
+
+    m_pEmShowerPlugin->IsMatch(clusterVector, isEmShowerVector);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void ParticleId::IsPhoton(const ClusterVector &clusterVector, BoolVector &isPhotonVector) const
+{
+    isPhotonVector.assign(clusterVector.size(), true);
+
+    if (NULL == m_pPhotonPlugin)
+    {
+        for (unsigned int i = 0, iEnd = clusterVector.size(); i < iEnd; ++i)
+            isPhotonVector[i] = (PHOTON == clusterVector[i]->GetParticleIdFlag());
+
+        return;
+    }
+
+    ClusterVector unflaggedClusterVector;
+
+    for (ClusterVector::const_iterator iter = clusterVector.begin(), iterEnd = clusterVector.end(); iter != iterEnd; ++iter)
+    {
+        if (PHOTON != (*iter)->GetParticleIdFlag())
+            unflaggedClusterVector.push_back(*iter);
+    }
+
+    if (unflaggedClusterVector.empty())
+        return;
+
+    BoolVector isMatchVector;
+    m_pPhotonPlugin->IsMatch(unflaggedClusterVector, isMatchVector);
+
+    if (isMatchVector.size() != unflaggedClusterVector.size())
+        throw StatusCodeException(STATUS_CODE_FAILURE);
+
+    for (unsigned int i = 0, j = 0, iEnd = clusterVector.size(); i < iEnd; ++i)
+    {
+        if (PHOTON != clusterVector[i]->GetParticleIdFlag())
+            isPhotonVector[i] = isMatchVector[j++];
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 bool ParticleId::IsElectron(const Cluster *const pCluster) const
 {
     if (E_MINUS == std::abs(pCluster->GetParticleIdFlag()))
@@ -0,0 +1,36 @@
+/**
+ *  @file   PandoraSDK/src/Plugins/ShowerProfilePlugin.cc
+ * 
+ *  @brief  Implementation of the shower profile plugin interface class.
+ * 
+ *  $Log: $
+ */
+
+#include "Plugins/ShowerProfilePlugin.h"
+
+#include <limits>
+
+namespace pandora
+{
+
+void ShowerProfilePlugin::CalculateShowerStartLayer(const ClusterVector &clusterVector, UIntVector &showerStartLayerVector) const
+{
+    showerStartLayerVector.assign(clusterVector.size(), std::numeric_limits<unsigned int>::max());
+
+    for (unsigned int i = 0, iEnd = clusterVector.size(); i < iEnd; ++i)
+        this->CalculateShowerStartLayer(clusterVector[i], showerStartLayerVector[i]);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void ShowerProfilePlugin::CalculateLongitudinalProfile(const ClusterVector &clusterVector, FloatVector &profileStartVector,
+    FloatVector &profileDiscrepancyVector) const
+{
+    profileStartVector.assign(clusterVector.size(), std::numeric_limits<float>::max());
+    profileDiscrepancyVector.assign(clusterVector.size(), std::numeric_limits<float>::max());
+
+    for (unsigned int i = 0, iEnd = clusterVector.size(); i < iEnd; ++i)
+        this->CalculateLongitudinalProfile(clusterVector[i], profileStartVector[i], profileDiscrepancyVector[i]);
+}
+
+} // namespace pandora